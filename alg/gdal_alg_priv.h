@@ -20,6 +20,7 @@
 
 #include <cstdint>
 
+#include <memory>
 #include <set>
 
 #include "gdal_alg.h"
@@ -185,6 +186,10 @@ int GDALTransformLonLatToDestGenImgProjTransformer(void *hTransformArg,
                                                    double *pdfX, double *pdfY);
 int GDALTransformLonLatToDestApproxTransformer(void *hTransformArg,
                                                double *pdfX, double *pdfY);
+bool GDALApproxTransformerEnableGrid(void *hTransformArg, int bDstToSrc,
+                                     double dfMinX, double dfMinY,
+                                     double dfMaxX, double dfMaxY,
+                                     double dfStep);
 
 bool GDALTransformIsTranslationOnPixelBoundaries(
     GDALTransformerFunc pfnTransformer, void *pTransformerArg);
@@ -280,6 +285,8 @@ struct GDALReprojectionTransformInfo
 /* ==================================================================== */
 /************************************************************************/
 
+struct GDALApproxTransformLazyGrid;
+
 struct GDALApproxTransformInfo
 {
     GDALTransformerInfo sTI;
@@ -291,6 +298,12 @@ struct GDALApproxTransformInfo
 
     int bOwnSubtransformer = 0;
 
+    // Lookup grid of exactly transformed nodes, enabled by
+    // GDALApproxTransformerEnableGrid(), built on first need, and shared
+    // with similar transformers.
+    std::shared_ptr<GDALApproxTransformLazyGrid> poGrid{};
+    bool bUseGrid = true;
+
     GDALApproxTransformInfo() : sTI()
     {
         memset(&sTI, 0, sizeof(sTI));
@@ -25,8 +25,12 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -3924,6 +3928,12 @@ static void *GDALCreateSimilarApproxTransformer(void *hTransformArg,
             psInfo->pfnBaseTransformer, pBaseCBData, psInfo->dfMaxErrorForward,
             psInfo->dfMaxErrorReverse));
     psClonedInfo->bOwnSubtransformer = TRUE;
+    // The grid is only valid for the same input space.
+    if (dfSrcRatioX == 1.0 && dfSrcRatioY == 1.0)
+    {
+        psClonedInfo->poGrid = psInfo->poGrid;
+        psClonedInfo->bUseGrid = psInfo->bUseGrid;
+    }
 
     return psClonedInfo;
 }
@@ -4104,6 +4114,11 @@ void GDALRefreshApproxTransformer(void *hTransformArg)
     {
         GDALRefreshGenImgProjTransformer(psInfo->pBaseCBData);
     }
+
+    // The grid does not do the extra checks requested by
+    // CHECK_WITH_INVERT_PROJ.
+    psInfo->bUseGrid =
+        !CPLTestBool(CPLGetConfigOption("CHECK_WITH_INVERT_PROJ", "NO"));
 }
 
 /************************************************************************/
@@ -4358,6 +4373,380 @@ static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                       GDALApproxTransformGrid                        */
+/************************************************************************/
+
+// Exact transformation of the nodes of a regular grid, in the input space of
+// the approximate transformer, and validity of each grid cell for a bilinear
+// interpolation within the error threshold.
+struct GDALApproxTransformGrid
+{
+    double dfMinX = 0;
+    double dfMinY = 0;
+    double dfStep = 0;
+    int nXNodes = 0;
+    int nYNodes = 0;
+    std::vector<double> adfX{};
+    std::vector<double> adfY{};
+    std::vector<double> adfZ{};
+    std::vector<bool> abValidCells{};
+};
+
+/************************************************************************/
+/*                     GDALApproxTransformLazyGrid                      */
+/************************************************************************/
+
+// Parameters of a lookup grid, and the grid itself once built. Shared by
+// the clones of an approximate transformer, so that it is built only once.
+struct GDALApproxTransformLazyGrid
+{
+    int bDstToSrc = TRUE;
+    double dfMinX = 0;
+    double dfMinY = 0;
+    double dfMaxX = 0;
+    double dfMaxY = 0;
+    double dfRequestedStep = 0;
+    double dfStep = 0;
+    int nXNodes = 0;
+    int nYNodes = 0;
+
+    // Number of points transformed by the approximate transformers sharing
+    // this object while the grid was not built yet.
+    std::atomic<GUIntBig> nTransformedPoints{0};
+    std::atomic<bool> bBuilt{false};
+    std::once_flag oBuildFlag{};
+    std::unique_ptr<const GDALApproxTransformGrid> poGrid{};
+
+    // Number of points to evaluate with the base transformer to build the
+    // grid: the nodes, and the center and edge midpoints of the cells.
+    GUIntBig GetBuildCost() const
+    {
+        return static_cast<GUIntBig>(2 * nXNodes - 1) * (2 * nYNodes - 1);
+    }
+};
+
+/************************************************************************/
+/*                  GDALApproxTransformerEnableGrid()                   */
+/************************************************************************/
+
+/** Enable a lookup grid for an approximate transformer.
+ *
+ * The base transformer is evaluated on the nodes of a regular grid of
+ * spacing dfStep covering [dfMinX,dfMaxX]x[dfMinY,dfMaxY], as well as on the
+ * center and edge midpoints of each cell. Cells for which the bilinear
+ * interpolation of the nodes is within the maximum error of the approximate
+ * transformer are then used by GDALApproxTransform() instead of calling the
+ * base transformer. Other points go through the usual approximation.
+ *
+ * The grid is only built by GDALApproxTransform() once the transformer has
+ * been asked to transform more points than building the grid requires, so
+ * that transforming a few points does not pay for the whole grid. It is not
+ * used when CHECK_WITH_INVERT_PROJ is enabled, as it does not do the extra
+ * checks of that mode.
+ *
+ * The grid is immutable once built, and is shared with the transformers
+ * returned by GDALCloneTransformer(), so that threads using clones of the
+ * transformer do not need to rebuild it.
+ *
+ * @return true if the grid has been enabled.
+ */
+bool GDALApproxTransformerEnableGrid(void *hTransformArg, int bDstToSrc,
+                                     double dfMinX, double dfMinY,
+                                     double dfMaxX, double dfMaxY,
+                                     double dfStep)
+{
+    GDALApproxTransformInfo *psATInfo =
+        static_cast<GDALApproxTransformInfo *>(hTransformArg);
+
+    const double dfMaxError =
+        bDstToSrc ? psATInfo->dfMaxErrorReverse : psATInfo->dfMaxErrorForward;
+    if (!(dfStep > 0) || !(dfMaxX > dfMinX) || !(dfMaxY > dfMinY) ||
+        dfMaxError == 0 ||
+        CPLTestBool(CPLGetConfigOption("CHECK_WITH_INVERT_PROJ", "NO")))
+    {
+        return false;
+    }
+
+    if (const auto &poExistingGrid = psATInfo->poGrid)
+    {
+        if (poExistingGrid->bDstToSrc == bDstToSrc &&
+            poExistingGrid->dfMinX == dfMinX &&
+            poExistingGrid->dfMinY == dfMinY &&
+            poExistingGrid->dfMaxX == dfMaxX &&
+            poExistingGrid->dfMaxY == dfMaxY &&
+            poExistingGrid->dfRequestedStep == dfStep)
+        {
+            return true;
+        }
+    }
+
+    // Limit memory usage to a few hundred megabytes in the worst case.
+    constexpr double MAX_NODES = 4 * 1024 * 1024;
+    const double dfRequestedStep = dfStep;
+    double dfXNodes = 0;
+    double dfYNodes = 0;
+    while (true)
+    {
+        dfXNodes = std::ceil((dfMaxX - dfMinX) / dfStep) + 1;
+        dfYNodes = std::ceil((dfMaxY - dfMinY) / dfStep) + 1;
+        if (dfXNodes * dfYNodes <= MAX_NODES)
+            break;
+        dfStep *= 2;
+    }
+
+    auto poGrid = std::make_shared<GDALApproxTransformLazyGrid>();
+    poGrid->bDstToSrc = bDstToSrc;
+    poGrid->dfMinX = dfMinX;
+    poGrid->dfMinY = dfMinY;
+    poGrid->dfMaxX = dfMaxX;
+    poGrid->dfMaxY = dfMaxY;
+    poGrid->dfRequestedStep = dfRequestedStep;
+    poGrid->dfStep = dfStep;
+    poGrid->nXNodes = static_cast<int>(dfXNodes);
+    poGrid->nYNodes = static_cast<int>(dfYNodes);
+    psATInfo->poGrid = std::move(poGrid);
+    psATInfo->bUseGrid = true;
+    return true;
+}
+
+/************************************************************************/
+/*                    GDALApproxTransformBuildGrid()                    */
+/************************************************************************/
+
+// Evaluate the base transformer of psATInfo on the grid described by
+// oLazyGrid. Returns nullptr if no cell is usable.
+static std::unique_ptr<const GDALApproxTransformGrid>
+GDALApproxTransformBuildGrid(const GDALApproxTransformInfo *psATInfo,
+                             const GDALApproxTransformLazyGrid &oLazyGrid)
+{
+    const int bDstToSrc = oLazyGrid.bDstToSrc;
+    const double dfMaxError =
+        bDstToSrc ? psATInfo->dfMaxErrorReverse : psATInfo->dfMaxErrorForward;
+    const double dfMinX = oLazyGrid.dfMinX;
+    const double dfMinY = oLazyGrid.dfMinY;
+    const double dfStep = oLazyGrid.dfStep;
+    const int nXNodes = oLazyGrid.nXNodes;
+    const int nYNodes = oLazyGrid.nYNodes;
+
+    auto poGrid = std::make_unique<GDALApproxTransformGrid>();
+    poGrid->dfMinX = dfMinX;
+    poGrid->dfMinY = dfMinY;
+    poGrid->dfStep = dfStep;
+    poGrid->nXNodes = nXNodes;
+    poGrid->nYNodes = nYNodes;
+    try
+    {
+        const size_t nNodes = static_cast<size_t>(nXNodes) * nYNodes;
+        poGrid->adfX.resize(nNodes);
+        poGrid->adfY.resize(nNodes);
+        poGrid->adfZ.resize(nNodes);
+        poGrid->abValidCells.resize(static_cast<size_t>(nXNodes - 1) *
+                                    (nYNodes - 1));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate approximate transformer grid");
+        return nullptr;
+    }
+
+    // Rows at half-step spacing: even rows contain the nodes and the
+    // midpoints of horizontal edges, odd rows the midpoints of vertical
+    // edges and the cell centers.
+    const int nFineXSize = 2 * nXNodes - 1;
+    struct FineRow
+    {
+        std::vector<double> adfX{};
+        std::vector<double> adfY{};
+        std::vector<double> adfZ{};
+        std::vector<int> abSuccess{};
+    };
+
+    FineRow aoRows[3];
+    for (auto &oRow : aoRows)
+    {
+        oRow.adfX.resize(nFineXSize);
+        oRow.adfY.resize(nFineXSize);
+        oRow.adfZ.resize(nFineXSize);
+        oRow.abSuccess.resize(nFineXSize);
+    }
+
+    const auto TransformFineRow = [psATInfo, bDstToSrc, dfMinX, dfMinY, dfStep,
+                                   nFineXSize](int iFineRow, FineRow &oRow)
+    {
+        for (int i = 0; i < nFineXSize; ++i)
+        {
+            oRow.adfX[i] = dfMinX + i * dfStep / 2;
+            oRow.adfY[i] = dfMinY + iFineRow * dfStep / 2;
+            oRow.adfZ[i] = 0;
+        }
+        if (!psATInfo->pfnBaseTransformer(
+                psATInfo->pBaseCBData, bDstToSrc, nFineXSize,
+                oRow.adfX.data(), oRow.adfY.data(), oRow.adfZ.data(),
+                oRow.abSuccess.data()))
+        {
+            std::fill(oRow.abSuccess.begin(), oRow.abSuccess.end(), FALSE);
+        }
+    };
+
+    const auto StoreNodeRow = [&poGrid, nXNodes](int iRow, const FineRow &oRow)
+    {
+        for (int i = 0; i < nXNodes; ++i)
+        {
+            const size_t nIdx = static_cast<size_t>(iRow) * nXNodes + i;
+            poGrid->adfX[nIdx] = oRow.adfX[2 * i];
+            poGrid->adfY[nIdx] = oRow.adfY[2 * i];
+            poGrid->adfZ[nIdx] = oRow.adfZ[2 * i];
+        }
+    };
+
+    int nValidCells = 0;
+    TransformFineRow(0, aoRows[0]);
+    for (int iY = 0; iY < nYNodes - 1; ++iY)
+    {
+        TransformFineRow(2 * iY + 1, aoRows[1]);
+        TransformFineRow(2 * iY + 2, aoRows[2]);
+        const FineRow &oTop = aoRows[0];
+        const FineRow &oMid = aoRows[1];
+        const FineRow &oBottom = aoRows[2];
+
+        for (int iX = 0; iX < nXNodes - 1; ++iX)
+        {
+            const int i0 = 2 * iX;
+            const int i1 = 2 * iX + 1;
+            const int i2 = 2 * iX + 2;
+            bool bValid = oTop.abSuccess[i0] && oTop.abSuccess[i1] &&
+                          oTop.abSuccess[i2] && oMid.abSuccess[i0] &&
+                          oMid.abSuccess[i1] && oMid.abSuccess[i2] &&
+                          oBottom.abSuccess[i0] && oBottom.abSuccess[i1] &&
+                          oBottom.abSuccess[i2];
+            if (bValid)
+            {
+                const auto Error = [](double dfX, double dfY, double dfRefX,
+                                      double dfRefY)
+                { return fabs(dfX - dfRefX) + fabs(dfY - dfRefY); };
+                const double dfErrorTop =
+                    Error((oTop.adfX[i0] + oTop.adfX[i2]) / 2,
+                          (oTop.adfY[i0] + oTop.adfY[i2]) / 2, oTop.adfX[i1],
+                          oTop.adfY[i1]);
+                const double dfErrorBottom =
+                    Error((oBottom.adfX[i0] + oBottom.adfX[i2]) / 2,
+                          (oBottom.adfY[i0] + oBottom.adfY[i2]) / 2,
+                          oBottom.adfX[i1], oBottom.adfY[i1]);
+                const double dfErrorLeft =
+                    Error((oTop.adfX[i0] + oBottom.adfX[i0]) / 2,
+                          (oTop.adfY[i0] + oBottom.adfY[i0]) / 2, oMid.adfX[i0],
+                          oMid.adfY[i0]);
+                const double dfErrorRight =
+                    Error((oTop.adfX[i2] + oBottom.adfX[i2]) / 2,
+                          (oTop.adfY[i2] + oBottom.adfY[i2]) / 2, oMid.adfX[i2],
+                          oMid.adfY[i2]);
+                const double dfErrorCenter =
+                    Error((oTop.adfX[i0] + oTop.adfX[i2] + oBottom.adfX[i0] +
+                           oBottom.adfX[i2]) /
+                              4,
+                          (oTop.adfY[i0] + oTop.adfY[i2] + oBottom.adfY[i0] +
+                           oBottom.adfY[i2]) /
+                              4,
+                          oMid.adfX[i1], oMid.adfY[i1]);
+                bValid = std::max({dfErrorTop, dfErrorBottom, dfErrorLeft,
+                                   dfErrorRight, dfErrorCenter}) <= dfMaxError;
+            }
+            poGrid->abValidCells[static_cast<size_t>(iY) * (nXNodes - 1) +
+                                 iX] = bValid;
+            if (bValid)
+                ++nValidCells;
+        }
+
+        StoreNodeRow(iY, oTop);
+        std::swap(aoRows[0], aoRows[2]);
+    }
+    StoreNodeRow(nYNodes - 1, aoRows[0]);
+
+    const int nCells = (nXNodes - 1) * (nYNodes - 1);
+    CPLDebug("GDAL",
+             "Approximate transformer grid: %d x %d nodes, step %g, "
+             "%d / %d valid cells",
+             nXNodes, nYNodes, dfStep, nValidCells, nCells);
+
+    if (nValidCells == 0)
+        return nullptr;
+
+    return poGrid;
+}
+
+/************************************************************************/
+/*                    GDALApproxTransformWithGrid()                     */
+/************************************************************************/
+
+// Transform all points by bilinear interpolation of the grid, if they all
+// fall in valid cells. Otherwise returns false without modifying them.
+static bool GDALApproxTransformWithGrid(const GDALApproxTransformGrid &oGrid,
+                                        int nPoints, double *x, double *y,
+                                        double *z, int *panSuccess)
+{
+    const double dfInvStep = 1.0 / oGrid.dfStep;
+    const int nXNodes = oGrid.nXNodes;
+    const int nYNodes = oGrid.nYNodes;
+
+    const auto GetCell = [&oGrid, x, y, z, dfInvStep, nXNodes,
+                          nYNodes](int i, int &iCellX, int &iCellY,
+                                   double &dfFracX, double &dfFracY)
+    {
+        if (z[i] != 0)
+            return false;
+        const double dfX = (x[i] - oGrid.dfMinX) * dfInvStep;
+        const double dfY = (y[i] - oGrid.dfMinY) * dfInvStep;
+        // Also rejects NaN
+        if (!(dfX >= 0 && dfX <= nXNodes - 1 && dfY >= 0 &&
+              dfY <= nYNodes - 1))
+        {
+            return false;
+        }
+        iCellX = std::min(static_cast<int>(dfX), nXNodes - 2);
+        iCellY = std::min(static_cast<int>(dfY), nYNodes - 2);
+        dfFracX = dfX - iCellX;
+        dfFracY = dfY - iCellY;
+        return static_cast<bool>(
+            oGrid.abValidCells[static_cast<size_t>(iCellY) * (nXNodes - 1) +
+                               iCellX]);
+    };
+
+    int iCellX = 0;
+    int iCellY = 0;
+    double dfFracX = 0;
+    double dfFracY = 0;
+    for (int i = 0; i < nPoints; ++i)
+    {
+        if (!GetCell(i, iCellX, iCellY, dfFracX, dfFracY))
+            return false;
+    }
+
+    for (int i = 0; i < nPoints; ++i)
+    {
+        GetCell(i, iCellX, iCellY, dfFracX, dfFracY);
+        const size_t i00 = static_cast<size_t>(iCellY) * nXNodes + iCellX;
+        const size_t i10 = i00 + 1;
+        const size_t i01 = i00 + nXNodes;
+        const size_t i11 = i01 + 1;
+        const auto Interpolate = [i00, i10, i01, i11, dfFracX,
+                                  dfFracY](const std::vector<double> &adfVal)
+        {
+            return (adfVal[i00] * (1 - dfFracX) + adfVal[i10] * dfFracX) *
+                       (1 - dfFracY) +
+                   (adfVal[i01] * (1 - dfFracX) + adfVal[i11] * dfFracX) *
+                       dfFracY;
+        };
+        x[i] = Interpolate(oGrid.adfX);
+        y[i] = Interpolate(oGrid.adfY);
+        z[i] = Interpolate(oGrid.adfZ);
+        panSuccess[i] = TRUE;
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                        GDALApproxTransform()                         */
 /************************************************************************/
@@ -4377,6 +4766,35 @@ int GDALApproxTransform(void *pCBData, int bDstToSrc, int nPoints, double *x,
 {
     GDALApproxTransformInfo *psATInfo =
         static_cast<GDALApproxTransformInfo *>(pCBData);
+
+    if (psATInfo->poGrid && psATInfo->bUseGrid &&
+        psATInfo->poGrid->bDstToSrc == bDstToSrc)
+    {
+        GDALApproxTransformLazyGrid &oLazyGrid = *(psATInfo->poGrid);
+        if (!oLazyGrid.bBuilt.load(std::memory_order_acquire) &&
+            oLazyGrid.nTransformedPoints.fetch_add(
+                nPoints, std::memory_order_relaxed) +
+                    nPoints >=
+                oLazyGrid.GetBuildCost())
+        {
+            std::call_once(oLazyGrid.oBuildFlag,
+                           [psATInfo, &oLazyGrid]()
+                           {
+                               oLazyGrid.poGrid = GDALApproxTransformBuildGrid(
+                                   psATInfo, oLazyGrid);
+                               oLazyGrid.bBuilt.store(
+                                   true, std::memory_order_release);
+                           });
+        }
+        if (oLazyGrid.bBuilt.load(std::memory_order_acquire) &&
+            oLazyGrid.poGrid &&
+            GDALApproxTransformWithGrid(*(oLazyGrid.poGrid), nPoints, x, y, z,
+                                        panSuccess))
+        {
+            return TRUE;
+        }
+    }
+
     double x2[3] = {};
     double y2[3] = {};
     double z2[3] = {};
@@ -4997,6 +5415,12 @@ void GDALSetTransformerDstGeoTransform(void *pTransformArg,
 {
     VALIDATE_POINTER0(pTransformArg, "GDALSetTransformerDstGeoTransform");
 
+    if (GDALIsTransformer(pTransformArg, GDAL_APPROX_TRANSFORMER_CLASS_NAME))
+    {
+        // The grid is no longer valid
+        static_cast<GDALApproxTransformInfo *>(pTransformArg)->poGrid.reset();
+    }
+
     GDALTransformerInfo *psInfo = GetGenImgProjTransformInfo(
         "GDALSetTransformerDstGeoTransform", pTransformArg);
     if (psInfo)
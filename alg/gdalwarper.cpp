@@ -1177,6 +1177,20 @@ const char *GDALWarpGetOptionList(void)
            "Can be set to a numeric value or ALL_CPUS to set the number of "
            "threads to use to parallelize the computation part of the warping. "
            "If not set, computation will be done in a single thread..'/>"
+           "<Option name='APPROX_GRID' type='boolean' description='"
+           "Whether to precompute a grid of exactly transformed points, "
+           "interpolated within the error threshold of the approximate "
+           "transformer. The grid is built once enough points have been "
+           "transformed, and is not used with CHECK_WITH_INVERT_PROJ=YES.' "
+           "default='NO'/>"
+           "<Option name='APPROX_GRID_STEP' type='int' description='"
+           "Spacing in target pixels between the nodes of the grid used when "
+           "APPROX_GRID=YES.' default='32'/>"
+           "<Option name='NUM_CHUNKS_IN_FLIGHT' type='string' description='"
+           "Can be set to a numeric value or ALL_CPUS to set the number of "
+           "chunks processed concurrently in multithreaded warping mode. "
+           "Memory usage may reach this number times the warp memory limit.' "
+           "default='2'/>"
            "<Option name='STREAMABLE_OUTPUT' type='boolean' description='"
            "This defaults to FALSE, but may be set to TRUE typically when "
            "writing to a streamed file. The gdalwarp utility automatically "
@@ -1421,6 +1435,28 @@ const char *GDALWarpGetOptionList(void)
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>APPROX_GRID=YES/NO: (GDAL >= 3.14) Defaults to NO. When the
+ * transformer is an approximate transformer (GDALApproxTransform()), setting
+ * this option to YES computes once, for the whole target raster, a grid of
+ * exactly transformed points. Target pixels in grid cells where the bilinear
+ * interpolation of the grid nodes is within the error threshold of the
+ * approximate transformer are then computed by interpolation, without calling
+ * the exact transformer. The grid is shared by all chunks and threads, and
+ * is only computed once more points have been transformed than it requires,
+ * so that small warps do not pay for it. It is not used when the
+ * CHECK_WITH_INVERT_PROJ configuration option is set to YES. This is mostly
+ * useful when the exact transformation is costly, such as with coordinate
+ * operations using grids.</li>
+ *
+ * <li>APPROX_GRID_STEP=[pixels]: (GDAL >= 3.14) Spacing in target pixels
+ * between the nodes of the grid used when APPROX_GRID=YES. Defaults to 32.</li>
+ *
+ * <li>NUM_CHUNKS_IN_FLIGHT: (GDAL >= 3.14) Can be set to a numeric value or
+ * ALL_CPUS to set the number of chunks that
+ * GDALWarpOperation::ChunkAndWarpMulti() processes concurrently. Defaults to 2.
+ * Values greater than 2 require a transformer that can be cloned. Memory usage
+ * may reach this number times the warp memory limit.</li>
+ *
  * <li>STREAMABLE_OUTPUT: This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
@@ -485,6 +485,7 @@ void GWKThreadsEnd(void *psThreadDataIn);
 
 /*! @cond Doxygen_Suppress */
 typedef struct _GDALWarpChunk GDALWarpChunk;
+struct GDALWarpChunkContext;
 
 struct GDALTransformerUniquePtrReleaser
 {
@@ -547,6 +548,20 @@ class CPL_DLL GDALWarpOperation final
     bool m_bIsTranslationOnPixelBoundaries = false;
 
     void WipeChunkList();
+    int GetChunksInFlight() const;
+    static void ChunkThreadMain(void *pThreadData);
+    CPLErr WarpRegionInternal(int nDstXOff, int nDstYOff, int nDstXSize,
+                              int nDstYSize, int nSrcXOff, int nSrcYOff,
+                              int nSrcXSize, int nSrcYSize,
+                              double dfSrcXExtraSize, double dfSrcYExtraSize,
+                              double dfProgressBase, double dfProgressScale,
+                              const GDALWarpChunkContext *psContext);
+    CPLErr WarpRegionToBufferInternal(
+        int nDstXOff, int nDstYOff, int nDstXSize, int nDstYSize,
+        void *pDataBuf, GDALDataType eBufDataType, int nSrcXOff, int nSrcYOff,
+        int nSrcXSize, int nSrcYSize, double dfSrcXExtraSize,
+        double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale,
+        const GDALWarpChunkContext *psContext);
     CPLErr CollectChunkListInternal(int nDstXOff, int nDstYOff, int nDstXSize,
                                     int nDstYSize);
     void CollectChunkList(int nDstXOff, int nDstYOff, int nDstXSize,
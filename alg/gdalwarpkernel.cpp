@@ -3615,6 +3615,343 @@ static bool GWKCubicResampleSrcMaskIsDensity4SampleReal(
     return true;
 }
 
+/************************************************************************/
+/*                            GWKMaskGet4()                             */
+/*                                                                      */
+/*  Return the bits of a validity mask for the 4 consecutive pixels     */
+/*  starting at iOffset, in the 4 lowest bits of the result.            */
+/************************************************************************/
+
+static CPL_INLINE GUInt32 GWKMaskGet4(const GUInt32 *panMask,
+                                      GPtrDiff_t iOffset)
+{
+    const int nShift = static_cast<int>(iOffset & 31);
+    const GUInt32 *panWord = panMask + (iOffset >> 5);
+    GUInt32 nBits = panWord[0] >> nShift;
+    if (nShift > 28)
+        nBits |= panWord[1] << (32 - nShift);
+    return nBits & 0xf;
+}
+
+/************************************************************************/
+/*                          GWKGetSrcDensity()                          */
+/*                                                                      */
+/*  Density of a source pixel of a band, combining the validity masks  */
+/*  and the unified density, as computed by GWKGetPixelRow().           */
+/************************************************************************/
+
+static CPL_INLINE double GWKGetSrcDensity(const GDALWarpKernel *poWK,
+                                          GUInt32 *panBandSrcValid,
+                                          GPtrDiff_t iSrcOffset)
+{
+    if ((poWK->panUnifiedSrcValid != nullptr &&
+         !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset)) ||
+        (panBandSrcValid != nullptr &&
+         !CPLMaskGet(panBandSrcValid, iSrcOffset)))
+    {
+        return 0.0;
+    }
+    if (poWK->pafUnifiedSrcDensity != nullptr)
+        return double(poWK->pafUnifiedSrcDensity[iSrcOffset]);
+    return 1.0;
+}
+
+/************************************************************************/
+/*                  GWKBilinearResample4SampleRealT()                   */
+/*                                                                      */
+/*  Same as GWKBilinearResample4Sample(), specialized for a real data   */
+/*  type, to avoid the per-pixel data type switch of GWKGetPixelRow().  */
+/************************************************************************/
+
+template <class T>
+static bool GWKBilinearResample4SampleRealT(const GDALWarpKernel *poWK,
+                                            int iBand, double dfSrcX,
+                                            double dfSrcY, double *pdfDensity,
+                                            double *pdfReal)
+
+{
+    // Save as local variables to avoid following pointers.
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int nSrcYSize = poWK->nSrcYSize;
+    const T *pSrc = reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]);
+    GUInt32 *panBandSrcValid = poWK->papanBandSrcValid != nullptr
+                                   ? poWK->papanBandSrcValid[iBand]
+                                   : nullptr;
+
+    int iSrcX = static_cast<int>(floor(dfSrcX - 0.5));
+    int iSrcY = static_cast<int>(floor(dfSrcY - 0.5));
+    double dfRatioX = 1.5 - (dfSrcX - iSrcX);
+    double dfRatioY = 1.5 - (dfSrcY - iSrcY);
+
+    if (iSrcX == -1)
+    {
+        iSrcX = 0;
+        dfRatioX = 1;
+    }
+    if (iSrcY == -1)
+    {
+        iSrcY = 0;
+        dfRatioY = 1;
+    }
+    GPtrDiff_t iSrcOffset = iSrcX + static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+
+    // Shift so we don't overrun the array. Both columns then use the
+    // right pixel.
+    GPtrDiff_t iLeftShift = 0;
+    const GPtrDiff_t nSrcPixels =
+        static_cast<GPtrDiff_t>(nSrcXSize) * nSrcYSize;
+    if (nSrcPixels == iSrcOffset + 1 ||
+        nSrcPixels == iSrcOffset + nSrcXSize + 1)
+    {
+        iLeftShift = 1;
+        --iSrcOffset;
+    }
+
+    double dfAccumulatorReal = 0.0;
+    double dfAccumulatorDensity = 0.0;
+    double dfAccumulatorDivisor = 0.0;
+
+    const auto Accumulate = [&](GPtrDiff_t iOffset, double dfMult)
+    {
+        const double dfDensity =
+            GWKGetSrcDensity(poWK, panBandSrcValid, iOffset);
+        if (dfDensity > SRC_DENSITY_THRESHOLD_DOUBLE)
+        {
+            dfAccumulatorDivisor += dfMult;
+
+            dfAccumulatorReal += double(pSrc[iOffset]) * dfMult;
+            dfAccumulatorDensity += dfDensity * dfMult;
+        }
+    };
+
+    // Upper row.
+    if (iSrcY >= 0 && iSrcY < nSrcYSize && iSrcOffset >= 0 &&
+        iSrcOffset < nSrcPixels)
+    {
+        if (iSrcX >= 0 && iSrcX < nSrcXSize)
+            Accumulate(iSrcOffset + iLeftShift, dfRatioX * dfRatioY);
+
+        if (iSrcX + 1 >= 0 && iSrcX + 1 < nSrcXSize)
+            Accumulate(iSrcOffset + 1, (1.0 - dfRatioX) * dfRatioY);
+    }
+
+    // Lower row.
+    if (iSrcY + 1 >= 0 && iSrcY + 1 < nSrcYSize &&
+        iSrcOffset + nSrcXSize >= 0 && iSrcOffset + nSrcXSize < nSrcPixels)
+    {
+        if (iSrcX >= 0 && iSrcX < nSrcXSize)
+            Accumulate(iSrcOffset + nSrcXSize + iLeftShift,
+                       dfRatioX * (1.0 - dfRatioY));
+
+        if (iSrcX + 1 >= 0 && iSrcX + 1 < nSrcXSize)
+            Accumulate(iSrcOffset + nSrcXSize + 1,
+                       (1.0 - dfRatioX) * (1.0 - dfRatioY));
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Return result.                                                  */
+    /* -------------------------------------------------------------------- */
+    if (dfAccumulatorDivisor == 1.0)
+    {
+        *pdfReal = dfAccumulatorReal;
+        *pdfDensity = dfAccumulatorDensity;
+        return false;
+    }
+    else if (dfAccumulatorDivisor < 0.00001)
+    {
+        *pdfReal = 0.0;
+        *pdfDensity = 0.0;
+        return false;
+    }
+    else
+    {
+        *pdfReal = dfAccumulatorReal / dfAccumulatorDivisor;
+        *pdfDensity = dfAccumulatorDensity / dfAccumulatorDivisor;
+        return true;
+    }
+}
+
+/************************************************************************/
+/*                       GWKCubicConvolve4Rows()                        */
+/*                                                                      */
+/*  Horizontal cubic convolution of 4 rows of 4 pixels.                 */
+/************************************************************************/
+
+template <class T>
+static CPL_INLINE void GWKCubicConvolve4Rows(const T *pSrc, GPtrDiff_t nStride,
+                                             const double adfCoeffs[4],
+                                             double adfOut[4])
+{
+    for (int i = 0; i < 4; i++)
+        adfOut[i] = CONVOL4(adfCoeffs, pSrc + i * nStride);
+}
+
+#ifdef USE_SSE2
+
+// Process 2 rows at a time: after transposition of the 2x4 values, each
+// lane of the registers accumulates one row, in the same order as CONVOL4(),
+// so that results are identical to the scalar code.
+template <class T>
+static CPL_INLINE void GWKCubicConvolve4RowsSSE2(const T *pSrc,
+                                                 GPtrDiff_t nStride,
+                                                 const double adfCoeffs[4],
+                                                 double adfOut[4])
+{
+    const auto xmmCoeff0 = XMMReg2Double::Set1(adfCoeffs[0]);
+    const auto xmmCoeff1 = XMMReg2Double::Set1(adfCoeffs[1]);
+    const auto xmmCoeff2 = XMMReg2Double::Set1(adfCoeffs[2]);
+    const auto xmmCoeff3 = XMMReg2Double::Set1(adfCoeffs[3]);
+    for (int i = 0; i < 4; i += 2)
+    {
+        XMMReg2Double xmmRow0Low, xmmRow0High, xmmRow1Low, xmmRow1High;
+        XMMReg2Double::Load4Val(pSrc + i * nStride, xmmRow0Low, xmmRow0High);
+        XMMReg2Double::Load4Val(pSrc + (i + 1) * nStride, xmmRow1Low,
+                                xmmRow1High);
+
+        XMMReg2Double xmmCol;
+        xmmCol.xmm = _mm_unpacklo_pd(xmmRow0Low.xmm, xmmRow1Low.xmm);
+        XMMReg2Double xmmAcc = xmmCoeff0 * xmmCol;
+        xmmCol.xmm = _mm_unpackhi_pd(xmmRow0Low.xmm, xmmRow1Low.xmm);
+        xmmAcc += xmmCoeff1 * xmmCol;
+        xmmCol.xmm = _mm_unpacklo_pd(xmmRow0High.xmm, xmmRow1High.xmm);
+        xmmAcc += xmmCoeff2 * xmmCol;
+        xmmCol.xmm = _mm_unpackhi_pd(xmmRow0High.xmm, xmmRow1High.xmm);
+        xmmAcc += xmmCoeff3 * xmmCol;
+        xmmAcc.Store2Val(adfOut + i);
+    }
+}
+
+template <>
+void GWKCubicConvolve4Rows<GByte>(const GByte *pSrc, GPtrDiff_t nStride,
+                                  const double adfCoeffs[4], double adfOut[4])
+{
+    GWKCubicConvolve4RowsSSE2(pSrc, nStride, adfCoeffs, adfOut);
+}
+
+template <>
+void GWKCubicConvolve4Rows<GInt16>(const GInt16 *pSrc, GPtrDiff_t nStride,
+                                   const double adfCoeffs[4], double adfOut[4])
+{
+    GWKCubicConvolve4RowsSSE2(pSrc, nStride, adfCoeffs, adfOut);
+}
+
+template <>
+void GWKCubicConvolve4Rows<GUInt16>(const GUInt16 *pSrc, GPtrDiff_t nStride,
+                                    const double adfCoeffs[4],
+                                    double adfOut[4])
+{
+    GWKCubicConvolve4RowsSSE2(pSrc, nStride, adfCoeffs, adfOut);
+}
+
+template <>
+void GWKCubicConvolve4Rows<float>(const float *pSrc, GPtrDiff_t nStride,
+                                  const double adfCoeffs[4], double adfOut[4])
+{
+    GWKCubicConvolve4RowsSSE2(pSrc, nStride, adfCoeffs, adfOut);
+}
+
+template <>
+void GWKCubicConvolve4Rows<double>(const double *pSrc, GPtrDiff_t nStride,
+                                   const double adfCoeffs[4], double adfOut[4])
+{
+    GWKCubicConvolve4RowsSSE2(pSrc, nStride, adfCoeffs, adfOut);
+}
+
+#endif  // USE_SSE2
+
+/************************************************************************/
+/*                    GWKCubicResample4SampleRealT()                    */
+/*                                                                      */
+/*  Same as GWKCubicResample4Sample(), specialized for a real data      */
+/*  type, for sources with validity masks.                              */
+/************************************************************************/
+
+template <class T>
+static bool GWKCubicResample4SampleRealT(const GDALWarpKernel *poWK, int iBand,
+                                         double dfSrcX, double dfSrcY,
+                                         double *pdfDensity, double *pdfReal)
+
+{
+    const int iSrcX = static_cast<int>(dfSrcX - 0.5);
+    const int iSrcY = static_cast<int>(dfSrcY - 0.5);
+    const GPtrDiff_t nSrcXSize = poWK->nSrcXSize;
+
+    // Get the bilinear interpolation at the image borders.
+    if (iSrcX - 1 < 0 || iSrcX + 2 >= poWK->nSrcXSize || iSrcY - 1 < 0 ||
+        iSrcY + 2 >= poWK->nSrcYSize)
+    {
+        return GWKBilinearResample4SampleRealT<T>(poWK, iBand, dfSrcX, dfSrcY,
+                                                  pdfDensity, pdfReal);
+    }
+
+    const GPtrDiff_t iFirstOffset =
+        iSrcX - 1 + static_cast<GPtrDiff_t>(iSrcY - 1) * nSrcXSize;
+    const GUInt32 *panBandSrcValid = poWK->papanBandSrcValid != nullptr
+                                         ? poWK->papanBandSrcValid[iBand]
+                                         : nullptr;
+    const float *pafSrcDensity = poWK->pafUnifiedSrcDensity;
+
+    /* -------------------------------------------------------------------- */
+    /*      For now, if we have any pixels missing in the kernel area,      */
+    /*      we fallback on using bilinear interpolation.                    */
+    /* -------------------------------------------------------------------- */
+    for (int i = 0; i < 4; i++)
+    {
+        const GPtrDiff_t iOffset = iFirstOffset + i * nSrcXSize;
+        if ((poWK->panUnifiedSrcValid != nullptr &&
+             GWKMaskGet4(poWK->panUnifiedSrcValid, iOffset) != 0xf) ||
+            (panBandSrcValid != nullptr &&
+             GWKMaskGet4(panBandSrcValid, iOffset) != 0xf) ||
+            (pafSrcDensity != nullptr &&
+             (double(pafSrcDensity[iOffset + 0]) <
+                  SRC_DENSITY_THRESHOLD_DOUBLE ||
+              double(pafSrcDensity[iOffset + 1]) <
+                  SRC_DENSITY_THRESHOLD_DOUBLE ||
+              double(pafSrcDensity[iOffset + 2]) <
+                  SRC_DENSITY_THRESHOLD_DOUBLE ||
+              double(pafSrcDensity[iOffset + 3]) <
+                  SRC_DENSITY_THRESHOLD_DOUBLE)))
+        {
+            return GWKBilinearResample4SampleRealT<T>(
+                poWK, iBand, dfSrcX, dfSrcY, pdfDensity, pdfReal);
+        }
+    }
+
+    const double dfDeltaX = dfSrcX - 0.5 - iSrcX;
+    const double dfDeltaY = dfSrcY - 0.5 - iSrcY;
+
+    double adfCoeffsX[4] = {};
+    GWKCubicComputeWeights(dfDeltaX, adfCoeffsX);
+
+    double adfValueReal[4] = {};
+    GWKCubicConvolve4Rows(
+        reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]) +
+            iFirstOffset,
+        nSrcXSize, adfCoeffsX, adfValueReal);
+
+    double adfValueDens[4] = {};
+    if (pafSrcDensity != nullptr)
+    {
+        GWKCubicConvolve4Rows(pafSrcDensity + iFirstOffset, nSrcXSize,
+                              adfCoeffsX, adfValueDens);
+    }
+    else
+    {
+        constexpr double adfOnes[4] = {1.0, 1.0, 1.0, 1.0};
+        const double dfRowDensity = CONVOL4(adfCoeffsX, adfOnes);
+        for (int i = 0; i < 4; i++)
+            adfValueDens[i] = dfRowDensity;
+    }
+
+    double adfCoeffsY[4] = {};
+    GWKCubicComputeWeights(dfDeltaY, adfCoeffsY);
+
+    *pdfDensity = CONVOL4(adfCoeffsY, adfValueDens);
+    *pdfReal = CONVOL4(adfCoeffsY, adfValueReal);
+
+    return true;
+}
+
 template <class T>
 static bool GWKCubicResampleNoMasks4SampleT(const GDALWarpKernel *poWK,
                                             int iBand, double dfSrcX,
@@ -5881,6 +6218,62 @@ static void GWKRealCaseThread(void *pData)
                                    poWK->papanBandSrcValid == nullptr &&
                                    poWK->pafUnifiedSrcDensity != nullptr;
 
+    // Versions of GWKBilinearResample4Sample() and GWKCubicResample4Sample()
+    // specialized for the working data type.
+    using GWKResample4SampleRealFunc =
+        bool (*)(const GDALWarpKernel *poWK, int iBand, double dfSrcX,
+                 double dfSrcY, double *pdfDensity, double *pdfReal);
+    GWKResample4SampleRealFunc pfnBilinearResample4SampleReal = nullptr;
+    GWKResample4SampleRealFunc pfnCubicResample4SampleReal = nullptr;
+    switch (poWK->eWorkingDataType)
+    {
+        case GDT_UInt8:
+            pfnBilinearResample4SampleReal =
+                GWKBilinearResample4SampleRealT<GByte>;
+            pfnCubicResample4SampleReal = GWKCubicResample4SampleRealT<GByte>;
+            break;
+        case GDT_Int8:
+            pfnBilinearResample4SampleReal =
+                GWKBilinearResample4SampleRealT<GInt8>;
+            pfnCubicResample4SampleReal = GWKCubicResample4SampleRealT<GInt8>;
+            break;
+        case GDT_Int16:
+            pfnBilinearResample4SampleReal =
+                GWKBilinearResample4SampleRealT<GInt16>;
+            pfnCubicResample4SampleReal = GWKCubicResample4SampleRealT<GInt16>;
+            break;
+        case GDT_UInt16:
+            pfnBilinearResample4SampleReal =
+                GWKBilinearResample4SampleRealT<GUInt16>;
+            pfnCubicResample4SampleReal =
+                GWKCubicResample4SampleRealT<GUInt16>;
+            break;
+        case GDT_Int32:
+            pfnBilinearResample4SampleReal =
+                GWKBilinearResample4SampleRealT<GInt32>;
+            pfnCubicResample4SampleReal = GWKCubicResample4SampleRealT<GInt32>;
+            break;
+        case GDT_UInt32:
+            pfnBilinearResample4SampleReal =
+                GWKBilinearResample4SampleRealT<GUInt32>;
+            pfnCubicResample4SampleReal =
+                GWKCubicResample4SampleRealT<GUInt32>;
+            break;
+        case GDT_Float32:
+            pfnBilinearResample4SampleReal =
+                GWKBilinearResample4SampleRealT<float>;
+            pfnCubicResample4SampleReal = GWKCubicResample4SampleRealT<float>;
+            break;
+        case GDT_Float64:
+            pfnBilinearResample4SampleReal =
+                GWKBilinearResample4SampleRealT<double>;
+            pfnCubicResample4SampleReal = GWKCubicResample4SampleRealT<double>;
+            break;
+        default:
+            // Other types go through the generic code.
+            break;
+    }
+
     const bool bOneSourceCornerFailsToReproject =
         GWKOneSourceCornerFailsToReproject(psJob);
 
@@ -6008,11 +6401,21 @@ static void GWKRealCaseThread(void *pData)
                 }
                 else if (poWK->eResample == GRA_Bilinear && bUse4SamplesFormula)
                 {
-                    double dfValueImagIgnored = 0.0;
-                    GWKBilinearResample4Sample(
-                        poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
-                        padfY[iDstX] - poWK->nSrcYOff, &dfBandDensity,
-                        &dfValueReal, &dfValueImagIgnored);
+                    if (pfnBilinearResample4SampleReal)
+                    {
+                        pfnBilinearResample4SampleReal(
+                            poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
+                            padfY[iDstX] - poWK->nSrcYOff, &dfBandDensity,
+                            &dfValueReal);
+                    }
+                    else
+                    {
+                        double dfValueImagIgnored = 0.0;
+                        GWKBilinearResample4Sample(
+                            poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
+                            padfY[iDstX] - poWK->nSrcYOff, &dfBandDensity,
+                            &dfValueReal, &dfValueImagIgnored);
+                    }
                 }
                 else if (poWK->eResample == GRA_Cubic && bUse4SamplesFormula)
                 {
@@ -6041,6 +6444,13 @@ static void GWKRealCaseThread(void *pData)
                                 &dfValueReal);
                         }
                     }
+                    else if (pfnCubicResample4SampleReal)
+                    {
+                        pfnCubicResample4SampleReal(
+                            poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
+                            padfY[iDstX] - poWK->nSrcYOff, &dfBandDensity,
+                            &dfValueReal);
+                    }
                     else
                     {
                         double dfValueImagIgnored = 0.0;
@@ -680,6 +680,26 @@ GDALWarpOperation::Initialize(const GDALWarpOptions *psNewOptions,
     }
     else
     {
+        /* --------------------------------------------------------------------
+         */
+        /*      Optionally enable a grid of exactly transformed points over */
+        /*      the whole target raster, lazily built and shared by all */
+        /*      chunks and threads. */
+        /* --------------------------------------------------------------------
+         */
+        if (psOptions->hDstDS != nullptr &&
+            CPLFetchBool(psOptions->papszWarpOptions, "APPROX_GRID", false) &&
+            GDALIsTransformer(psOptions->pTransformerArg,
+                              GDAL_APPROX_TRANSFORMER_CLASS_NAME))
+        {
+            const double dfStep = CPLAtof(CSLFetchNameValueDef(
+                psOptions->papszWarpOptions, "APPROX_GRID_STEP", "32"));
+            GDALApproxTransformerEnableGrid(
+                psOptions->pTransformerArg, TRUE, 0, 0,
+                GDALGetRasterXSize(psOptions->hDstDS),
+                GDALGetRasterYSize(psOptions->hDstDS), dfStep);
+        }
+
         psThreadData = GWKThreadsCreate(psOptions->papszWarpOptions,
                                         psOptions->pfnTransformer,
                                         psOptions->pTransformerArg);
@@ -1117,10 +1137,69 @@ CPLErr GDALChunkAndWarpImage(GDALWarpOperationH hOperation, int nDstXOff,
         ->ChunkAndWarpImage(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
 }
 
+/************************************************************************/
+/*                         GetChunksInFlight()                          */
+/************************************************************************/
+
+// Number of chunks that ChunkAndWarpMulti() may process concurrently,
+// from the NUM_CHUNKS_IN_FLIGHT warp option.
+int GDALWarpOperation::GetChunksInFlight() const
+{
+    const char *pszValue =
+        CSLFetchNameValue(psOptions->papszWarpOptions, "NUM_CHUNKS_IN_FLIGHT");
+    if (pszValue == nullptr)
+        return 2;
+    const int nValue =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    if (nValue < 2)
+    {
+        CPLError(CE_Warning, CPLE_IllegalArg,
+                 "Invalid value for NUM_CHUNKS_IN_FLIGHT: %s. Using 2",
+                 pszValue);
+        return 2;
+    }
+    constexpr int MAX_CHUNKS_IN_FLIGHT = 128;
+    return std::min(nValue, MAX_CHUNKS_IN_FLIGHT);
+}
+
 /************************************************************************/
 /*                          ChunkThreadMain()                           */
 /************************************************************************/
 
+// Resources owned by a chunk slot when several chunks are warped
+// concurrently: the kernel of a slot must not share its transformer nor its
+// thread data with the kernels of other slots.
+struct GDALWarpChunkContext
+{
+    void *pTransformerArg = nullptr;
+    void *psThreadData = nullptr;
+    GDALProgressFunc pfnProgress = nullptr;
+    void *pProgressArg = nullptr;
+};
+
+namespace
+{
+// Serializes and keeps monotonic the progress reported by the kernels of
+// concurrently warped chunks.
+struct ChunkProgressData
+{
+    std::mutex oMutex{};
+    double dfLastComplete = 0;
+    GDALProgressFunc pfnProgress = nullptr;
+    void *pProgressArg = nullptr;
+};
+}  // namespace
+
+static int CPL_STDCALL ChunkProgress(double dfComplete, const char *pszMessage,
+                                     void *pProgressArg)
+{
+    auto psData = static_cast<ChunkProgressData *>(pProgressArg);
+    std::lock_guard<std::mutex> oLock(psData->oMutex);
+    psData->dfLastComplete = std::max(psData->dfLastComplete, dfComplete);
+    return psData->pfnProgress(psData->dfLastComplete, pszMessage,
+                               psData->pProgressArg);
+}
+
 struct ChunkThreadData
 {
     GDALWarpOperation *poOperation = nullptr;
@@ -1136,9 +1215,11 @@ struct ChunkThreadData
     CPLCond *hCond = nullptr;
 
     CPLErrorAccumulator *poErrorAccumulator = nullptr;
+
+    const GDALWarpChunkContext *psContext = nullptr;
 };
 
-static void ChunkThreadMain(void *pThreadData)
+void GDALWarpOperation::ChunkThreadMain(void *pThreadData)
 
 {
     volatile ChunkThreadData *psData =
@@ -1169,12 +1250,12 @@ static void ChunkThreadMain(void *pThreadData)
             psData->poErrorAccumulator->InstallForCurrentScope();
         CPL_IGNORE_RET_VAL(oAccumulator);
 
-        psData->eErr = psData->poOperation->WarpRegion(
+        psData->eErr = psData->poOperation->WarpRegionInternal(
             pasChunkInfo->dx, pasChunkInfo->dy, pasChunkInfo->dsx,
             pasChunkInfo->dsy, pasChunkInfo->sx, pasChunkInfo->sy,
             pasChunkInfo->ssx, pasChunkInfo->ssy, pasChunkInfo->sExtraSx,
             pasChunkInfo->sExtraSy, psData->dfProgressBase,
-            psData->dfProgressScale);
+            psData->dfProgressScale, psData->psContext);
 
         /* --------------------------------------------------------------------
          */
@@ -1201,6 +1282,13 @@ static void ChunkThreadMain(void *pThreadData)
  * internally this method uses multiple threads to interleave input/output
  * for one region while the processing is being done for another.
  *
+ * By default, two chunks are in flight: input/output of one chunk is
+ * overlapped with the warping of the other one. The NUM_CHUNKS_IN_FLIGHT
+ * warp option (since GDAL 3.14) may be set to a larger value so that
+ * several chunks are warped concurrently, each one with its own copy of the
+ * transformer. Input/output remain serialized. Memory usage may then reach
+ * NUM_CHUNKS_IN_FLIGHT times the warp memory limit.
+ *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
  * @param nDstXSize Width of output window on destination file to be produced.
@@ -1228,26 +1316,92 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     /* -------------------------------------------------------------------- */
     CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
 
+    /* -------------------------------------------------------------------- */
+    /*      When more than two chunks are in flight, give each slot its     */
+    /*      own transformer and kernel thread data, so that kernels can     */
+    /*      run concurrently. Otherwise the warp mutex serializes them.     */
+    /* -------------------------------------------------------------------- */
+    const int nSlots =
+        std::min(GetChunksInFlight(), std::max(2, nChunkListCount));
+    std::vector<GDALWarpChunkContext> asContexts;
+    ChunkProgressData sProgressData;
+    sProgressData.pfnProgress = psOptions->pfnProgress;
+    sProgressData.pProgressArg = psOptions->pProgressArg;
+    if (nSlots > 2)
+    {
+        asContexts.resize(nSlots);
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        for (auto &sContext : asContexts)
+        {
+            sContext.pTransformerArg =
+                GDALCloneTransformer(psOptions->pTransformerArg);
+            if (sContext.pTransformerArg == nullptr)
+                break;
+            sContext.psThreadData =
+                GWKThreadsCreate(psOptions->papszWarpOptions,
+                                 psOptions->pfnTransformer,
+                                 sContext.pTransformerArg);
+            sContext.pfnProgress = ChunkProgress;
+            sContext.pProgressArg = &sProgressData;
+        }
+        if (asContexts.back().psThreadData == nullptr)
+        {
+            CPLDebug("WARP", "Cannot clone transformer. Warping chunks "
+                             "sequentially");
+            for (auto &sContext : asContexts)
+            {
+                if (sContext.psThreadData)
+                    GWKThreadsEnd(sContext.psThreadData);
+                if (sContext.pTransformerArg)
+                    GDALDestroyTransformer(sContext.pTransformerArg);
+            }
+            asContexts.clear();
+        }
+    }
+    const int nThreads = asContexts.empty() ? 2 : nSlots;
+
     /* -------------------------------------------------------------------- */
     /*      Process them one at a time, updating the progress               */
     /*      information for each region.                                    */
     /* -------------------------------------------------------------------- */
-    ChunkThreadData volatile asThreadData[2] = {};
+    std::vector<ChunkThreadData> asThreadData(nThreads);
     CPLErrorAccumulator oErrorAccumulator;
-    for (int i = 0; i < 2; ++i)
+    for (int i = 0; i < nThreads; ++i)
     {
         asThreadData[i].poOperation = this;
         asThreadData[i].hIOMutex = hIOMutex;
         asThreadData[i].poErrorAccumulator = &oErrorAccumulator;
+        if (!asContexts.empty())
+            asThreadData[i].psContext = &asContexts[i];
     }
 
     double dfPixelsProcessed = 0.0;
     double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
 
     CPLErr eErr = CE_None;
-    for (int iChunk = 0; iChunk < nChunkListCount + 1; iChunk++)
+    for (int iChunk = 0; iChunk < nChunkListCount + nThreads; iChunk++)
     {
-        int iThread = iChunk % 2;
+        int iThread = iChunk % nThreads;
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Wait for the thread of the chunk that previously used this */
+        /*      slot to complete. */
+        /* --------------------------------------------------------------------
+         */
+        if (asThreadData[iThread].hThreadHandle != nullptr)
+        {
+            CPLJoinThread(asThreadData[iThread].hThreadHandle);
+            asThreadData[iThread].hThreadHandle = nullptr;
+
+            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk - nThreads,
+                     nChunkListCount);
+
+            eErr = asThreadData[iThread].eErr;
+
+            if (eErr != CE_None)
+                break;
+        }
 
         /* --------------------------------------------------------------------
          */
@@ -1283,8 +1437,7 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
 
             CPLDebug("GDAL", "Start chunk %d / %d.", iChunk, nChunkListCount);
             asThreadData[iThread].hThreadHandle = CPLCreateJoinableThread(
-                ChunkThreadMain,
-                const_cast<ChunkThreadData *>(&asThreadData[iThread]));
+                ChunkThreadMain, &asThreadData[iThread]);
             if (asThreadData[iThread].hThreadHandle == nullptr)
             {
                 CPLError(
@@ -1305,37 +1458,21 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
                 CPLReleaseMutex(hCondMutex);
             }
         }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Wait for previous chunks thread to complete. */
-        /* --------------------------------------------------------------------
-         */
-        if (iChunk > 0)
-        {
-            iThread = (iChunk - 1) % 2;
-
-            // Wait for thread to finish.
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
-            asThreadData[iThread].hThreadHandle = nullptr;
-
-            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk - 1,
-                     nChunkListCount);
-
-            eErr = asThreadData[iThread].eErr;
-
-            if (eErr != CE_None)
-                break;
-        }
     }
 
     /* -------------------------------------------------------------------- */
     /*      Wait for all threads to complete.                               */
     /* -------------------------------------------------------------------- */
-    for (int iThread = 0; iThread < 2; iThread++)
+    for (auto &sThreadData : asThreadData)
     {
-        if (asThreadData[iThread].hThreadHandle)
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
+        if (sThreadData.hThreadHandle)
+            CPLJoinThread(sThreadData.hThreadHandle);
+    }
+
+    for (auto &sContext : asContexts)
+    {
+        GWKThreadsEnd(sContext.psThreadData);
+        GDALDestroyTransformer(sContext.pTransformerArg);
     }
 
     CPLDestroyCond(hCond);
@@ -1728,6 +1865,26 @@ CPLErr GDALWarpOperation::WarpRegion(
     int nSrcYOff, int nSrcXSize, int nSrcYSize, double dfSrcXExtraSize,
     double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale)
 
+{
+    return WarpRegionInternal(nDstXOff, nDstYOff, nDstXSize, nDstYSize,
+                              nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize,
+                              dfSrcXExtraSize, dfSrcYExtraSize, dfProgressBase,
+                              dfProgressScale, nullptr);
+}
+
+/************************************************************************/
+/*                         WarpRegionInternal()                         */
+/************************************************************************/
+
+// psContext, when not null, provides the transformer, kernel thread data and
+// progress callback to use instead of the ones of the operation, so that
+// several chunks can be warped concurrently by ChunkAndWarpMulti().
+CPLErr GDALWarpOperation::WarpRegionInternal(
+    int nDstXOff, int nDstYOff, int nDstXSize, int nDstYSize, int nSrcXOff,
+    int nSrcYOff, int nSrcXSize, int nSrcYSize, double dfSrcXExtraSize,
+    double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale,
+    const GDALWarpChunkContext *psContext)
+
 {
     ReportTiming(nullptr);
 
@@ -1782,11 +1939,12 @@ CPLErr GDALWarpOperation::WarpRegion(
     /* -------------------------------------------------------------------- */
     CPLErr eErr = nSrcXSize == 0
                       ? CE_None
-                      : WarpRegionToBuffer(
+                      : WarpRegionToBufferInternal(
                             nDstXOff, nDstYOff, nDstXSize, nDstYSize,
                             pDstBuffer, psOptions->eWorkingDataType, nSrcXOff,
                             nSrcYOff, nSrcXSize, nSrcYSize, dfSrcXExtraSize,
-                            dfSrcYExtraSize, dfProgressBase, dfProgressScale);
+                            dfSrcYExtraSize, dfProgressBase, dfProgressScale,
+                            psContext);
 
     /* -------------------------------------------------------------------- */
     /*      Write the output data back to disk if all went well.            */
@@ -1928,11 +2086,29 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
  */
 
 CPLErr GDALWarpOperation::WarpRegionToBuffer(
+    int nDstXOff, int nDstYOff, int nDstXSize, int nDstYSize, void *pDataBuf,
+    GDALDataType eBufDataType, int nSrcXOff, int nSrcYOff, int nSrcXSize,
+    int nSrcYSize, double dfSrcXExtraSize, double dfSrcYExtraSize,
+    double dfProgressBase, double dfProgressScale)
+
+{
+    return WarpRegionToBufferInternal(
+        nDstXOff, nDstYOff, nDstXSize, nDstYSize, pDataBuf, eBufDataType,
+        nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize, dfSrcXExtraSize,
+        dfSrcYExtraSize, dfProgressBase, dfProgressScale, nullptr);
+}
+
+/************************************************************************/
+/*                     WarpRegionToBufferInternal()                     */
+/************************************************************************/
+
+CPLErr GDALWarpOperation::WarpRegionToBufferInternal(
     int nDstXOff, int nDstYOff, int nDstXSize, int nDstYSize, void *pDataBuf,
     // Only in a CPLAssert.
     CPL_UNUSED GDALDataType eBufDataType, int nSrcXOff, int nSrcYOff,
     int nSrcXSize, int nSrcYSize, double dfSrcXExtraSize,
-    double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale)
+    double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale,
+    const GDALWarpChunkContext *psContext)
 
 {
     const int nWordSize = GDALGetDataTypeSizeBytes(psOptions->eWorkingDataType);
@@ -1982,15 +2158,17 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     oWK.eWorkingDataType = psOptions->eWorkingDataType;
 
     oWK.pfnTransformer = psOptions->pfnTransformer;
-    oWK.pTransformerArg = psOptions->pTransformerArg;
+    oWK.pTransformerArg =
+        psContext ? psContext->pTransformerArg : psOptions->pTransformerArg;
 
-    oWK.pfnProgress = psOptions->pfnProgress;
-    oWK.pProgress = psOptions->pProgressArg;
+    oWK.pfnProgress =
+        psContext ? psContext->pfnProgress : psOptions->pfnProgress;
+    oWK.pProgress = psContext ? psContext->pProgressArg : psOptions->pProgressArg;
     oWK.dfProgressBase = dfProgressBase;
     oWK.dfProgressScale = dfProgressScale;
 
     oWK.papszWarpOptions = psOptions->papszWarpOptions;
-    oWK.psThreadData = psThreadData;
+    oWK.psThreadData = psContext ? psContext->psThreadData : psThreadData;
 
     oWK.padfDstNoDataReal = psOptions->padfDstNoDataReal;
 
@@ -2388,12 +2566,13 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     }
 
     /* -------------------------------------------------------------------- */
-    /*      Release IO Mutex, and acquire warper mutex.                     */
+    /*      Release IO Mutex, and acquire warper mutex, unless this chunk   */
+    /*      has its own transformer and kernel thread data.                 */
     /* -------------------------------------------------------------------- */
     if (hIOMutex != nullptr)
     {
         CPLReleaseMutex(hIOMutex);
-        if (!CPLAcquireMutex(hWarpMutex, 600.0))
+        if (psContext == nullptr && !CPLAcquireMutex(hWarpMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Failed to acquire WarpMutex in WarpRegion().");
@@ -2429,7 +2608,8 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (hIOMutex != nullptr)
     {
-        CPLReleaseMutex(hWarpMutex);
+        if (psContext == nullptr)
+            CPLReleaseMutex(hWarpMutex);
         if (!CPLAcquireMutex(hIOMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
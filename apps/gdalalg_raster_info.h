@@ -52,6 +52,7 @@ class GDALRasterInfoAlgorithm /* non final */
     bool m_noMask = false;
     bool m_noNodata = false;
     bool m_checksum = false;
+    bool m_cacheStats = false;
     bool m_listMDD = false;
     std::string m_mdd{};
     int m_subDS = 0;
@@ -90,6 +90,10 @@ struct GDALInfoOptions
     /*! force computation of the checksum for each band in the dataset */
     bool bComputeChecksum = false;
 
+    /*! report statistics on the blocks of the dataset in the global raster
+        block cache */
+    bool bReportCacheStats = false;
+
     /*! allow or suppress printing of nodata value */
     bool bShowNodata = true;
 
@@ -303,6 +307,12 @@ GDALInfoAppOptionsGetParser(GDALInfoOptions *psOptions,
         .help(_(
             "Force computation of the checksum for each band in the dataset."));
 
+    argParser->add_argument("-cache_stats")
+        .flag()
+        .store_into(psOptions->bReportCacheStats)
+        .help(_("Report statistics on the blocks of the dataset in the raster "
+                "block cache."));
+
     argParser->add_argument("-listmdd")
         .flag()
         .store_into(psOptions->bListMDD)
@@ -2161,6 +2171,43 @@ char *GDALInfo(GDALDatasetH hDataset, const GDALInfoOptions *psOptions)
         }
     }
 
+    if (psOptions->bReportCacheStats)
+    {
+        GIntBig nCacheUsed = 0;
+        GIntBig nDirtyBytes = 0;
+        GUIntBig nHits = 0;
+        GUIntBig nMisses = 0;
+        GUIntBig nEvictions = 0;
+        GDALDatasetGetCacheStatistics(hDataset, &nCacheUsed, &nDirtyBytes,
+                                      &nHits, &nMisses, &nEvictions);
+        if (bJson)
+        {
+            json_object *poCacheStats = json_object_new_object();
+            json_object_object_add(poCacheStats, "used",
+                                   json_object_new_int64(nCacheUsed));
+            json_object_object_add(poCacheStats, "dirty",
+                                   json_object_new_int64(nDirtyBytes));
+            json_object_object_add(
+                poCacheStats, "hits",
+                json_object_new_int64(static_cast<GIntBig>(nHits)));
+            json_object_object_add(
+                poCacheStats, "misses",
+                json_object_new_int64(static_cast<GIntBig>(nMisses)));
+            json_object_object_add(
+                poCacheStats, "evictions",
+                json_object_new_int64(static_cast<GIntBig>(nEvictions)));
+            json_object_object_add(poJsonObject, "blockCache", poCacheStats);
+        }
+        else
+        {
+            Concat(osStr, psOptions->bStdoutOutput,
+                   "Block cache: used=" CPL_FRMT_GIB
+                   " bytes, dirty=" CPL_FRMT_GIB " bytes, hits=" CPL_FRMT_GUIB
+                   ", misses=" CPL_FRMT_GUIB ", evictions=" CPL_FRMT_GUIB "\n",
+                   nCacheUsed, nDirtyBytes, nHits, nMisses, nEvictions);
+        }
+    }
+
     if (bJson)
     {
         json_object_object_add(poJsonObject, "bands", poBands);
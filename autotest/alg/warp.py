@@ -2341,3 +2341,135 @@ def test_warp_int8_nearest():
     src_ds = gdal.Open("../gdrivers/data/gtiff/int8.tif")
     warped_ds = gdal.Warp("", src_ds, format="MEM")
     assert warped_ds.ReadRaster() == src_ds.ReadRaster()
+
+
+###############################################################################
+# Test that the type-specialized bilinear and cubic kernels used with source
+# validity masks give the same result as the general case
+
+
+@pytest.mark.parametrize(
+    "typestr", ("Byte", "Int8", "Int16", "UInt16", "Int32", "Float32", "Float64")
+)
+@pytest.mark.parametrize("alg_name", ("bilinear", "cubic"))
+@pytest.mark.parametrize("with_alpha", (False, True))
+def test_warp_masked_bilinear_cubic_same_as_general_case(
+    typestr, alg_name, with_alpha
+):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gcore/data/byte.tif",
+        options=f"-of MEM -b 1 -b 1 -ot {typestr} -scale 0 255 0 100",
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    src_ds.GetRasterBand(1).WriteRaster(
+        5, 5, 3, 2, b"\x00" * 6, buf_type=gdal.GDT_UInt8
+    )
+    src_ds.GetRasterBand(1).WriteRaster(
+        12, 17, 1, 1, b"\x00", buf_type=gdal.GDT_UInt8
+    )
+    src_ds.GetRasterBand(2).SetColorInterpretation(gdal.GCI_AlphaBand)
+    src_ds.GetRasterBand(2).Fill(255)
+    src_ds.GetRasterBand(2).WriteRaster(
+        10, 10, 2, 1, b"\x00\x80", buf_type=gdal.GDT_UInt8
+    )
+
+    options = f"-of MEM -r {alg_name} -ts 47 43"
+    if not with_alpha:
+        options += " -b 1"
+    ref_ds = gdal.Warp("", src_ds, options=options + " -wo USE_GENERAL_CASE=TRUE")
+    got_ds = gdal.Warp("", src_ds, options=options)
+    assert got_ds.ReadRaster() == ref_ds.ReadRaster()
+
+
+###############################################################################
+# Test that warping several chunks concurrently with NUM_CHUNKS_IN_FLIGHT
+# gives the same result as the default multithreaded warping
+
+
+@pytest.mark.parametrize("num_chunks_in_flight", ("3", "8", "ALL_CPUS"))
+def test_warp_multi_num_chunks_in_flight(num_chunks_in_flight):
+
+    options = "-of MEM -t_srs EPSG:4326 -r cubic -ts 200 200 -multi -wm 20000"
+    ref_ds = gdal.Warp("", "../gcore/data/byte.tif", options=options)
+
+    tab_pct = [0]
+
+    def callback(pct, message, user_data):
+        assert pct >= tab_pct[0]
+        tab_pct[0] = pct
+        return 1
+
+    got_ds = gdal.Warp(
+        "",
+        "../gcore/data/byte.tif",
+        options=options
+        + f" -wo NUM_CHUNKS_IN_FLIGHT={num_chunks_in_flight} -wo NUM_THREADS=2",
+        callback=callback,
+    )
+    assert tab_pct[0] == 1.0
+    assert got_ds.ReadRaster() == ref_ds.ReadRaster()
+
+
+###############################################################################
+# Test APPROX_GRID warping option
+
+
+def test_warp_approx_grid():
+
+    options = "-of MEM -t_srs EPSG:4326 -r bilinear -ts 200 200"
+    ref_ds = gdal.Warp("", "../gcore/data/byte.tif", options=options + " -et 0")
+
+    messages = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug:
+            messages.append(msg)
+
+    with gdaltest.config_option("CPL_DEBUG", "ON"), gdaltest.error_handler(
+        my_handler
+    ):
+        got_ds = gdal.Warp(
+            "",
+            "../gcore/data/byte.tif",
+            options=options
+            + " -et 0.125 -wo APPROX_GRID=YES -wo APPROX_GRID_STEP=16 -wm 20000",
+        )
+    assert any(
+        msg.startswith("GDAL: Approximate transformer grid: 14 x 14 nodes")
+        for msg in messages
+    ), messages
+    # Same order of magnitude as the error of the default approximation
+    approx_ds = gdal.Warp(
+        "", "../gcore/data/byte.tif", options=options + " -et 0.125 -wm 20000"
+    )
+    assert gdaltest.compare_ds(got_ds, ref_ds) <= max(
+        2, 2 * gdaltest.compare_ds(approx_ds, ref_ds)
+    )
+
+
+###############################################################################
+# Test that APPROX_GRID is not used when CHECK_WITH_INVERT_PROJ is set
+
+
+def test_warp_approx_grid_check_with_invert_proj():
+
+    messages = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug:
+            messages.append(msg)
+
+    with gdaltest.config_options(
+        {"CPL_DEBUG": "ON", "CHECK_WITH_INVERT_PROJ": "YES"}
+    ), gdaltest.error_handler(my_handler):
+        gdal.Warp(
+            "",
+            "../gcore/data/byte.tif",
+            options="-of MEM -t_srs EPSG:4326 -ts 200 200 -et 0.125 "
+            "-wo APPROX_GRID=YES -wo APPROX_GRID_STEP=16",
+        )
+    assert not any(
+        msg.startswith("GDAL: Approximate transformer grid") for msg in messages
+    ), messages
@@ -25,8 +25,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <limits>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "test_data.h"
 
@@ -6599,4 +6602,343 @@ TEST_F(test_gdal, GDALLoadEsriCLRAsRAT)
     ASSERT_EQ(poRAT->GetValueAsInt(24, 3), 47);
 }
 
+// Test the hash set band block cache with enough blocks to trigger resizing
+// of its table, and evictions from the global block cache.
+TEST_F(test_gdal, hashset_band_block_cache)
+{
+    GDALDriver *poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+        GTEST_SKIP() << "GTiff driver missing";
+
+    CPLConfigOptionSetter oSetter("GDAL_BAND_BLOCK_CACHE", "HASHSET", false);
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    const char *const apszOptions[] = {"TILED=YES", "BLOCKXSIZE=16",
+                                       "BLOCKYSIZE=16", nullptr};
+    const char *pszFilename = "/vsimem/hashset_band_block_cache.tif";
+    constexpr int SIZE = 1024;
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(poGTiffDrv->Create(
+            pszFilename, SIZE, SIZE, 1, GDT_Byte, apszOptions));
+        ASSERT_NE(poDS, nullptr);
+        // Room for about 1000 blocks out of 4096
+        GDALSetCacheMax64(1000 * (16 * 16 + 2 * sizeof(GDALRasterBlock)));
+        auto poBand = poDS->GetRasterBand(1);
+        for (int nYBlock = 0; nYBlock < SIZE / 16; ++nYBlock)
+        {
+            for (int nXBlock = 0; nXBlock < SIZE / 16; ++nXBlock)
+            {
+                GDALRasterBlock *poBlock =
+                    poBand->GetLockedBlockRef(nXBlock, nYBlock, TRUE);
+                ASSERT_NE(poBlock, nullptr);
+                memset(poBlock->GetDataRef(),
+                       static_cast<GByte>(nXBlock + nYBlock), 16 * 16);
+                poBlock->MarkDirty();
+                poBlock->DropLock();
+            }
+        }
+        // Re-acquire blocks, some being still in cache, others having been
+        // evicted
+        for (int nYBlock = SIZE / 16 - 1; nYBlock >= 0; --nYBlock)
+        {
+            for (int nXBlock = 0; nXBlock < SIZE / 16; ++nXBlock)
+            {
+                GDALRasterBlock *poBlock =
+                    poBand->GetLockedBlockRef(nXBlock, nYBlock);
+                ASSERT_NE(poBlock, nullptr);
+                EXPECT_EQ(static_cast<GByte *>(poBlock->GetDataRef())[0],
+                          static_cast<GByte>(nXBlock + nYBlock));
+                poBlock->DropLock();
+            }
+        }
+        EXPECT_EQ(poBand->FlushBlock(1, 1), CE_None);
+        EXPECT_EQ(poDS->Close(), CE_None);
+    }
+    GDALSetCacheMax64(nOldCacheMax);
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+        ASSERT_NE(poDS, nullptr);
+        GByte nVal = 0;
+        EXPECT_EQ(poDS->GetRasterBand(1)->RasterIO(GF_Read, 16 * 63, 16 * 62,
+                                                   1, 1, &nVal, 1, 1, GDT_Byte,
+                                                   0, 0, nullptr),
+                  CE_None);
+        EXPECT_EQ(nVal, 63 + 62);
+    }
+    VSIUnlink(pszFilename);
+}
+
+// Test lock-free lookups in the hash set band block cache while another
+// thread resizes and resets its table.
+TEST_F(test_gdal, hashset_band_block_cache_concurrent_lookups)
+{
+    CPLConfigOptionSetter oSetter("GDAL_BAND_BLOCK_CACHE", "HASHSET", false);
+    constexpr int SIZE = 2048;
+    auto poDS = std::unique_ptr<GDALDataset>(
+        MEMDataset::Create("", 1, SIZE, 1, GDT_Byte, nullptr));
+    ASSERT_NE(poDS, nullptr);
+    auto poBand = poDS->GetRasterBand(1);
+    int nXBlockSize = 0;
+    int nYBlockSize = 0;
+    poBand->GetBlockSize(&nXBlockSize, &nYBlockSize);
+    ASSERT_EQ(nYBlockSize, 1);
+
+    // Blocks of the first half of the band are repeatedly loaded and
+    // flushed, while other threads look up blocks of the second half, which
+    // is never loaded, and thus probe through slots of the first half.
+    GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(0, 0, TRUE);
+    ASSERT_NE(poBlock, nullptr);
+    poBlock->DropLock();
+
+    std::atomic<bool> bStop{false};
+    std::atomic<int> nFound{0};
+    std::vector<std::thread> aoThreads;
+    for (int iThread = 0; iThread < 4; ++iThread)
+    {
+        aoThreads.emplace_back(
+            [poBand, &bStop, &nFound, iThread]()
+            {
+                int nYBlock = SIZE / 2 + iThread;
+                while (!bStop.load())
+                {
+                    GDALRasterBlock *poIter =
+                        poBand->TryGetLockedBlockRef(0, nYBlock);
+                    if (poIter)
+                    {
+                        ++nFound;
+                        poIter->DropLock();
+                    }
+                    nYBlock = SIZE / 2 + (nYBlock + 7) % (SIZE / 2);
+                }
+            });
+    }
+
+    for (int iIter = 0; iIter < 50; ++iIter)
+    {
+        for (int nYBlock = 0; nYBlock < SIZE / 2; ++nYBlock)
+        {
+            poBlock = poBand->GetLockedBlockRef(0, nYBlock, TRUE);
+            EXPECT_NE(poBlock, nullptr);
+            if (poBlock)
+                poBlock->DropLock();
+        }
+        EXPECT_EQ(poBand->FlushCache(false), CE_None);
+    }
+    bStop = true;
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    EXPECT_EQ(nFound.load(), 0);
+}
+
+// Test lock-free lookups of resident blocks in the hash set band block cache
+// while another thread evicts and flushes blocks of the same band.
+TEST_F(test_gdal, hashset_band_block_cache_lookups_during_evictions)
+{
+    CPLConfigOptionSetter oSetter("GDAL_BAND_BLOCK_CACHE", "HASHSET", false);
+    constexpr int XSIZE = 64;
+    constexpr int YSIZE = 4096;
+    constexpr int HOT_BLOCKS = 64;
+    auto poDS = std::unique_ptr<GDALDataset>(
+        MEMDataset::Create("", XSIZE, YSIZE, 1, GDT_Byte, nullptr));
+    ASSERT_NE(poDS, nullptr);
+    auto poBand = poDS->GetRasterBand(1);
+    int nXBlockSize = 0;
+    int nYBlockSize = 0;
+    poBand->GetBlockSize(&nXBlockSize, &nYBlockSize);
+    ASSERT_EQ(nXBlockSize, XSIZE);
+    ASSERT_EQ(nYBlockSize, 1);
+
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    // Room for about 256 blocks, so that loading the other blocks of the
+    // band evicts blocks from the cache.
+    GDALSetCacheMax64(256 * (XSIZE + 2 * sizeof(GDALRasterBlock)));
+
+    // Other threads look up the first HOT_BLOCKS blocks, which are kept
+    // resident by their lookups, while this thread loads the other blocks,
+    // which evicts blocks, and flushes blocks from the global cache and
+    // from the band. Blocks that lookups may have locked cannot be flushed
+    // from the band, so only the other blocks are.
+    std::atomic<bool> bStop{false};
+    std::atomic<int> nFound{0};
+    std::vector<std::thread> aoThreads;
+    for (int iThread = 0; iThread < 4; ++iThread)
+    {
+        aoThreads.emplace_back(
+            [poBand, &bStop, &nFound, iThread]()
+            {
+                int nYBlock = iThread;
+                while (!bStop.load())
+                {
+                    GDALRasterBlock *poIter =
+                        poBand->TryGetLockedBlockRef(0, nYBlock);
+                    if (poIter)
+                    {
+                        ++nFound;
+                        poIter->DropLock();
+                    }
+                    nYBlock = (nYBlock + 1) % HOT_BLOCKS;
+                }
+            });
+    }
+
+    for (int iIter = 0; iIter < 20; ++iIter)
+    {
+        for (int nYBlock = 0; nYBlock < YSIZE; ++nYBlock)
+        {
+            GDALRasterBlock *poBlock =
+                poBand->GetLockedBlockRef(0, nYBlock, TRUE);
+            EXPECT_NE(poBlock, nullptr);
+            if (poBlock)
+                poBlock->DropLock();
+            if (nYBlock % 256 == 255)
+            {
+                for (int nYHot = 0; nYHot < HOT_BLOCKS; ++nYHot)
+                {
+                    poBlock = poBand->GetLockedBlockRef(0, nYHot, TRUE);
+                    EXPECT_NE(poBlock, nullptr);
+                    if (poBlock)
+                        poBlock->DropLock();
+                }
+                for (int i = 0; i < 16; ++i)
+                    GDALFlushCacheBlock();
+                EXPECT_EQ(poBand->FlushBlock(0, nYBlock), CE_None);
+            }
+        }
+    }
+    bStop = true;
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    EXPECT_GT(nFound.load(), 0);
+
+    poDS.reset();
+    GDALSetCacheMax64(nOldCacheMax);
+}
+
+// Test GDALGetCacheStatistics()
+TEST_F(test_gdal, GDALGetCacheStatistics)
+{
+    GDALDriver *poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+        GTEST_SKIP() << "GTiff driver missing";
+
+    const char *pszFilename = "/vsimem/GDALGetCacheStatistics.tif";
+    auto poDS = std::unique_ptr<GDALDataset>(
+        poGTiffDrv->Create(pszFilename, 16, 16, 1, GDT_Byte, nullptr));
+    ASSERT_NE(poDS, nullptr);
+    auto poBand = poDS->GetRasterBand(1);
+
+    GUIntBig nHitsBefore = 0;
+    GUIntBig nMissesBefore = 0;
+    GUIntBig nEvictionsBefore = 0;
+    GDALGetCacheStatistics(&nHitsBefore, &nMissesBefore, &nEvictionsBefore);
+
+    GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(0, 0);
+    ASSERT_NE(poBlock, nullptr);
+    poBlock->DropLock();
+    poBlock = poBand->GetLockedBlockRef(0, 0);
+    ASSERT_NE(poBlock, nullptr);
+    poBlock->DropLock();
+
+    GUIntBig nHits = 0;
+    GUIntBig nMisses = 0;
+    GUIntBig nEvictions = 0;
+    GDALGetCacheStatistics(&nHits, &nMisses, &nEvictions);
+    EXPECT_GE(nHits, nHitsBefore + 1);
+    EXPECT_GE(nMisses, nMissesBefore + 1);
+    EXPECT_GE(nEvictions, nEvictionsBefore);
+
+    // Null pointers are accepted
+    GDALGetCacheStatistics(nullptr, nullptr, nullptr);
+
+    poDS.reset();
+    VSIUnlink(pszFilename);
+}
+
+// Test GDALDataset::SetCacheMax() and GDALDataset::GetCacheStatistics()
+TEST_F(test_gdal, GDALDataset_SetCacheMax)
+{
+    GDALDriver *poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+        GTEST_SKIP() << "GTiff driver missing";
+
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    GDALSetCacheMax64(std::max<GIntBig>(nOldCacheMax, 100 * 1024 * 1024));
+
+    const char *const apszOptions[] = {"TILED=YES", "BLOCKXSIZE=16",
+                                       "BLOCKYSIZE=16", nullptr};
+    const char *pszFilename1 = "/vsimem/GDALDataset_SetCacheMax_1.tif";
+    const char *pszFilename2 = "/vsimem/GDALDataset_SetCacheMax_2.tif";
+    auto poDS1 = std::unique_ptr<GDALDataset>(poGTiffDrv->Create(
+        pszFilename1, 256, 256, 1, GDT_Byte, apszOptions));
+    ASSERT_NE(poDS1, nullptr);
+    auto poDS2 = std::unique_ptr<GDALDataset>(poGTiffDrv->Create(
+        pszFilename2, 256, 256, 1, GDT_Byte, apszOptions));
+    ASSERT_NE(poDS2, nullptr);
+    EXPECT_EQ(poDS1->GetCacheMax(), 0);
+
+    const auto ReadAllBlocks = [](GDALDataset *poDS)
+    {
+        auto poBand = poDS->GetRasterBand(1);
+        for (int nYBlock = 0; nYBlock < 16; ++nYBlock)
+        {
+            for (int nXBlock = 0; nXBlock < 16; ++nXBlock)
+            {
+                GDALRasterBlock *poBlock =
+                    poBand->GetLockedBlockRef(nXBlock, nYBlock);
+                ASSERT_NE(poBlock, nullptr);
+                poBlock->DropLock();
+            }
+        }
+    };
+
+    // All blocks of the second dataset fit in the cache
+    ReadAllBlocks(poDS2.get());
+    GIntBig nCacheUsed2 = 0;
+    GIntBig nDirtyBytes2 = 0;
+    GUIntBig nHits2 = 0;
+    GUIntBig nMisses2 = 0;
+    GUIntBig nEvictions2 = 0;
+    poDS2->GetCacheStatistics(&nCacheUsed2, &nDirtyBytes2, &nHits2, &nMisses2,
+                              &nEvictions2);
+    EXPECT_GE(nCacheUsed2, 256 * 16 * 16);
+    EXPECT_EQ(nDirtyBytes2, 0);
+    EXPECT_EQ(nHits2, 0U);
+    EXPECT_EQ(nMisses2, 256U);
+    EXPECT_EQ(nEvictions2, 0U);
+
+    // Restrict the first dataset to about 32 blocks
+    const GIntBig nQuota = nCacheUsed2 / 8;
+    poDS1->SetCacheMax(nQuota);
+    EXPECT_EQ(poDS1->GetCacheMax(), nQuota);
+    ReadAllBlocks(poDS1.get());
+    GIntBig nCacheUsed1 = 0;
+    GUIntBig nEvictions1 = 0;
+    poDS1->GetCacheStatistics(&nCacheUsed1, nullptr, nullptr, nullptr,
+                              &nEvictions1);
+    EXPECT_LE(nCacheUsed1, nQuota);
+    EXPECT_GT(nEvictions1, 0U);
+
+    // The blocks of the second dataset must not have been evicted
+    GIntBig nCacheUsed2After = 0;
+    poDS2->GetCacheStatistics(&nCacheUsed2After, nullptr, nullptr, nullptr,
+                              nullptr);
+    EXPECT_EQ(nCacheUsed2After, nCacheUsed2);
+
+    // Dirty bytes
+    GDALRasterBlock *poBlock = poDS2->GetRasterBand(1)->GetLockedBlockRef(0, 0);
+    ASSERT_NE(poBlock, nullptr);
+    poBlock->MarkDirty();
+    poBlock->DropLock();
+    poDS2->GetCacheStatistics(nullptr, &nDirtyBytes2, &nHits2, nullptr,
+                              nullptr);
+    EXPECT_EQ(nDirtyBytes2, 16 * 16);
+    EXPECT_EQ(nHits2, 1U);
+
+    poDS1.reset();
+    poDS2.reset();
+    GDALSetCacheMax64(nOldCacheMax);
+    VSIUnlink(pszFilename1);
+    VSIUnlink(pszFilename2);
+}
+
 }  // namespace
@@ -1868,6 +1868,39 @@ def test_cog_mask_band_overviews(tmp_vsimem):
     assert ds.GetRasterBand(1).GetOverview(1).IsMaskBand()
 
 
+###############################################################################
+# Test generation of overviews in memory rather than in a temporary file
+
+
+def test_cog_in_memory_overviews(tmp_path):
+
+    def create(filename, max_size):
+        with gdal.config_option("COG_IN_MEMORY_OVERVIEWS_MAX_SIZE", max_size):
+            gdal.Translate(
+                filename,
+                "data/stefan_full_rgba.tif",
+                options="-co OVERVIEW_COUNT=2 -of COG -outsize 1024 0 -b 1 -b 2 -b 3 -mask 4",
+            )
+        return gdal.Open(filename)
+
+    ds = create(str(tmp_path / "in_memory.tif"), None)
+    ref_ds = create(str(tmp_path / "tmp_file.tif"), "0")
+    assert sorted(os.listdir(tmp_path)) == ["in_memory.tif", "tmp_file.tif"]
+
+    assert ds.GetRasterBand(1).GetOverviewCount() == 2
+    for i in range(3):
+        for j in range(2):
+            assert (
+                ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+                == ref_ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+            )
+    for j in range(2):
+        assert (
+            ds.GetRasterBand(1).GetMaskBand().GetOverview(j).Checksum()
+            == ref_ds.GetRasterBand(1).GetMaskBand().GetOverview(j).Checksum()
+        )
+
+
 ###############################################################################
 # Verify that we can generate an output that is byte-identical to the expected golden file.
 
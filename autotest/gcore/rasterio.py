@@ -1027,6 +1027,73 @@ def test_rasterio_nearest_or_mode(dt, resample_alg, use_nan):
         assert numpy.array_equal(ar_ds, expected_ar)
 
 
+###############################################################################
+# Test mode resampling of 8-bit and 16-bit data, which uses a histogram
+
+
+@pytest.mark.parametrize("dt", ["Byte", "Int8", "Int16", "UInt16"])
+@pytest.mark.parametrize("nodata", [None, 3])
+def test_rasterio_mode_histogram(dt, nodata):
+    numpy = pytest.importorskip("numpy")
+    gdal_array = gdaltest.importorskip_gdal_array()
+
+    dt = gdal.GetDataTypeByName(dt)
+    dtype = gdal_array.flip_code(dt)
+    values = [-5, 0, 3, 100] if dt in (gdal.GDT_Int8, gdal.GDT_Int16) else [0, 3, 7]
+    if dt == gdal.GDT_UInt16:
+        values.append(65535)
+    rng = numpy.random.default_rng(0)
+    src_ar = rng.choice(values, size=(40, 40)).astype(dtype)
+
+    mem_ds = gdal.GetDriverByName("MEM").Create("", 40, 40, 1, dt)
+    if nodata is not None:
+        mem_ds.GetRasterBand(1).SetNoDataValue(nodata)
+    mem_ds.GetRasterBand(1).WriteArray(src_ar)
+    mem_ds.BuildOverviews("MODE", [5])
+    ar_ds = mem_ds.GetRasterBand(1).GetOverview(0).ReadAsArray()
+
+    # Ties are resolved in favor of the value that reached the highest count
+    # first, scanning the source window in row-major order.
+    expected_ar = numpy.zeros((8, 8), dtype=dtype)
+    for y in range(8):
+        for x in range(8):
+            counts = {}
+            best_val = nodata if nodata is not None else 0
+            best_count = 0
+            for val in src_ar[y * 5 : y * 5 + 5, x * 5 : x * 5 + 5].flatten():
+                val = int(val)
+                if val == nodata:
+                    continue
+                counts[val] = counts.get(val, 0) + 1
+                if counts[val] > best_count:
+                    best_val = val
+                    best_count = counts[val]
+            expected_ar[y][x] = best_val
+    assert numpy.array_equal(ar_ds, expected_ar)
+
+
+###############################################################################
+# Test that the runtime-dispatched AVX convolution gives the same results
+
+
+@pytest.mark.parametrize("resampling", ["BILINEAR", "CUBIC", "LANCZOS"])
+def test_rasterio_convolution_use_avx(resampling):
+    numpy = pytest.importorskip("numpy")
+    pytest.importorskip("osgeo.gdal_array")
+
+    rng = numpy.random.default_rng(0)
+    src_ar = rng.integers(0, 65535, size=(67, 101)).astype(numpy.uint16)
+
+    res = []
+    for use_avx in ("YES", "NO"):
+        mem_ds = gdal.GetDriverByName("MEM").Create("", 101, 67, 1, gdal.GDT_UInt16)
+        mem_ds.GetRasterBand(1).WriteArray(src_ar)
+        with gdal.config_option("GDAL_USE_AVX", use_avx):
+            mem_ds.BuildOverviews(resampling, [3])
+        res.append(mem_ds.GetRasterBand(1).GetOverview(0).ReadAsArray())
+    assert numpy.array_equal(res[0], res[1])
+
+
 ###############################################################################
 # Test average downsampling by a factor of 2 on exact boundaries
 
@@ -2389,6 +2389,112 @@ def test_tiff_ovr_multithreading_multiband():
     gdal.Unlink("/vsimem/test.tif")
 
 
+###############################################################################
+# Test GDAL_OVR_FUSED_PYRAMID=YES through GDALRegenerateOverviewsMultiBand
+
+
+@pytest.mark.parametrize(
+    "resampling", ["NEAREST", "AVERAGE", "CUBIC", "LANCZOS", "MODE", "RMS"]
+)
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_tiff_ovr_fused_pyramid(tmp_vsimem, resampling, num_threads):
+
+    src_ds = gdal.Translate(
+        "",
+        "data/stefan_full_rgba.tif",
+        format="MEM",
+        width=301,
+        height=257,
+        bandList=[1, 2, 3],
+    )
+
+    def build(filename, fused):
+        ds = gdal.GetDriverByName("GTiff").CreateCopy(
+            filename,
+            src_ds,
+            options=["INTERLEAVE=PIXEL", "TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32"],
+        )
+        with gdal.config_options(
+            {
+                "GDAL_NUM_THREADS": num_threads,
+                "GDAL_OVR_FUSED_PYRAMID": "YES" if fused else "NO",
+                "GDAL_OVR_CHUNK_MAX_SIZE": "10000",
+            }
+        ):
+            ds.BuildOverviews(resampling, [2, 4, 8, 16])
+        return [
+            [
+                ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+                for j in range(ds.GetRasterBand(1).GetOverviewCount())
+            ]
+            for i in range(ds.RasterCount)
+        ]
+
+    assert build(str(tmp_vsimem / "fused.tif"), True) == build(
+        str(tmp_vsimem / "ref.tif"), False
+    )
+
+
+###############################################################################
+# Test that GDAL_OVR_FUSED_PYRAMID=YES feeds each level with values in the
+# NBITS domain of the previous overview, as the cascading mode does
+
+
+@pytest.mark.parametrize("resampling", ["AVERAGE", "BILINEAR", "CUBIC"])
+@pytest.mark.parametrize(
+    "datatype,nbits,scale_max",
+    [(gdal.GDT_UInt8, 4, 15), (gdal.GDT_UInt16, 12, 4095), (gdal.GDT_Float32, 16, 1)],
+)
+def test_tiff_ovr_fused_pyramid_nbits(
+    tmp_vsimem, resampling, datatype, nbits, scale_max
+):
+
+    src_ds = gdal.Translate(
+        "",
+        "data/stefan_full_rgba.tif",
+        format="MEM",
+        width=301,
+        height=257,
+        bandList=[1, 2, 3],
+        outputType=datatype,
+        scaleParams=[[0, 255, 0, scale_max]],
+    )
+
+    def build(filename, fused):
+        ds = gdal.GetDriverByName("GTiff").CreateCopy(
+            filename,
+            src_ds,
+            options=[
+                "INTERLEAVE=PIXEL",
+                "TILED=YES",
+                "BLOCKXSIZE=32",
+                "BLOCKYSIZE=32",
+                f"NBITS={nbits}",
+            ],
+        )
+        with gdal.config_options(
+            {
+                "GDAL_OVR_FUSED_PYRAMID": "YES" if fused else "NO",
+                "GDAL_OVR_CHUNK_MAX_SIZE": "10000",
+            }
+        ):
+            ds.BuildOverviews(resampling, [2, 4, 8])
+        assert ds.GetRasterBand(1).GetOverview(0).GetMetadataItem(
+            "NBITS", "IMAGE_STRUCTURE"
+        ) == str(nbits)
+        return [
+            [
+                ds.GetRasterBand(i + 1).GetOverview(j).ReadRaster()
+                for j in range(ds.GetRasterBand(1).GetOverviewCount())
+            ]
+            for i in range(ds.RasterCount)
+        ]
+
+    assert build(str(tmp_vsimem / "fused.tif"), True) == build(
+        str(tmp_vsimem / "ref.tif"), False
+    )
+
+
 ###############################################################################
 
 
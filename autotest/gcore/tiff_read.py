@@ -5001,6 +5001,70 @@ def test_tiff_read_multi_threaded(
     ds = None
 
 
+###############################################################################
+# Test multi-threaded decoding with GTIFF_READ_AHEAD=YES
+
+
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+def test_tiff_read_multi_threaded_read_ahead(tmp_path, interleave):
+
+    ref_ds = gdal.GetDriverByName("MEM").Create("", 100, 203, 3)
+    for band in range(ref_ds.RasterCount):
+        buf = b""
+        for j in range(ref_ds.RasterYSize):
+            buf += array.array(
+                "B", [(band * 10 + j + i) % 256 for i in range(ref_ds.RasterXSize)]
+            )
+        ref_ds.GetRasterBand(band + 1).WriteRaster(
+            0, 0, ref_ds.RasterXSize, ref_ds.RasterYSize, buf
+        )
+
+    tmpfile = str(tmp_path / "test_tiff_read_multi_threaded_read_ahead.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        tmpfile,
+        ref_ds,
+        options=["COMPRESS=DEFLATE", "BLOCKYSIZE=4", "INTERLEAVE=" + interleave],
+    )
+
+    with gdal.config_options({"GDAL_NUM_THREADS": "4", "GTIFF_READ_AHEAD": "YES"}):
+        ds = gdal.Open(tmpfile)
+
+        # Whole raster, possibly decoded in place
+        assert ds.ReadRaster() == ref_ds.ReadRaster()
+        assert ds.ReadRaster(buf_pixel_space=3, buf_band_space=1) == ref_ds.ReadRaster(
+            buf_pixel_space=3, buf_band_space=1
+        )
+
+        # Sequential windows, the last one being truncated
+        for buf_pixel_space, buf_band_space in [(None, None), (3, 1)]:
+            for y in range(0, ds.RasterYSize, 16):
+                ysize = min(16, ds.RasterYSize - y)
+                assert ds.ReadRaster(
+                    10,
+                    y,
+                    80,
+                    ysize,
+                    buf_pixel_space=buf_pixel_space,
+                    buf_band_space=buf_band_space,
+                ) == ref_ds.ReadRaster(
+                    10,
+                    y,
+                    80,
+                    ysize,
+                    buf_pixel_space=buf_pixel_space,
+                    buf_band_space=buf_band_space,
+                ), y
+
+        # Requests not matching the speculatively decoded window
+        assert ds.ReadRaster(0, 0, 100, 8) == ref_ds.ReadRaster(0, 0, 100, 8)
+        assert ds.ReadRaster(0, 8, 100, 8) == ref_ds.ReadRaster(0, 8, 100, 8)
+        assert ds.ReadRaster(0, 20, 100, 8) == ref_ds.ReadRaster(0, 20, 100, 8)
+        assert ds.ReadRaster(0, 16, 100, 4, band_list=[2]) == ref_ds.ReadRaster(
+            0, 16, 100, 4, band_list=[2]
+        )
+        ds = None
+
+
 ###############################################################################
 # Test multi-threaded decoding with /vsicurl
 
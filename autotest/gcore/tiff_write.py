@@ -6788,6 +6788,51 @@ def test_tiff_write_137():
     gdal.Unlink("/vsimem/tiff_write_137.tif")
 
 
+###############################################################################
+# Test multi-threaded writing with GTIFF_OUT_OF_ORDER_WRITES=YES
+
+
+@pytest.mark.parametrize("tiled", [True, False])
+def test_tiff_write_multi_threaded_out_of_order_writes(tmp_vsimem, tiled):
+
+    src_ds = gdal.Translate("", "data/byte.tif", format="MEM", width=1000, height=1000)
+
+    def write(filename, out_of_order):
+        options = ["COMPRESS=DEFLATE", "NUM_THREADS=4"]
+        if tiled:
+            options += ["TILED=YES", "BLOCKXSIZE=64", "BLOCKYSIZE=64"]
+        else:
+            options += ["BLOCKYSIZE=8"]
+        with gdal.config_option(
+            "GTIFF_OUT_OF_ORDER_WRITES", "YES" if out_of_order else "NO"
+        ):
+            ds = gdal.GetDriverByName("GTiff").CreateCopy(
+                filename, src_ds, options=options
+            )
+            ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+            ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+                0, 0, 500, 1000, b"\xff" * (500 * 1000)
+            )
+            ds.BuildOverviews("NEAR", [2, 4])
+            # Read back while blocks may still be pending
+            assert (
+                ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+            )
+            ds = None
+        return gdal.Open(filename)
+
+    ref_ds = write(str(tmp_vsimem / "ref.tif"), False)
+    ds = write(str(tmp_vsimem / "out.tif"), True)
+
+    for band, ref_band in [
+        (ds.GetRasterBand(1), ref_ds.GetRasterBand(1)),
+        (ds.GetRasterBand(1).GetMaskBand(), ref_ds.GetRasterBand(1).GetMaskBand()),
+        (ds.GetRasterBand(1).GetOverview(0), ref_ds.GetRasterBand(1).GetOverview(0)),
+        (ds.GetRasterBand(1).GetOverview(1), ref_ds.GetRasterBand(1).GetOverview(1)),
+    ]:
+        assert band.Checksum() == ref_band.Checksum()
+
+
 ###############################################################################
 # Test that pixel-interleaved writing generates optimal size
 
@@ -2945,6 +2945,112 @@ def test_vrt_read_multi_threaded_disabled_since_overlapping_sources():
     )
 
 
+###############################################################################
+# Test multi-threaded reading of overlapping sources, composited by tiles
+
+
+@pytest.mark.parametrize("src_nodata", [None, 0])
+def test_vrt_read_multi_threaded_overlapping_sources(tmp_vsimem, src_nodata):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/small_world.tif", width=2048, format="MEM"
+    )
+    tile_filenames = []
+    for i, src_win in enumerate(
+        [[0, 0, 1200, 1024], [800, 100, 1248, 800], [500, 300, 1000, 500]]
+    ):
+        tile_filename = str(tmp_vsimem / ("%d.tif" % i))
+        # Different content for each source, with a hole of zeros
+        ds = gdal.Translate(
+            tile_filename,
+            src_ds,
+            srcWin=src_win,
+            bandList=[(i + j) % 3 + 1 for j in range(3)],
+        )
+        ds.GetRasterBand(1).WriteRaster(100, 100, 200, 200, b"\0" * (200 * 200))
+        ds.Close()
+        tile_filenames.append(tile_filename)
+    vrt_filename = str(tmp_vsimem / "test.vrt")
+    gdal.BuildVRT(vrt_filename, tile_filenames, srcNodata=src_nodata)
+
+    with gdal.config_option("VRT_NUM_THREADS", "0"):
+        with gdal.Open(vrt_filename) as vrt_ds:
+            expected = vrt_ds.GetRasterBand(1).ReadRaster()
+            assert (
+                vrt_ds.GetMetadataItem(
+                    "MULTI_THREADED_RASTERIO_LAST_USED", "__DEBUG__"
+                )
+                == "0"
+            )
+
+    pcts = []
+
+    def cbk(pct, msg, user_data):
+        if pcts:
+            assert pct >= pcts[-1]
+        pcts.append(pct)
+        return 1
+
+    with gdal.Open(vrt_filename) as vrt_ds:
+        assert vrt_ds.GetRasterBand(1).ReadRaster(callback=cbk) == expected
+        assert pcts[-1] == 1.0
+        assert vrt_ds.GetMetadataItem(
+            "MULTI_THREADED_RASTERIO_LAST_USED", "__DEBUG__"
+        ) == ("1" if gdal.GetNumCPUs() >= 2 else "0")
+
+
+###############################################################################
+# Test reading a VRT with enough sources for them to be spatially indexed
+
+
+def test_vrt_read_many_sources_spatial_index(tmp_vsimem):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/small_world.tif", width=400, format="MEM"
+    )
+    tile_filenames = []
+    for j in range(10):
+        for i in range(10):
+            tile_filename = str(tmp_vsimem / ("%d_%d.tif" % (i, j)))
+            gdal.Translate(tile_filename, src_ds, srcWin=[i * 40, j * 20, 40, 20])
+            tile_filenames.append(tile_filename)
+    vrt_filename = str(tmp_vsimem / "test.vrt")
+    gdal.BuildVRT(vrt_filename, tile_filenames)
+
+    with gdal.Open(vrt_filename) as vrt_ds:
+        for win in [
+            (0, 0, 400, 200),
+            (0, 0, 40, 20),
+            (39, 19, 2, 2),
+            (123, 45, 67, 89),
+            (399, 199, 1, 1),
+        ]:
+            assert vrt_ds.ReadRaster(*win) == src_ds.ReadRaster(*win)
+            assert vrt_ds.GetRasterBand(2).ReadRaster(
+                *win
+            ) == src_ds.GetRasterBand(2).ReadRaster(*win)
+
+        # Adding a source must update the index
+        constant_filename = str(tmp_vsimem / "constant.tif")
+        constant_ds = gdal.GetDriverByName("GTiff").Create(constant_filename, 10, 10)
+        constant_ds.GetRasterBand(1).Fill(123)
+        constant_ds.Close()
+        vrt_ds.GetRasterBand(1).SetMetadataItem(
+            "source_0",
+            f"""<SimpleSource>
+                  <SourceFilename>{constant_filename}</SourceFilename>
+                  <SourceBand>1</SourceBand>
+                  <SrcRect xOff="0" yOff="0" xSize="10" ySize="10"/>
+                  <DstRect xOff="195" yOff="95" xSize="10" ySize="10"/>
+                </SimpleSource>""",
+            "new_vrt_sources",
+        )
+        assert vrt_ds.GetRasterBand(1).ReadRaster(195, 95, 10, 10) == b"\x7b" * 100
+        assert vrt_ds.GetRasterBand(1).ReadRaster(
+            190, 90, 5, 5
+        ) == src_ds.GetRasterBand(1).ReadRaster(190, 90, 5, 5)
+
+
 ###############################################################################
 # Test propagation of errors from threads to main thread in multi-threaded reading
 
@@ -11,7 +11,10 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
+import os
 import sys
+import threading
 import time
 
 import gdaltest
@@ -1977,3 +1980,352 @@ def test_vsicurl_transfer_encoding_chunked(server):
                 )
                 is None
             )
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_SHARED_CACHE
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="not supported on Windows")
+def test_vsicurl_shared_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    url = (
+        "/vsicurl/http://localhost:%d/test_shared_cache/test.bin" % server.port
+    )
+    options = {
+        "CPL_VSIL_CURL_SHARED_CACHE": str(tmp_path / "shared_cache"),
+        "CPL_VSIL_CURL_SHARED_CACHE_SIZE": "1000000",
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+    }
+
+    def read():
+        f = gdal.VSIFOpenL(url, "rb")
+        assert f is not None
+        try:
+            return gdal.VSIFReadL(1, 3, f)
+        finally:
+            gdal.VSIFCloseL(f)
+
+    def add_requests(handler, etag, content):
+        headers = {"Content-Length": "3", "ETag": etag}
+        handler.add("HEAD", "/test_shared_cache/test.bin", 200, headers)
+        handler.add("GET", "/test_shared_cache/test.bin", 200, headers, content)
+
+    handler = webserver.SequentialHandler()
+    add_requests(handler, '"1"', b"xyz")
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        assert read() == b"xyz"
+
+    assert (os.stat(tmp_path / "shared_cache").st_mode & 0o777) == 0o600
+
+    # The process-local cache is cleared, but what has been downloaded is
+    # still in the shared cache, as for another process of the host.
+    gdal.VSICurlClearCache()
+    with webserver.install_http_handler(
+        webserver.SequentialHandler()
+    ), gdal.config_options(options):
+        assert gdal.VSIStatL(url).size == 3
+        assert read() == b"xyz"
+
+    # Invalidation also applies to the shared cache
+    with gdal.config_options(options):
+        gdal.VSICurlPartialClearCache(url)
+    handler = webserver.SequentialHandler()
+    add_requests(handler, '"2"', b"abc")
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        assert read() == b"abc"
+
+    # Regions of another version of the remote file are not used
+    gdal.VSICurlClearCache()
+    handler = webserver.SequentialHandler()
+    add_requests(handler, '"3"', b"def")
+    with webserver.install_http_handler(handler), gdal.config_options(
+        options | {"CPL_VSIL_CURL_SHARED_CACHE_TTL": "0"}
+    ):
+        assert read() == b"def"
+
+    # VSICurlClearCache() does not clear the shared cache, which is in use by
+    # other processes
+    with gdal.config_options(options):
+        gdal.VSICurlClearCache()
+    with webserver.install_http_handler(
+        webserver.SequentialHandler()
+    ), gdal.config_options(options):
+        assert read() == b"def"
+
+    # Responses with Cache-Control: no-cache are not shared
+    gdal.VSICurlClearCache()
+    with gdal.config_options(options):
+        gdal.VSICurlPartialClearCache(url)
+    headers = {"Content-Length": "3", "ETag": '"4"', "Cache-Control": "no-cache"}
+    handler = webserver.SequentialHandler()
+    handler.add("HEAD", "/test_shared_cache/test.bin", 200, headers)
+    handler.add("GET", "/test_shared_cache/test.bin", 200, headers, b"ghi")
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        # Keep the file open, as its data is invalidated when it is closed
+        f = gdal.VSIFOpenL(url, "rb")
+        assert f is not None
+        assert gdal.VSIFReadL(1, 3, f) == b"ghi"
+    try:
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        add_requests(handler, '"4"', b"ghi")
+        with webserver.install_http_handler(handler), gdal.config_options(
+            options | {"CPL_VSIL_CURL_SHARED_CACHE_TTL": "0"}
+        ):
+            assert read() == b"ghi"
+    finally:
+        gdal.VSIFCloseL(f)
+    gdal.VSICurlClearCache()
+    handler = webserver.SequentialHandler()
+    add_requests(handler, '"4"', b"ghi")
+    with webserver.install_http_handler(handler), gdal.config_options(
+        options | {"CPL_VSIL_CURL_SHARED_CACHE_TTL": "0"}
+    ):
+        assert read() == b"ghi"
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    url = "/vsicurl/http://localhost:%d/test_disk_cache/test.bin" % server.port
+    options = {
+        "CPL_VSIL_CURL_DISK_CACHE": str(tmp_path / "disk_cache"),
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+    }
+
+    def read():
+        f = gdal.VSIFOpenL(url, "rb")
+        assert f is not None
+        try:
+            return gdal.VSIFReadL(1, 3, f)
+        finally:
+            gdal.VSIFCloseL(f)
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_disk_cache/test.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"first"'},
+    )
+    handler.add(
+        "GET", "/test_disk_cache/test.bin", 200, {"Content-Length": "3"}, b"xyz"
+    )
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        assert read() == b"xyz"
+
+    chunk_files = list((tmp_path / "disk_cache").glob("*/*.chunk"))
+    assert len(chunk_files) == 1
+    if sys.platform != "win32":
+        # Cached content may come from authenticated requests
+        assert (os.stat(tmp_path / "disk_cache").st_mode & 0o777) == 0o700
+        assert (os.stat(chunk_files[0]).st_mode & 0o777) == 0o600
+        # Hits update the modification time, used to order files for eviction
+        os.utime(chunk_files[0], (0, 0))
+
+    # Simulates a restart: the file properties are requested again, but
+    # the data is read from the disk cache since the ETag has not changed.
+    gdal.VSICurlClearCache()
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_disk_cache/test.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"first"'},
+    )
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        assert read() == b"xyz"
+
+    if sys.platform != "win32":
+        assert os.stat(chunk_files[0]).st_mtime > 0
+
+    # The remote file has changed
+    gdal.VSICurlClearCache()
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_disk_cache/test.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"second"'},
+    )
+    handler.add(
+        "GET", "/test_disk_cache/test.bin", 200, {"Content-Length": "3"}, b"abc"
+    )
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        assert read() == b"abc"
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that CPL_VSIL_CURL_DISK_CACHE takes into account files of other
+# processes, and removes temporary files left by dead writers
+
+
+def test_vsicurl_disk_cache_shared_directory(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    cache_dir = tmp_path / "disk_cache"
+    (cache_dir / "00").mkdir(parents=True)
+    stale_tmp = cache_dir / "00" / "0000.chunk.1.1.tmp"
+    stale_tmp.write_bytes(b"x")
+    os.utime(stale_tmp, (time.time() - 7200, time.time() - 7200))
+    recent_tmp = cache_dir / "00" / "0001.chunk.1.1.tmp"
+    recent_tmp.write_bytes(b"x")
+    other_chunk = cache_dir / "00" / "0002.chunk"
+    other_chunk.write_bytes(b"x" * 2000)
+
+    options = {
+        "CPL_VSIL_CURL_DISK_CACHE": str(cache_dir),
+        "CPL_VSIL_CURL_DISK_CACHE_SIZE": "1000",
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+    }
+
+    def read(filename):
+        url = "/vsicurl/http://localhost:%d/%s" % (server.port, filename)
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD", "/" + filename, 200, {"Content-Length": "3", "ETag": '"1"'}
+        )
+        handler.add("GET", "/" + filename, 200, {"Content-Length": "3"}, b"xyz")
+        with webserver.install_http_handler(handler), gdal.config_options(options):
+            f = gdal.VSIFOpenL(url, "rb")
+            assert f is not None
+            try:
+                assert gdal.VSIFReadL(1, 3, f) == b"xyz"
+            finally:
+                gdal.VSIFCloseL(f)
+
+    read("test_disk_cache_shared/a.bin")
+    assert not stale_tmp.exists()
+    assert recent_tmp.exists()
+    # Evicted, as the directory is larger than CPL_VSIL_CURL_DISK_CACHE_SIZE
+    assert not other_chunk.exists()
+
+    # Written by another process after the directory has been scanned. It
+    # is found when the directory is scanned again after this process has
+    # written enough data.
+    other_chunk.write_bytes(b"x" * 2000)
+    read("test_disk_cache_shared/b.bin")
+    assert not other_chunk.exists()
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_ADAPTIVE_READAHEAD
+
+
+def test_vsicurl_adaptive_readahead(server):
+
+    gdal.VSICurlClearCache()
+
+    data = bytes((i * 7) % 251 for i in range(1024 * 1024))
+    handler = webserver.FileHandler({"/test_readahead/test.bin": data})
+    url = "/vsicurl/http://localhost:%d/test_readahead/test.bin" % server.port
+    options = {
+        "CPL_VSIL_CURL_ADAPTIVE_READAHEAD": "YES",
+        "CPL_VSIL_NETWORK_STATS_ENABLED": "YES",
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+    }
+
+    gdal.NetworkStatsReset()
+    try:
+        with webserver.install_http_handler(handler), gdal.config_options(
+            options, thread_local=False
+        ):
+            f = gdal.VSIFOpenL(url, "rb")
+            assert f is not None
+            try:
+                # Strided reads
+                for i in range(16):
+                    offset = i * 40000
+                    assert gdal.VSIFSeekL(f, offset, 0) == 0
+                    assert gdal.VSIFReadL(1, 100, f) == data[offset : offset + 100]
+
+                # Two interleaved sequential streams
+                for i in range(64):
+                    for start in (700000, 900000):
+                        offset = start + i * 1000
+                        assert gdal.VSIFSeekL(f, offset, 0) == 0
+                        assert (
+                            gdal.VSIFReadL(1, 1000, f)
+                            == data[offset : offset + 1000]
+                        )
+            finally:
+                gdal.VSIFCloseL(f)
+
+        j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+        assert j["prefetch"]["downloaded_bytes"] > 0
+        assert j["prefetch"]["hit_bytes"] > 0
+        assert 0 < j["prefetch"]["hit_rate"] <= 1
+    finally:
+        gdal.NetworkStatsReset()
+        gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test concurrent reads of overlapping regions of a file from several threads
+
+
+@pytest.mark.parametrize(
+    "coalesce,max_inflight_bytes", [("YES", "100MB"), ("YES", "1"), ("NO", "0")]
+)
+def test_vsicurl_concurrent_overlapping_reads(server, coalesce, max_inflight_bytes):
+
+    gdal.VSICurlClearCache()
+
+    data = bytes((i * 13) % 251 for i in range(1024 * 1024))
+    handler = webserver.FileHandler({"/test_concurrent/test.bin": data})
+    url = "/vsicurl/http://localhost:%d/test_concurrent/test.bin" % server.port
+    options = {
+        "CPL_VSIL_CURL_COALESCE_CONCURRENT_REQUESTS": coalesce,
+        "CPL_VSIL_CURL_MAX_INFLIGHT_BYTES": max_inflight_bytes,
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+    }
+
+    errors = []
+
+    def read(offset, size):
+        try:
+            f = gdal.VSIFOpenL(url, "rb")
+            assert f is not None
+            try:
+                assert gdal.VSIFSeekL(f, offset, 0) == 0
+                assert gdal.VSIFReadL(1, size, f) == data[offset : offset + size]
+            finally:
+                gdal.VSIFCloseL(f)
+        except Exception as e:
+            errors.append(e)
+
+    try:
+        with webserver.install_http_handler(handler), gdal.config_options(
+            options, thread_local=False
+        ):
+            # Make sure the file size is known by all threads
+            assert gdal.VSIStatL(url).size == len(data)
+
+            # The first read of each pair covers the second one
+            threads = []
+            for i in range(4):
+                start = i * 200000
+                threads.append(threading.Thread(target=read, args=(start, 150000)))
+                threads.append(
+                    threading.Thread(target=read, args=(start + 50000, 1000))
+                )
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+        assert not errors, errors
+    finally:
+        gdal.VSICurlClearCache()
@@ -919,6 +919,177 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test multithreaded decompression of files made of several gzip members
+
+
+def test_vsigzip_multi_thread_read(tmp_vsimem):
+
+    import gzip
+
+    data = b"".join(b"%d,hello world\n" % i for i in range(500000))
+    compressed = b"".join(
+        gzip.compress(data[i : i + 100000]) for i in range(0, len(data), 100000)
+    )
+    filename = "/vsigzip/" + str(tmp_vsimem / "test.gz")
+    gdal.FileFromMemBuffer(filename[len("/vsigzip/") :], compressed)
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        f = gdal.VSIFOpenL(filename, "rb")
+        assert f
+        try:
+            got = b""
+            while True:
+                chunk = gdal.VSIFReadL(1, 100000, f)
+                if not chunk:
+                    break
+                got += chunk
+            assert got == data
+            assert gdal.VSIFEofL(f)
+
+            assert gdal.VSIFSeekL(f, 0, 2) == 0
+            assert gdal.VSIFTellL(f) == len(data)
+
+            # Backward seeks
+            for offset in (1000, len(data) - 1000, 5000000):
+                assert gdal.VSIFSeekL(f, offset, 0) == 0
+                assert gdal.VSIFReadL(1, 1000, f) == data[offset : offset + 1000]
+        finally:
+            gdal.VSIFCloseL(f)
+
+        # Truncated file
+        gdal.FileFromMemBuffer(filename[len("/vsigzip/") :], compressed[0:-1000])
+        f = gdal.VSIFOpenL(filename, "rb")
+        assert f
+        with gdal.quiet_errors():
+            got = gdal.VSIFReadL(1, len(data), f)
+        gdal.VSIFCloseL(f)
+        assert len(got) < len(data)
+        assert got == data[0 : len(got)]
+
+        # Segment whose uncompressed size exceeds the limit of a job
+        zeros = bytes(1000000)
+        gdal.FileFromMemBuffer(
+            filename[len("/vsigzip/") :],
+            gzip.compress(zeros) * 20 + compressed,
+        )
+        f = gdal.VSIFOpenL(filename, "rb")
+        assert f
+        got = gdal.VSIFReadL(1, 20 * len(zeros) + len(data), f)
+        gdal.VSIFCloseL(f)
+        assert got == zeros * 20 + data
+
+
+###############################################################################
+# Test multithreaded decompression of a .gz file with an index
+
+
+def test_vsigzip_multi_thread_read_index(tmp_vsimem):
+
+    import gzip
+    import random
+
+    rng = random.Random(0)
+    data = b"".join(b"%d,%d\n" % (i, rng.getrandbits(32)) for i in range(200000))
+    filename = str(tmp_vsimem / "test.gz")
+    gdal.FileFromMemBuffer(filename, gzip.compress(data))
+
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_INDEX": "YES",
+            "CPL_VSIL_GZIP_INDEX_SPAN": "256K",
+            "CPL_VSIL_GZIP_WRITE_PROPERTIES": "NO",
+        }
+    ):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        assert gdal.VSIFReadL(1, len(data), f) == data
+        gdal.VSIFCloseL(f)
+        assert gdal.VSIStatL(filename + ".gzidx") is not None
+
+        with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+            f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+            assert f
+            try:
+                got = b""
+                while True:
+                    chunk = gdal.VSIFReadL(1, 100000, f)
+                    if not chunk:
+                        break
+                    got += chunk
+                assert got == data
+                assert gdal.VSIFSeekL(f, 1000, 0) == 0
+                assert gdal.VSIFReadL(1, 1000, f) == data[1000:2000]
+            finally:
+                gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test persisted index of access points of /vsigzip/ (CPL_VSIL_GZIP_INDEX)
+
+
+def test_vsigzip_index(tmp_vsimem):
+
+    import gzip
+    import random
+
+    rng = random.Random(0)
+    data = b"".join(
+        bytes(rng.getrandbits(8) for _ in range(100)) + b"abcdefgh" * 100
+        for _ in range(2000)
+    )
+    filename = str(tmp_vsimem / "test.gz")
+    gdal.FileFromMemBuffer(filename, gzip.compress(data))
+
+    def read_at(offsets):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        try:
+            for offset in offsets:
+                assert gdal.VSIFSeekL(f, offset, 0) == 0
+                assert gdal.VSIFReadL(1, 1000, f) == data[offset : offset + 1000]
+        finally:
+            gdal.VSIFCloseL(f)
+
+    def drop_cached_handle():
+        # Opening another .gz file drops the handle cached by /vsigzip/
+        other = str(tmp_vsimem / "other.gz")
+        gdal.FileFromMemBuffer(other, gzip.compress(b"x"))
+        f = gdal.VSIFOpenL("/vsigzip/" + other, "rb")
+        gdal.VSIFCloseL(f)
+
+    offsets = [rng.randrange(len(data)) for _ in range(20)]
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_INDEX": "YES",
+            "CPL_VSIL_GZIP_INDEX_SPAN": "64K",
+            "CPL_VSIL_GZIP_WRITE_PROPERTIES": "NO",
+        }
+    ):
+        # Index built once the whole file has been read
+        read_at([len(data) // 2, 0, len(data) - 1000])
+        assert gdal.VSIStatL(filename + ".gzidx") is not None
+
+        drop_cached_handle()
+        read_at(offsets)
+
+        # Corrupted index is ignored
+        drop_cached_handle()
+        gdal.FileFromMemBuffer(filename + ".gzidx", b"GDALGZIX" + b"\xff" * 100)
+        read_at(offsets)
+
+        # Index in a separate directory
+        drop_cached_handle()
+        with gdaltest.config_option(
+            "CPL_VSIL_GZIP_INDEX_DIR", str(tmp_vsimem / "idx")
+        ):
+            gdal.Mkdir(str(tmp_vsimem / "idx"), 0o755)
+            read_at([0, len(data) - 1000])
+            assert len(gdal.ReadDir(str(tmp_vsimem / "idx"))) == 1
+            drop_cached_handle()
+            read_at(offsets)
+
+
 ###############################################################################
 # Test vsisync()
 
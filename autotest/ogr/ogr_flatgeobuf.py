@@ -1148,6 +1148,82 @@ def test_ogr_flatgeobuf_arrow_stream_numpy(layer_creation_options):
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test that attribute filters evaluated on Arrow batches give the same results
+# as on features
+
+
+@pytest.mark.parametrize("vectorized", ["YES", "NO"])
+def test_ogr_flatgeobuf_arrow_stream_numpy_attribute_filter(tmp_vsimem, vectorized):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    field = ogr.FieldDefn("bool", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    values = [
+        (1, 1, 3, 1.5, "abc"),
+        (0, 3, None, 2.5, "ABD"),
+        (None, None, 5, None, None),
+        (1, 5, -(1 << 40), -0.5, "bcd"),
+        (0, 6, 7, 3.0, "b_c"),
+        (1, -7, 1 << 62, float("nan"), ""),
+    ]
+    for vals in values:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        for i, val in enumerate(vals):
+            if val is None:
+                f.SetFieldNull(i)
+            else:
+                f.SetField(i, val)
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(1 2)"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    for filter in [
+        "int32 > 2",
+        "int32 BETWEEN 2 AND 6",
+        "int32 IN (1, 3, NULL)",
+        "NOT (int32 IN (1, 3, NULL))",
+        "int32 IS NULL",
+        "int32 IS NOT NULL AND str LIKE 'a%'",
+        "str ILIKE 'B_C'",
+        "str LIKE 'b\\_c' ESCAPE '\\'",
+        "str = 'abc' OR float64 < 2.5",
+        "NOT (str = 'abc' OR float64 < 2.5)",
+        "int64 * 2 + 1 = 7",
+        "int64 * 4 < 0",
+        "int32 / 0 = 2147483647",
+        "int32 % 3 = 1",
+        "float64 / 2 > 1",
+        "float64 <> float64",
+        "str > 'b'",
+        "str IN ('abc', 'ABD')",
+        "FID >= 2",
+        "int32 + float64 > 5",
+        "int32 BETWEEN 1.5 AND 5.5",
+        "bool = 1",
+    ]:
+        lyr.SetAttributeFilter(filter)
+        with gdaltest.error_handler():
+            expected_fids = [f.GetFID() for f in lyr]
+        with gdal.config_option(
+            "OGR_ARROW_VECTORIZED_FILTER", vectorized
+        ), gdaltest.error_handler():
+            stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+            fids = [fid for batch in stream for fid in batch["OGC_FID"]]
+        assert fids == expected_fids, filter
+
+
 ###############################################################################
 # Test reading an empty file with GetArrowStream()
 
@@ -546,3 +546,102 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test that equality joins resolved with a hash table give the same result as
+# with attribute filters on the secondary layer
+
+
+@pytest.mark.parametrize("max_memory", [None, "1"])
+def test_ogr_join_hash_join(max_memory):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr1 = ds.CreateLayer("lyr1")
+    lyr1.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    lyr1.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    lyr1.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    lyr2 = ds.CreateLayer("lyr2")
+    lyr2.CreateField(ogr.FieldDefn("i", ogr.OFTInteger64))
+    lyr2.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    lyr2.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    lyr2.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+
+    for i in range(50):
+        f = ogr.Feature(lyr1.GetLayerDefn())
+        if i % 7 != 0:
+            f["i"] = i % 20
+            f["r"] = (i % 20) / 4.0
+            f["s"] = "key%d" % (i % 20)
+        lyr1.CreateFeature(f)
+    f = ogr.Feature(lyr1.GetLayerDefn())
+    f["r"] = -0.0
+    f["s"] = "2020/01/01 00:00:00+00"
+    lyr1.CreateFeature(f)
+
+    for i in range(30):
+        f = ogr.Feature(lyr2.GetLayerDefn())
+        f["i"] = i % 15
+        f["r"] = (i % 15) / 4.0
+        f["s"] = ("KEY%d" if i % 2 else "key%d") % (i % 15)
+        f["val"] = "val%d" % i
+        lyr2.CreateFeature(f)
+    f = ogr.Feature(lyr2.GetLayerDefn())
+    f["s"] = "2020/01/01 00:00"
+    f["val"] = "timestamp"
+    lyr2.CreateFeature(f)
+
+    def get_result(sql, hash_join):
+        options = {"OGR_SQL_HASH_JOIN": "YES" if hash_join else "NO"}
+        if max_memory:
+            options["OGR_SQL_HASH_JOIN_MAX_MEMORY"] = max_memory
+        with gdal.config_options(options):
+            with ds.ExecuteSQL(sql) as sql_lyr:
+                return [(f["val"], f["s2"]) for f in sql_lyr]
+
+    for field in ("i", "r", "s"):
+        sql = (
+            "SELECT lyr1.*, lyr2.val AS val, lyr2.s AS s2 "
+            f"FROM lyr1 LEFT JOIN lyr2 ON lyr1.{field} = lyr2.{field}"
+        )
+        res = get_result(sql, True)
+        assert res == get_result(sql, False)
+        assert len(res) == 51
+        assert res[1] == ("val1", "KEY1")
+
+
+###############################################################################
+# Test that no hash table is used when the attribute filter on the secondary
+# layer is evaluated by the driver, with its own comparison rules
+
+
+@pytest.mark.require_driver("GPKG")
+def test_ogr_join_hash_join_native_attribute_filter(tmp_vsimem):
+
+    ds = gdal.GetDriverByName("GPKG").CreateVector(tmp_vsimem / "test.gpkg")
+    lyr1 = ds.CreateLayer("lyr1", geom_type=ogr.wkbNone)
+    lyr1.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    lyr2 = ds.CreateLayer("lyr2", geom_type=ogr.wkbNone)
+    lyr2.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    lyr2.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+
+    for i in range(50):
+        f = ogr.Feature(lyr1.GetLayerDefn())
+        f["s"] = "key%d" % (i % 20)
+        lyr1.CreateFeature(f)
+
+    for i in range(20):
+        for s in ("KEY%d" % i, "key%d" % i):
+            f = ogr.Feature(lyr2.GetLayerDefn())
+            f["s"] = s
+            f["val"] = s
+            lyr2.CreateFeature(f)
+
+    # GPKG compares strings case-sensitively
+    with ds.ExecuteSQL(
+        "SELECT lyr1.s, lyr2.val AS val FROM lyr1 "
+        "LEFT JOIN lyr2 ON lyr1.s = lyr2.s",
+        dialect="OGRSQL",
+    ) as sql_lyr:
+        res = [(f["s"], f["val"]) for f in sql_lyr]
+    assert res == [("key%d" % (i % 20), "key%d" % (i % 20)) for i in range(50)]
@@ -6158,6 +6158,139 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     assert len(batches) == 0
 
 
+###############################################################################
+# Test multi-threaded GetNextArrowArray()
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("mem_limit", [None, "5000"])
+def test_ogr_shape_arrow_stream_multi_threaded(tmp_vsimem, num_threads, mem_limit):
+    filename = str(tmp_vsimem / "test_ogr_shape_arrow_stream_multi_threaded.shp")
+    ds = gdal.GetDriverByName("ESRI Shapefile").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    )
+    lyr = ds.CreateLayer(
+        "test", geom_type=ogr.wkbLineString25D, options=["AUTO_REPACK=NO"]
+    )
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    num_features = 1000
+    for i in range(num_features):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 7 != 0:
+            f["int"] = i - 500
+            f["int64"] = i * 10000000000
+            f["real"] = i + 0.5
+            f["str"] = f"foo{i}"
+            f["date"] = f"2024/{1 + i % 12:02d}/{1 + i % 28:02d}"
+            f["bool"] = i % 2
+        if i % 11 != 0:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"LINESTRING Z ({i} 0 1,{i} 1 2)"))
+        lyr.CreateFeature(f)
+    for i in list(range(100, 350)) + list(range(500, num_features, 3)):
+        lyr.DeleteFeature(i)
+    ds.Close()
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    expected = {f.GetFID(): f for f in lyr}
+
+    mem_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    mem_lyr = mem_ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+
+    options = {"SHAPE_NUM_THREADS": num_threads}
+    if mem_limit:
+        options["OGR_ARROW_MEM_LIMIT"] = mem_limit
+    optimized = []
+    with gdaltest.config_options(options):
+        stream = lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=100"])
+        schema = stream.GetSchema()
+        for i in range(schema.GetChildrenCount()):
+            if schema.GetChild(i).GetName() not in ("OGC_FID", "wkb_geometry"):
+                mem_lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+        while True:
+            array = stream.GetNextRecordBatch()
+            if array is None:
+                break
+            optimized.append(
+                lyr.GetMetadataItem(
+                    "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+                )
+            )
+            assert (
+                mem_lyr.WriteArrowBatch(schema, array, ["FID=OGC_FID"])
+                == ogr.OGRERR_NONE
+            )
+
+    if num_threads == "1":
+        assert set(optimized) == set(["NO"])
+    elif mem_limit:
+        assert optimized[0] == "YES"
+    else:
+        assert set(optimized) == set(["YES"])
+
+    assert mem_lyr.GetFeatureCount() == len(expected)
+    for f in mem_lyr:
+        expected_f = expected[f.GetFID()]
+        for i in range(expected_f.GetFieldCount()):
+            assert f[expected_f.GetFieldDefnRef(i).GetName()] == expected_f[i]
+        if expected_f.GetGeometryRef() is None:
+            assert f.GetGeometryRef() is None
+        else:
+            assert (
+                f.GetGeometryRef().ExportToIsoWkt()
+                == expected_f.GetGeometryRef().ExportToIsoWkt()
+            )
+
+
+###############################################################################
+# Test that invalid SHAPE_NUM_THREADS values are rejected
+
+
+@pytest.mark.parametrize("num_threads", ["invalid", "-1"])
+def test_ogr_shape_arrow_stream_invalid_num_threads(tmp_vsimem, num_threads):
+    filename = str(tmp_vsimem / "test_ogr_shape_arrow_stream_invalid_num_threads.shp")
+    ds = gdal.GetDriverByName("ESRI Shapefile").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    )
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int"] = i
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} 0)"))
+        lyr.CreateFeature(f)
+    ds.Close()
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    with gdaltest.config_option("SHAPE_NUM_THREADS", num_threads):
+        stream = lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=100"])
+        num_batches = 0
+        with gdal.quiet_errors():
+            gdal.ErrorReset()
+            while True:
+                array = stream.GetNextRecordBatch()
+                if array is None:
+                    break
+                num_batches += 1
+                assert (
+                    lyr.GetMetadataItem(
+                        "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH",
+                        "__DEBUG__",
+                    )
+                    == "NO"
+                )
+            assert "Invalid value for SHAPE_NUM_THREADS" in gdal.GetLastErrorMsg()
+    assert num_batches == 10
+
+
 ###############################################################################
 # Test DBF Logical field type
 
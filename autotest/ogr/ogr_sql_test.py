@@ -1434,6 +1434,286 @@ def test_ogr_sql_48():
             assert sql_lyr.GetFeature(i)["int_field"] == lyr.GetFeature(i)["int_field"]
 
 
+###############################################################################
+# Test ORDER BY when the keys do not fit within OGR_SQL_ORDER_BY_MAX_MEMORY
+
+
+@pytest.mark.parametrize("num_threads", ["1", "2"])
+def test_ogr_sql_order_by_external_sort(num_threads):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    for i in range(40000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_field"] = (i * 7919) % 1000
+        if i % 11:
+            f["str_field"] = "val%d" % ((i * 31) % 5000)
+        lyr.CreateFeature(f)
+
+    def get_fids(sql, options={}):
+        with gdal.config_options(options):
+            with ds.ExecuteSQL(sql) as sql_lyr:
+                return [f.GetFID() for f in sql_lyr]
+
+    options = {"OGR_SQL_ORDER_BY_MAX_MEMORY": "2MB", "GDAL_NUM_THREADS": num_threads}
+    for sql in (
+        "SELECT * FROM test ORDER BY int_field",
+        "SELECT * FROM test ORDER BY str_field DESC, int_field",
+        "SELECT * FROM test ORDER BY int_field DESC OFFSET 10",
+    ):
+        expected = get_fids(sql)
+        assert get_fids(sql, options) == expected
+
+    assert get_fids("SELECT * FROM test ORDER BY FID", options) == list(range(40000))
+
+
+###############################################################################
+# Test ORDER BY ... LIMIT N [OFFSET M]
+
+
+def test_ogr_sql_order_by_limit():
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    values = [(i * 37) % 50 for i in range(1000)]
+    for v in values:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_field"] = v
+        lyr.CreateFeature(f)
+
+    for limit, offset in ((5, 0), (5, 3), (0, 0), (100, 10), (2000, 0), (10, 995)):
+        for order in ("ASC", "DESC"):
+            sign = 1 if order == "ASC" else -1
+            expected = sorted(range(1000), key=lambda i: sign * values[i])
+            sql = f"SELECT * FROM test ORDER BY int_field {order} LIMIT {limit} OFFSET {offset}"
+            with ds.ExecuteSQL(sql) as sql_lyr:
+                assert [f.GetFID() for f in sql_lyr] == expected[
+                    offset : offset + limit
+                ]
+
+    with ds.ExecuteSQL("SELECT * FROM test ORDER BY FID LIMIT 5 OFFSET 2") as sql_lyr:
+        assert [f.GetFID() for f in sql_lyr] == [2, 3, 4, 5, 6]
+
+
+###############################################################################
+# Test GROUP BY
+
+
+def test_ogr_sql_group_by():
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("real_field", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    for int_val, real_val, str_val in (
+        (1, 1.5, "a"),
+        (2, 2.5, "b"),
+        (1, 3.5, "a"),
+        (None, 4.5, "b"),
+        (2, None, "a"),
+        (1, 5.5, None),
+    ):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_field"] = int_val
+        f["real_field"] = real_val
+        f["str_field"] = str_val
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+        lyr.CreateFeature(f)
+
+    def get_rows(sql):
+        with ds.ExecuteSQL(sql) as sql_lyr:
+            return [
+                tuple(f.GetField(i) for i in range(f.GetFieldCount()))
+                for f in sql_lyr
+            ]
+
+    assert get_rows(
+        "SELECT int_field, COUNT(*), SUM(real_field), MIN(str_field) "
+        "FROM test GROUP BY int_field"
+    ) == [(1, 3, 10.5, "a"), (2, 2, 2.5, "a"), (None, 1, 4.5, "b")]
+
+    assert get_rows(
+        "SELECT str_field, int_field, COUNT(real_field) FROM test "
+        "GROUP BY str_field, int_field ORDER BY str_field DESC, int_field"
+    ) == [("b", None, 1), ("b", 2, 1), ("a", 1, 2), ("a", 2, 0), (None, 1, 1)]
+
+    assert get_rows(
+        "SELECT COUNT(DISTINCT int_field), AVG(real_field) FROM test "
+        "WHERE real_field > 2 GROUP BY str_field"
+    ) == [(1, 3.5), (1, 3.5), (1, 5.5)]
+
+    assert get_rows(
+        "SELECT int_field, COUNT(*) FROM test GROUP BY int_field "
+        "ORDER BY int_field LIMIT 2 OFFSET 1"
+    ) == [(1, 3), (2, 2)]
+
+    with ds.ExecuteSQL(
+        "SELECT str_field, COUNT(*) FROM test GROUP BY str_field"
+    ) as sql_lyr:
+        assert sql_lyr.GetGeomType() == ogr.wkbNone
+        assert sql_lyr.GetFeatureCount() == 3
+        assert sql_lyr.GetFeature(1)["str_field"] == "b"
+        sql_lyr.SetNextByIndex(2)
+        assert sql_lyr.GetNextFeature()["str_field"] is None
+
+    for sql, error_msg in (
+        (
+            "SELECT int_field, str_field FROM test GROUP BY int_field",
+            "must be one of the GROUP BY fields",
+        ),
+        (
+            "SELECT DISTINCT int_field FROM test GROUP BY int_field",
+            "not supported together with GROUP BY",
+        ),
+        (
+            "SELECT COUNT(*) FROM test GROUP BY non_existing",
+            "Unrecognized field name",
+        ),
+        (
+            "SELECT int_field FROM test GROUP BY int_field ORDER BY str_field",
+            "must be one of the GROUP BY fields",
+        ),
+        ("SELECT COUNT(*) FROM test GROUP BY FID", "Special field"),
+    ):
+        with pytest.raises(Exception, match=error_msg):
+            ds.ExecuteSQL(sql)
+
+
+###############################################################################
+# Test GROUP BY with a field named "group", and NaN grouping values
+
+
+def test_ogr_sql_group_by_group_field_and_nan():
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("group", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("real_field", ogr.OFTReal))
+    for group_val, real_val in (
+        (1, float("nan")),
+        (2, 2.5),
+        (1, 1.5),
+        (2, float("nan")),
+        (1, -1.5),
+    ):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["group"] = group_val
+        f["real_field"] = real_val
+        lyr.CreateFeature(f)
+
+    with ds.ExecuteSQL(
+        "SELECT group, COUNT(*) FROM test WHERE group > 0 GROUP BY group "
+        "ORDER BY group DESC"
+    ) as sql_lyr:
+        assert [(f["group"], f.GetField(1)) for f in sql_lyr] == [(2, 2), (1, 3)]
+
+    for order, expected in (("", [-1.5, 1.5, 2.5]), (" DESC", [2.5, 1.5, -1.5])):
+        with ds.ExecuteSQL(
+            "SELECT real_field, COUNT(*) FROM test GROUP BY real_field "
+            "ORDER BY real_field" + order
+        ) as sql_lyr:
+            rows = [(f["real_field"], f.GetField(1)) for f in sql_lyr]
+        # All NaN values are in the same group, sorted after the other values
+        nan_row = rows.pop(-1 if order == "" else 0)
+        assert math.isnan(nan_row[0]) and nan_row[1] == 2
+        assert rows == [(v, 1) for v in expected]
+
+
+###############################################################################
+# Test GROUP BY on a layer whose Arrow batches are aggregated in parallel
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_sql_group_by_arrow(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.gpkg")
+    src_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    with gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown) as ds:
+        for cur_ds in (src_ds, ds):
+            lyr = cur_ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+            lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+            lyr.CreateField(ogr.FieldDefn("int64_field", ogr.OFTInteger64))
+            lyr.CreateField(ogr.FieldDefn("real_field", ogr.OFTReal))
+            lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+            lyr.StartTransaction()
+            for i in range(100000):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                if i % 13:
+                    f["int_field"] = (i * 7919) % 100
+                f["int64_field"] = i
+                if i % 17:
+                    f["real_field"] = ((i * 31) % 1000) / 8
+                f["str_field"] = "val%d" % (i % 7)
+                f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} {i % 10})"))
+                lyr.CreateFeature(f)
+            lyr.CommitTransaction()
+
+    def get_rows(ds, sql):
+        with ds.ExecuteSQL(sql, dialect="OGRSQL") as sql_lyr:
+            return [
+                tuple(f.GetField(i) for i in range(f.GetFieldCount()))
+                for f in sql_lyr
+            ]
+
+    debug_msgs = []
+
+    def debug_handler(err_class, err_no, msg):
+        if err_class == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads), ogr.Open(filename) as ds:
+        for sql in (
+            "SELECT int_field, COUNT(*), SUM(int64_field), MIN(real_field), "
+            "MAX(str_field) FROM test GROUP BY int_field",
+            "SELECT str_field, real_field, COUNT(DISTINCT int_field) FROM test "
+            "GROUP BY str_field, real_field ORDER BY real_field DESC, str_field",
+            "SELECT str_field, COUNT(int_field), AVG(int64_field) FROM test "
+            "WHERE int_field > 50 GROUP BY str_field ORDER BY str_field",
+        ):
+            # The MEM layer has no fast Arrow stream, and is thus aggregated
+            # feature by feature
+            expected = get_rows(src_ds, sql)
+            debug_msgs.clear()
+            with gdaltest.error_handler(debug_handler), gdaltest.config_option(
+                "CPL_DEBUG", "ON"
+            ):
+                got = get_rows(ds, sql)
+            assert (
+                "GROUP BY: aggregating Arrow batches of layer 'test' with "
+                f"{num_threads} thread(s)" in debug_msgs
+            ), sql
+            assert got == expected, sql
+
+        sql = (
+            "SELECT int_field, STDDEV_POP(real_field), STDDEV_SAMP(int64_field) "
+            "FROM test GROUP BY int_field ORDER BY int_field"
+        )
+        got = get_rows(ds, sql)
+        expected = get_rows(src_ds, sql)
+        assert len(got) == len(expected)
+        for got_row, expected_row in zip(got, expected):
+            assert got_row[0] == expected_row[0]
+            assert got_row[1:] == pytest.approx(expected_row[1:], rel=1e-12)
+
+        # Only the fields referenced by the query are read
+        with ds.ExecuteSQL(
+            "SELECT str_field, COUNT(*) FROM test GROUP BY str_field",
+            dialect="OGRSQL",
+        ) as sql_lyr:
+            src_defn = ds.GetLayer("test").GetLayerDefn()
+            assert [
+                src_defn.GetFieldDefn(i).IsIgnored()
+                for i in range(src_defn.GetFieldCount())
+            ] == [True, True, True, False]
+            assert src_defn.IsGeometryIgnored()
+            assert sql_lyr.GetFeatureCount() == 7
+
+
 ###############################################################################
 # Test arithmetic expressions
 
@@ -66,6 +66,16 @@ def test_gdalalg_raster_info_mm_checksum():
     assert "Checksum=" in output_string
 
 
+def test_gdalalg_raster_info_cache_stats():
+    info = get_info_alg()
+    assert info.ParseRunAndFinalize(
+        ["--format=json", "--checksum", "--cache-stats", "data/utmsmall.tif"]
+    )
+    output_string = info["output-string"]
+    j = json.loads(output_string)
+    assert j["blockCache"]["misses"] > 0
+
+
 def test_gdalalg_raster_info_stats():
     info = get_info_alg()
     ds = gdal.Translate("", "../gcore/data/byte.tif", format="MEM")
@@ -394,3 +394,23 @@ def test_gdalinfo_lib_wkt_format(wkt_format, expected):
     ds = gdal.Open("../gcore/data/byte.tif")
     ret = gdal.Info(ds, options="-json -wkt_format " + wkt_format)
     assert ret["coordinateSystem"]["wkt"].startswith(expected)
+
+
+###############################################################################
+# Test -cache_stats
+
+
+def test_gdalinfo_lib_cache_stats():
+
+    ds = gdal.Open("../gcore/data/byte.tif")
+    ret = gdal.Info(ds, options="-json -checksum -cache_stats")
+    assert ret["blockCache"]["misses"] > 0
+    assert ret["blockCache"]["used"] > 0
+    assert ret["blockCache"]["dirty"] == 0
+    assert ret["blockCache"]["evictions"] >= 0
+
+    ret = gdal.Info(ds, options="-cache_stats")
+    assert "Block cache: used=" in ret
+
+    ret = gdal.Info(ds, format="json")
+    assert "blockCache" not in ret
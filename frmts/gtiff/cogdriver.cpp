@@ -1116,11 +1116,53 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
             double(nXSize) * nYSize * (nBands + (bHasMask ? 1 : 0)) * 4. / 3;
     }
 
+    // If the uncompressed overviews fit in the memory budget, generate them
+    // in an uncompressed in-memory file rather than in a compressed
+    // temporary file, which saves their compression, decompression and I/O.
+    bool bInMemoryOverviews = false;
+    if (bGenerateOvr || bGenerateMskOvr)
+    {
+        const double dfBytesPerPixel =
+            (bGenerateOvr ? double(nBands) * GDALGetDataTypeSizeBytes(
+                                                 poFirstBand->GetRasterDataType())
+                          : 0.0) +
+            (bGenerateMskOvr ? 1.0 : 0.0);
+        double dfOverviewsSize = 0;
+        for (const auto &[nOvrXSize, nOvrYSize] : asOverviewDims)
+            dfOverviewsSize += double(nOvrXSize) * nOvrYSize * dfBytesPerPixel;
+
+        const char *pszMaxSize =
+            CPLGetConfigOption("COG_IN_MEMORY_OVERVIEWS_MAX_SIZE", nullptr);
+        const double dfMaxSize =
+            pszMaxSize ? CPLAtof(pszMaxSize)
+                       : static_cast<double>(GDALGetCacheMax64() / 4);
+        // Temporary files are kept on disk when asked not to delete them,
+        // so that they can be inspected.
+        bInMemoryOverviews =
+            dfOverviewsSize <= dfMaxSize &&
+            CPLTestBool(CPLGetConfigOption("COG_DELETE_TEMP_FILES", "YES"));
+        CPLDebug("COG", "Overviews: " CPL_FRMT_GUIB " bytes, generated %s",
+                 static_cast<GUIntBig>(dfOverviewsSize),
+                 bInMemoryOverviews ? "in memory" : "in a temporary file");
+    }
+    const auto GetOverviewTmpFilename = [pszFilename, bInMemoryOverviews](
+                                            const char *pszExt)
+    {
+        if (bInMemoryOverviews)
+        {
+            return CPLString(VSIMemGenerateHiddenFilename(
+                CPLSPrintf("%s.%s", CPLGetFilename(pszFilename), pszExt)));
+        }
+        return GetTmpFilename(pszFilename, pszExt);
+    };
+
     CPLStringList aosOverviewOptions;
     aosOverviewOptions.SetNameValue(
         "COMPRESS",
-        CPLGetConfigOption("COG_TMP_COMPRESSION",  // only for debug purposes
-                           HasZSTDCompression() ? "ZSTD" : "LZW"));
+        bInMemoryOverviews
+            ? "NONE"
+            : CPLGetConfigOption("COG_TMP_COMPRESSION",  // only for debug
+                                 HasZSTDCompression() ? "ZSTD" : "LZW"));
     aosOverviewOptions.SetNameValue(
         "NUM_THREADS", CSLFetchNameValue(papszOptions, "NUM_THREADS"));
     aosOverviewOptions.SetNameValue("BIGTIFF", "YES");
@@ -1129,7 +1171,7 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
     if (bGenerateMskOvr)
     {
         CPLDebug("COG", "Generating overviews of the mask: start");
-        m_osTmpMskOverviewFilename = GetTmpFilename(pszFilename, "msk.ovr.tmp");
+        m_osTmpMskOverviewFilename = GetOverviewTmpFilename("msk.ovr.tmp");
         GDALRasterBand *poSrcMask = poFirstBand->GetMaskBand();
         const char *pszResampling = CSLFetchNameValueDef(
             papszOptions, "OVERVIEW_RESAMPLING",
@@ -1160,7 +1202,7 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
     if (bGenerateOvr)
     {
         CPLDebug("COG", "Generating overviews of the imagery: start");
-        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
+        m_osTmpOverviewFilename = GetOverviewTmpFilename("ovr.tmp");
         std::vector<GDALRasterBand *> apoSrcBands;
         for (int i = 0; i < nBands; i++)
             apoSrcBands.push_back(poCurDS->GetRasterBand(i + 1));
@@ -162,6 +162,9 @@ std::tuple<CPLErr, bool> GTiffDataset::Finalize()
     if (m_bIsFinalized)
         return std::tuple(CE_None, bDroppedRef);
 
+    // Wait for pending speculative decoding jobs
+    m_poReadAhead.reset();
+
     CPLErr eErr = CE_None;
     Crystalize();
 
@@ -16,8 +16,8 @@
 
 #include "gdal_pam.h"
 
+#include <deque>
 #include <mutex>
-#include <queue>
 
 #include "cpl_json.h"
 #include "cpl_mem_cache.h"
@@ -43,6 +43,7 @@ class GTiffJPEGOverviewBand;
 class GTiffJPEGOverviewDS;
 class GTiffRasterBand;
 class GTiffRGBABand;
+struct GTiffReadAhead;
 
 typedef struct
 {
@@ -146,6 +147,15 @@ class GTiffDataset final : public GDALPamDataset
     CPLVirtualMem *m_psVirtualMemIOMapping = nullptr;
     CPLWorkerThreadPool *m_poThreadPool = nullptr;
     std::unique_ptr<CPLJobQueue> m_poCompressQueue{};
+
+    struct ReadAheadDeleter
+    {
+        void operator()(GTiffReadAhead *psReadAhead) const;
+    };
+
+    // Pending speculative decoding of the window following the last one
+    // read by MultiThreadedRead(), when GTIFF_READ_AHEAD=YES
+    std::unique_ptr<GTiffReadAhead, ReadAheadDeleter> m_poReadAhead{};
     std::mutex m_oCompressThreadPoolMutex{};
 
     lru11::Cache<int, std::pair<vsi_l_offset, vsi_l_offset>>
@@ -188,6 +198,9 @@ class GTiffDataset final : public GDALPamDataset
     int m_nLastWrittenBlockId = -1;  // used for m_bStreamingOut
     int m_nRefBaseMapping = 0;
     int m_nDisableMultiThreadedRead = 0;
+    int m_nLastMultiThreadedReadXOff = -1;
+    int m_nLastMultiThreadedReadXSize = -1;
+    int m_nLastMultiThreadedReadYEnd = -1;
 
     struct JPEGOverviewVisibilitySetter
     {
@@ -267,8 +280,11 @@ class GTiffDataset final : public GDALPamDataset
     GDALMultiDomainMetadata m_oGTiffMDMD{};
 
     std::vector<GTiffCompressionJob> m_asCompressionJobs{};
-    std::queue<int> m_asQueueJobIdx{};  // queue of index of m_asCompressionJobs
+    std::deque<int> m_asQueueJobIdx{};  // queue of index of m_asCompressionJobs
                                         // being compressed in worker threads
+    // Whether compressed blocks may be written in completion order rather
+    // than submission order
+    bool m_bOutOfOrderCompressionWrites = false;
 
     bool m_bStreamingIn : 1;
     bool m_bStreamingOut : 1;
@@ -394,6 +410,9 @@ class GTiffDataset final : public GDALPamDataset
     void InitCreationOrOpenOptions(bool bUpdateMode, CSLConstList papszOptions);
     static void ThreadCompressionFunc(void *pData);
     void WaitCompletionForJobIdx(int i);
+    int GetReadyCompressionJobIdx(bool bAnyOrder);
+    void FlushReadyCompressionJobs();
+    bool CanWriteCompressedBlocksOutOfOrder() const;
     void WaitCompletionForBlock(int nBlockId);
     void WriteRawStripOrTile(int nStripOrTile, GByte *pabyCompressedBuffer,
                              GPtrDiff_t nCompressedBufferSize);
@@ -475,6 +494,17 @@ class GTiffDataset final : public GDALPamDataset
     bool CheckCOGLayout();
 
     static void ThreadDecompressionFunc(void *pData);
+    CPLErr MultiThreadedReadInternal(int nXOff, int nYOff, int nXSize,
+                                     int nYSize, void *pData,
+                                     GDALDataType eBufType, int nBandCount,
+                                     const int *panBandMap,
+                                     GSpacing nPixelSpace, GSpacing nLineSpace,
+                                     GSpacing nBandSpace,
+                                     GTiffReadAhead *psReadAhead);
+    void StartReadAhead(int nXOff, int nYOff, int nXSize, int nYSize,
+                        GDALDataType eBufType, int nBandCount,
+                        const int *panBandMap, GSpacing nPixelSpace,
+                        GSpacing nLineSpace, GSpacing nBandSpace);
 
     static GTIF *GTIFNew(TIFF *hTIFF);
 
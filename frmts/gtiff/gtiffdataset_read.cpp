@@ -366,6 +366,8 @@ struct GTiffDecompressContext
     bool bUseBIPOptim = false;
     bool bUseDeinterleaveOptimNoBlockCache = false;
     bool bUseDeinterleaveOptimBlockCache = false;
+    // Whether a whole strile can be decoded directly into pabyData
+    bool bDecodeInPlace = false;
     bool bIsTiled = false;
     bool bTIFFIsBigEndian = false;
     int nBlocksPerRow = 0;
@@ -394,6 +396,71 @@ struct GTiffDecompressJob
     vsi_l_offset nSize = 0;
 };
 
+/************************************************************************/
+/*                            GTiffReadAhead                            */
+/************************************************************************/
+
+// Speculative decoding, in the background, of the window that a sequential
+// reader is expected to request next from MultiThreadedRead().
+struct GTiffReadAhead
+{
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    GDALDataType eBufType = GDT_Unknown;
+    std::vector<int> anBandMap{};
+    GSpacing nPixelSpace = 0;
+    GSpacing nLineSpace = 0;
+    GSpacing nBandSpace = 0;
+    std::vector<GByte> abyBuffer{};
+
+    // Copies of TIFF tag values, since the TIFF directory may be changed
+    // while jobs are running.
+    std::vector<GByte> abyJPEGTable{};
+    std::vector<uint16_t> anExtraSamples{};
+
+    GTiffDecompressContext sContext{};
+    std::vector<GTiffDecompressJob> asJobs{};
+    std::unique_ptr<CPLJobQueue> poQueue{};
+
+    GTiffReadAhead() = default;
+
+    ~GTiffReadAhead()
+    {
+        if (poQueue)
+        {
+            {
+                // Pending jobs will return immediately
+                std::lock_guard<std::recursive_mutex> oLock(sContext.oMutex);
+                sContext.bSuccess = false;
+            }
+            poQueue->WaitCompletion();
+        }
+    }
+
+    bool Matches(int nXOffIn, int nYOffIn, int nXSizeIn, int nYSizeIn,
+                 GDALDataType eBufTypeIn, int nBandCount, const int *panBandMap,
+                 GSpacing nPixelSpaceIn, GSpacing nLineSpaceIn,
+                 GSpacing nBandSpaceIn) const
+    {
+        return nXOffIn == nXOff && nYOffIn == nYOff && nXSizeIn == nXSize &&
+               nYSizeIn == nYSize && eBufTypeIn == eBufType &&
+               nPixelSpaceIn == nPixelSpace && nLineSpaceIn == nLineSpace &&
+               (nBandCount == 1 || nBandSpaceIn == nBandSpace) &&
+               static_cast<size_t>(nBandCount) == anBandMap.size() &&
+               std::equal(anBandMap.begin(), anBandMap.end(), panBandMap);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GTiffReadAhead)
+};
+
+void GTiffDataset::ReadAheadDeleter::operator()(
+    GTiffReadAhead *psReadAhead) const
+{
+    delete psReadAhead;
+}
+
 /************************************************************************/
 /*                      ThreadDecompressionFunc()                       */
 /************************************************************************/
@@ -770,9 +837,29 @@ struct GTiffDecompressJob
         const size_t nReqSize = static_cast<size_t>(poDS->m_nBlockXSize) *
                                 nBlockReqYSize * nBandsPerStrile * nDTSize;
 
+        // Zero-copy case: the strile exactly matches a region of the target
+        // buffer, so decode directly into it.
+        const bool bDecodeInPlace =
+            psContext->bDecodeInPlace && nXOffsetInBlock == 0 &&
+            nYOffsetInBlock == 0 && nXSize == poDS->m_nBlockXSize &&
+            nYSize == nBlockReqYSize;
+
         GByte *pabyOutput;
         std::vector<GByte> abyOutput;
-        if (poDS->m_nCompression == COMPRESSION_NONE &&
+        if (bDecodeInPlace)
+        {
+            pabyOutput = pDstPtr;
+            if (poDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+                pabyOutput += psJob->iDstBandIdxSeparate * psContext->nBandSpace;
+            if (!TIFFReadFromUserBuffer(hTIFFTmp, 0, abyInput.data(),
+                                        abyInput.size(), pabyOutput,
+                                        nReqSize) &&
+                !poDS->m_bIgnoreReadErrors)
+            {
+                bRet = false;
+            }
+        }
+        else if (poDS->m_nCompression == COMPRESSION_NONE &&
             !TIFFIsByteSwapped(poDS->m_hTIFF) && abyInput.size() >= nReqSize &&
             (psContext->bSkipBlockCache || nBandsPerStrile > 1))
         {
@@ -808,6 +895,9 @@ struct GTiffDecompressJob
             return;
         }
 
+        if (bDecodeInPlace)
+            return;
+
         if (!psContext->bSkipBlockCache && nBandsPerStrile > 1)
         {
             // Copy pixel-interleaved all-band buffer to cached blocks
@@ -987,6 +1077,151 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                                        const int *panBandMap,
                                        GSpacing nPixelSpace,
                                        GSpacing nLineSpace, GSpacing nBandSpace)
+{
+    CPLErr eErr = CE_Failure;
+    bool bDone = false;
+    if (m_poReadAhead)
+    {
+        // Cancels the read-ahead if it does not match that request
+        const auto poReadAhead = std::move(m_poReadAhead);
+        if (poReadAhead->Matches(nXOff, nYOff, nXSize, nYSize, eBufType,
+                                 nBandCount, panBandMap, nPixelSpace,
+                                 nLineSpace, nBandSpace))
+        {
+            poReadAhead->poQueue->WaitCompletion();
+            if (poReadAhead->sContext.bSuccess)
+            {
+                poReadAhead->sContext.oErrorAccumulator.ReplayErrors();
+
+                const int nBufDTSize = GDALGetDataTypeSizeBytes(eBufType);
+                const GByte *pabySrc = poReadAhead->abyBuffer.data();
+                GByte *pabyDst = static_cast<GByte *>(pData);
+                const bool bPixelInterleaved =
+                    nPixelSpace == static_cast<GSpacing>(nBandCount) *
+                                       nBufDTSize &&
+                    (nBandCount == 1 || nBandSpace == nBufDTSize);
+                for (int y = 0; y < nYSize; ++y)
+                {
+                    if (bPixelInterleaved)
+                    {
+                        memcpy(pabyDst + y * nLineSpace,
+                               pabySrc + y * nLineSpace,
+                               static_cast<size_t>(nXSize) * nPixelSpace);
+                        continue;
+                    }
+                    for (int i = 0; i < nBandCount; ++i)
+                    {
+                        const GSpacing nOffset = y * nLineSpace + i * nBandSpace;
+                        GDALCopyWords64(pabySrc + nOffset, eBufType,
+                                        static_cast<int>(nPixelSpace),
+                                        pabyDst + nOffset, eBufType,
+                                        static_cast<int>(nPixelSpace), nXSize);
+                    }
+                }
+                eErr = CE_None;
+                bDone = true;
+            }
+        }
+    }
+
+    if (!bDone)
+    {
+        eErr = MultiThreadedReadInternal(
+            nXOff, nYOff, nXSize, nYSize, pData, eBufType, nBandCount,
+            panBandMap, nPixelSpace, nLineSpace, nBandSpace, nullptr);
+    }
+
+    const bool bSequential = nXOff == m_nLastMultiThreadedReadXOff &&
+                             nXSize == m_nLastMultiThreadedReadXSize &&
+                             nYOff == m_nLastMultiThreadedReadYEnd;
+    m_nLastMultiThreadedReadXOff = nXOff;
+    m_nLastMultiThreadedReadXSize = nXSize;
+    m_nLastMultiThreadedReadYEnd = nYOff + nYSize;
+    if (eErr == CE_None && bSequential)
+    {
+        StartReadAhead(nXOff, nYOff + nYSize, nXSize, nYSize, eBufType,
+                       nBandCount, panBandMap, nPixelSpace, nLineSpace,
+                       nBandSpace);
+    }
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                           StartReadAhead()                           */
+/************************************************************************/
+
+// Start decoding, in the background, the window that a sequential reader is
+// expected to request next.
+void GTiffDataset::StartReadAhead(int nXOff, int nYOff, int nXSize, int nYSize,
+                                  GDALDataType eBufType, int nBandCount,
+                                  const int *panBandMap, GSpacing nPixelSpace,
+                                  GSpacing nLineSpace, GSpacing nBandSpace)
+{
+    if (nYOff >= nRasterYSize || eAccess != GA_ReadOnly ||
+        !CPLTestBool(CPLGetConfigOption("GTIFF_READ_AHEAD", "NO")) ||
+        !VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF))->HasPRead() ||
+        nPixelSpace <= 0 || nLineSpace <= 0 ||
+        (nBandCount > 1 && nBandSpace <= 0))
+    {
+        return;
+    }
+    nYSize = std::min(nYSize, nRasterYSize - nYOff);
+
+    const int nBufDTSize = GDALGetDataTypeSizeBytes(eBufType);
+    const uint64_t nBufferSize =
+        static_cast<uint64_t>(nYSize - 1) * nLineSpace +
+        static_cast<uint64_t>(nXSize - 1) * nPixelSpace +
+        (nBandCount > 1 ? static_cast<uint64_t>(nBandCount - 1) * nBandSpace
+                        : 0) +
+        nBufDTSize;
+    // Do not let the read-ahead buffer compete too much with the block cache
+    if (nBufferSize > static_cast<uint64_t>(GDALGetCacheMax64() / 4))
+        return;
+
+    auto poReadAhead =
+        std::unique_ptr<GTiffReadAhead, ReadAheadDeleter>(new GTiffReadAhead());
+    try
+    {
+        poReadAhead->abyBuffer.resize(static_cast<size_t>(nBufferSize));
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    poReadAhead->nXOff = nXOff;
+    poReadAhead->nYOff = nYOff;
+    poReadAhead->nXSize = nXSize;
+    poReadAhead->nYSize = nYSize;
+    poReadAhead->eBufType = eBufType;
+    poReadAhead->anBandMap.assign(panBandMap, panBandMap + nBandCount);
+    poReadAhead->nPixelSpace = nPixelSpace;
+    poReadAhead->nLineSpace = nLineSpace;
+    poReadAhead->nBandSpace = nBandSpace;
+
+    // Errors will be reported, if they still occur, by the actual read
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    if (MultiThreadedReadInternal(nXOff, nYOff, nXSize, nYSize,
+                                  poReadAhead->abyBuffer.data(), eBufType,
+                                  nBandCount, poReadAhead->anBandMap.data(),
+                                  nPixelSpace, nLineSpace, nBandSpace,
+                                  poReadAhead.get()) == CE_None)
+    {
+        m_poReadAhead = std::move(poReadAhead);
+    }
+}
+
+/************************************************************************/
+/*                     MultiThreadedReadInternal()                      */
+/************************************************************************/
+
+// When psReadAhead is not null, jobs are submitted but not waited for, and
+// their state is stored in psReadAhead.
+CPLErr GTiffDataset::MultiThreadedReadInternal(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+    GDALDataType eBufType, int nBandCount, const int *panBandMap,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace,
+    GTiffReadAhead *psReadAhead)
 {
     auto poQueue = m_poThreadPool->CreateJobQueue();
     if (poQueue == nullptr)
@@ -1004,7 +1239,9 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         m_nPlanarConfig == PLANARCONFIG_CONTIG ? 1 : nBandCount;
     const int nBlocks = nXBlocks * nYBlocks * nStrilePerBlock;
 
-    GTiffDecompressContext sContext;
+    GTiffDecompressContext sLocalContext;
+    GTiffDecompressContext &sContext =
+        psReadAhead ? psReadAhead->sContext : sLocalContext;
     sContext.poHandle = VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF));
     sContext.bHasPRead =
         sContext.poHandle->HasPRead()
@@ -1038,7 +1275,15 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
     sContext.nPredictor = PREDICTOR_NONE;
     sContext.nBlocksPerRow = m_nBlocksPerRow;
 
-    if (m_bDirectIO)
+    if (psReadAhead)
+    {
+        // Jobs will run concurrently with the caller, so they must neither
+        // use the block cache nor seek in the file handle.
+        if (!sContext.bHasPRead)
+            return CE_Failure;
+        sContext.bSkipBlockCache = true;
+    }
+    else if (m_bDirectIO)
     {
         sContext.bSkipBlockCache = true;
     }
@@ -1104,6 +1349,28 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         }
     }
 
+    if (sContext.bSkipBlockCache && sContext.eBufType == sContext.eDT &&
+        nLineSpace == nPixelSpace * m_nBlockXSize)
+    {
+        if (m_nPlanarConfig == PLANARCONFIG_CONTIG && nBands > 1)
+        {
+            sContext.bDecodeInPlace =
+                nBandCount == nBands &&
+                nPixelSpace ==
+                    static_cast<GSpacing>(nBands) * sContext.nBufDTSize &&
+                nBandSpace == sContext.nBufDTSize;
+            for (int i = 0; sContext.bDecodeInPlace && i < nBands; ++i)
+            {
+                if (panBandMap[i] != i + 1)
+                    sContext.bDecodeInPlace = false;
+            }
+        }
+        else
+        {
+            sContext.bDecodeInPlace = nPixelSpace == sContext.nBufDTSize;
+        }
+    }
+
     // In contig mode, if only one band is requested, check if we have
     // enough cache to cache all bands.
     if (!sContext.bSkipBlockCache && nBands != 1 &&
@@ -1259,10 +1526,31 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         TIFFGetField(m_hTIFF, TIFFTAG_EXTRASAMPLES, &sContext.nExtraSampleCount,
                      &sContext.pExtraSamples);
     }
+    if (psReadAhead)
+    {
+        if (sContext.pJPEGTable)
+        {
+            const GByte *pabyJPEGTable =
+                static_cast<const GByte *>(sContext.pJPEGTable);
+            psReadAhead->abyJPEGTable.assign(
+                pabyJPEGTable, pabyJPEGTable + sContext.nJPEGTableSize);
+            sContext.pJPEGTable = psReadAhead->abyJPEGTable.data();
+        }
+        if (sContext.pExtraSamples)
+        {
+            psReadAhead->anExtraSamples.assign(
+                sContext.pExtraSamples,
+                sContext.pExtraSamples + sContext.nExtraSampleCount);
+            sContext.pExtraSamples = psReadAhead->anExtraSamples.data();
+        }
+    }
 
     // Create one job per tile/strip
     vsi_l_offset nFileSize = 0;
-    std::vector<GTiffDecompressJob> asJobs(nBlocks);
+    std::vector<GTiffDecompressJob> asLocalJobs;
+    std::vector<GTiffDecompressJob> &asJobs =
+        psReadAhead ? psReadAhead->asJobs : asLocalJobs;
+    asJobs.resize(nBlocks);
     std::vector<vsi_l_offset> anOffsets(nBlocks);
     std::vector<size_t> anSizes(nBlocks);
     int iJob = 0;
@@ -1403,6 +1691,9 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                             nAdviseReadTotalBytesLimit - nAdviseReadAccBytes &&
                         nYBlocks >= 2)
                     {
+                        if (psReadAhead)
+                            return CE_Failure;
+
                         const int nYOff2 =
                             (nBlockYStart + nYBlocks / 2) * m_nBlockYSize;
                         CPLDebugOnly("GTiff",
@@ -1417,18 +1708,18 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                         anSizes.clear();
                         poQueue.reset();
 
-                        CPLErr eErr = MultiThreadedRead(
+                        CPLErr eErr = MultiThreadedReadInternal(
                             nXOff, nYOff, nXSize, nYOff2 - nYOff, pData,
                             eBufType, nBandCount, panBandMap, nPixelSpace,
-                            nLineSpace, nBandSpace);
+                            nLineSpace, nBandSpace, nullptr);
                         if (eErr == CE_None)
                         {
-                            eErr = MultiThreadedRead(
+                            eErr = MultiThreadedReadInternal(
                                 nXOff, nYOff2, nXSize, nYOff + nYSize - nYOff2,
                                 static_cast<GByte *>(pData) +
                                     (nYOff2 - nYOff) * nLineSpace,
                                 eBufType, nBandCount, panBandMap, nPixelSpace,
-                                nLineSpace, nBandSpace);
+                                nLineSpace, nBandSpace, nullptr);
                         }
                         return eErr;
                     }
@@ -1452,6 +1743,16 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                                           anSizes.data());
         }
 
+        if (psReadAhead)
+        {
+            for (auto &sJob : asJobs)
+            {
+                poQueue->SubmitJob(ThreadDecompressionFunc, &sJob);
+            }
+            psReadAhead->poQueue = std::move(poQueue);
+            return CE_None;
+        }
+
         // We need to do that as threads will access the block cache
         TemporarilyDropReadWriteLock();
 
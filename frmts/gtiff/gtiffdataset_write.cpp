@@ -925,10 +925,18 @@ void GTiffDataset::InitCompressionThreads(bool bUpdateMode,
 
             if (m_poCompressQueue != nullptr)
             {
+                m_bOutOfOrderCompressionWrites = CPLTestBool(
+                    CPLGetConfigOption("GTIFF_OUT_OF_ORDER_WRITES", "NO"));
+
                 // Add a margin of an extra job w.r.t thread number
                 // so as to optimize compression time (enables the main
                 // thread to do boring I/O while all CPUs are working).
-                m_asCompressionJobs.resize(nThreads + 1);
+                // When blocks can be written in completion order, use a
+                // larger margin so that a slow job does not prevent other
+                // threads from starting new ones.
+                m_asCompressionJobs.resize(
+                    m_bOutOfOrderCompressionWrites ? 2 * nThreads
+                                                   : nThreads + 1);
                 memset(&m_asCompressionJobs[0], 0,
                        m_asCompressionJobs.size() *
                            sizeof(GTiffCompressionJob));
@@ -1261,7 +1269,67 @@ void GTiffDataset::WaitCompletionForJobIdx(int i)
         asJobs[i].bReady = false;
     }
     asJobs[i].nStripOrTile = -1;
-    oQueue.pop();
+    if (oQueue.front() == i)
+        oQueue.pop_front();
+    else
+        oQueue.erase(std::find(oQueue.begin(), oQueue.end(), i));
+}
+
+/************************************************************************/
+/*                 CanWriteCompressedBlocksOutOfOrder()                 */
+/************************************************************************/
+
+bool GTiffDataset::CanWriteCompressedBlocksOutOfOrder() const
+{
+    const auto poMainDS = m_poBaseDS ? m_poBaseDS : this;
+    // Optimized layouts require blocks to be written in a given order
+    return poMainDS->m_bOutOfOrderCompressionWrites &&
+           !poMainDS->m_bLayoutIFDSBeforeData &&
+           !poMainDS->m_bBlockOrderRowMajor &&
+           !poMainDS->m_bLeaderSizeAsUInt4 &&
+           !poMainDS->m_bTrailerRepeatedLast4BytesRepeated &&
+           !poMainDS->m_bMaskInterleavedWithImagery;
+}
+
+/************************************************************************/
+/*                     GetReadyCompressionJobIdx()                      */
+/************************************************************************/
+
+// Returns the index of a job whose compression is completed, and that can
+// be written now, or -1.
+int GTiffDataset::GetReadyCompressionJobIdx(bool bAnyOrder)
+{
+    auto poMainDS = m_poBaseDS ? m_poBaseDS : this;
+    const auto &oQueue = poMainDS->m_asQueueJobIdx;
+    const auto &asJobs = poMainDS->m_asCompressionJobs;
+
+    std::lock_guard oLock(poMainDS->m_oCompressThreadPoolMutex);
+    if (oQueue.empty())
+        return -1;
+    if (!bAnyOrder)
+        return asJobs[oQueue.front()].bReady ? oQueue.front() : -1;
+    for (const int i : oQueue)
+    {
+        if (asJobs[i].bReady)
+            return i;
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                     FlushReadyCompressionJobs()                      */
+/************************************************************************/
+
+// Writes blocks whose compression is completed, without waiting for the
+// others.
+void GTiffDataset::FlushReadyCompressionJobs()
+{
+    const bool bAnyOrder = CanWriteCompressedBlocksOutOfOrder();
+    int i;
+    while ((i = GetReadyCompressionJobIdx(bAnyOrder)) >= 0)
+    {
+        WaitCompletionForJobIdx(i);
+    }
 }
 
 /************************************************************************/
@@ -1400,12 +1468,28 @@ bool GTiffDataset::SubmitCompressionJob(int nStripOrTile, GByte *pabyData,
     auto &oQueue = poMainDS->m_asQueueJobIdx;
     auto &asJobs = poMainDS->m_asCompressionJobs;
 
+    // Write blocks that are already compressed, so that I/O is done while
+    // worker threads are busy, rather than when the queue is full.
+    FlushReadyCompressionJobs();
+
     int nNextCompressionJobAvail = -1;
 
     if (oQueue.size() == asJobs.size())
     {
         CPLAssert(!oQueue.empty());
-        nNextCompressionJobAvail = oQueue.front();
+        if (CanWriteCompressedBlocksOutOfOrder())
+        {
+            // Wait for the first job to complete, whichever it is
+            while ((nNextCompressionJobAvail =
+                        GetReadyCompressionJobIdx(true)) < 0)
+            {
+                poQueue->GetPool()->WaitEvent();
+            }
+        }
+        else
+        {
+            nNextCompressionJobAvail = oQueue.front();
+        }
         WaitCompletionForJobIdx(nNextCompressionJobAvail);
     }
     else
@@ -1427,7 +1511,7 @@ bool GTiffDataset::SubmitCompressionJob(int nStripOrTile, GByte *pabyData,
     if (bOK)
     {
         poQueue->SubmitJob(ThreadCompressionFunc, psJob);
-        oQueue.push(nNextCompressionJobAvail);
+        oQueue.push_back(nNextCompressionJobAvail);
     }
 
     return bOK;
@@ -18,6 +18,7 @@
 
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
+#include "cpl_quad_tree.h"
 #include "gdal_driver.h"
 #include "gdal_multidim.h"
 #include "gdal_pam.h"
@@ -262,6 +263,7 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
     friend class VRTDerivedRasterBand;
     friend class VRTSimpleSource;
     friend struct VRTSourcedRasterBandRasterIOJob;
+    friend struct VRTSourcedRasterBandTileRasterIOJob;
     friend VRTDatasetH CPL_STDCALL VRTCreate(int nXSize, int nYSize);
 
     std::vector<gdal::GCP> m_asGCPs{};
@@ -954,6 +956,32 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
     bool IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(
         bool bAllowMaxValAdjustment) const;
 
+    // Spatial index of the destination windows of the simple sources, built
+    // lazily by GetCandidateSources() on bands with many sources.
+    mutable CPLQuadTree *m_hSourceIndex = nullptr;
+    // Sources not in m_hSourceIndex (not simple sources, or without
+    // destination window), that are always candidates.
+    mutable std::vector<int> m_anNonIndexedSources{};
+    // State of m_papoSources when m_hSourceIndex was built, to detect
+    // modifications not done through AddSource().
+    mutable size_t m_nIndexedSourceCount = 0;
+    mutable const void *m_pIndexedSources = nullptr;
+
+    void BuildSourceIndex() const;
+    void InvalidateSourceIndex() const;
+
+    bool
+    CanTileMultiThreadRasterIO(int nXOff, int nYOff, int nXSize, int nYSize,
+                               int nBufXSize, int nBufYSize,
+                               const GDALRasterIOExtraArg *psExtraArg,
+                               std::vector<int> &anContributingSources) const;
+
+    CPLErr TiledMultiThreadedRasterIO(
+        int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+        GDALDataType eBufType, GSpacing nPixelSpace, GSpacing nLineSpace,
+        GDALRasterIOExtraArg *psExtraArg,
+        const std::vector<int> &anContributingSources, int nMaxThreads);
+
     CPL_DISALLOW_COPY_ASSIGN(VRTSourcedRasterBand)
 
   protected:
@@ -1022,6 +1050,9 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
 
     CPLErr AddSource(std::unique_ptr<VRTSource>);
 
+    void GetCandidateSources(double dfXOff, double dfYOff, double dfXSize,
+                             double dfYSize, std::vector<int> &anSources) const;
+
     CPLErr AddSource(VRTSource *);
 
     CPLErr AddSimpleSource(const char *pszFilename, int nBand,
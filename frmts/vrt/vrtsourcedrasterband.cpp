@@ -23,7 +23,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <mutex>
+#include <numeric>
 #include <set>
 #include <string>
 
@@ -315,8 +317,9 @@ bool VRTSourcedRasterBand::CanMultiThreadRasterIO(
     std::set<std::string> oSetDSName;
 
     nContributingSources = 0;
-    for (int iSource = 0; iSource < static_cast<int>(m_papoSources.size());
-         iSource++)
+    std::vector<int> anCandidateSources;
+    GetCandidateSources(dfXOff, dfYOff, dfXSize, dfYSize, anCandidateSources);
+    for (const int iSource : anCandidateSources)
     {
         const auto &poSource = m_papoSources[iSource];
         if (!poSource->IsSimpleSource())
@@ -409,6 +412,49 @@ bool VRTSourcedRasterBand::CanMultiThreadRasterIO(
     return bRet;
 }
 
+/************************************************************************/
+/*                     CanTileMultiThreadRasterIO()                     */
+/************************************************************************/
+
+// Whether a request, that cannot be split by source because sources overlap
+// or share a dataset, can be split into tiles composited in parallel.
+
+bool VRTSourcedRasterBand::CanTileMultiThreadRasterIO(
+    int nXOff, int nYOff, int nXSize, int nYSize, int nBufXSize,
+    int nBufYSize, const GDALRasterIOExtraArg *psExtraArg,
+    std::vector<int> &anContributingSources) const
+{
+    anContributingSources.clear();
+
+    // Tiles of the buffer must map exactly to tiles of the raster
+    if (nBufXSize != nXSize || nBufYSize != nYSize)
+        return false;
+    if (psExtraArg->bFloatingPointWindowValidity &&
+        (psExtraArg->dfXOff != nXOff || psExtraArg->dfYOff != nYOff ||
+         psExtraArg->dfXSize != nXSize || psExtraArg->dfYSize != nYSize))
+    {
+        return false;
+    }
+
+    std::vector<int> anCandidateSources;
+    GetCandidateSources(nXOff, nYOff, nXSize, nYSize, anCandidateSources);
+    for (const int iSource : anCandidateSources)
+    {
+        const auto &poSource = m_papoSources[iSource];
+        if (!poSource->IsSimpleSource())
+            return false;
+        const auto poSimpleSource =
+            cpl::down_cast<VRTSimpleSource *>(poSource.get());
+        // A source without destination window covers the whole raster
+        if (!poSimpleSource->IsDstWinSet())
+            return false;
+        if (poSimpleSource->DstWindowIntersects(nXOff, nYOff, nXSize, nYSize))
+            anContributingSources.push_back(iSource);
+    }
+
+    return anContributingSources.size() > 1;
+}
+
 /************************************************************************/
 /*                   VRTSourcedRasterBandRasterIOJob                    */
 /************************************************************************/
@@ -485,6 +531,88 @@ void VRTSourcedRasterBandRasterIOJob::Func(void *pData)
     ++(*psJob->pnCompletedJobs);
 }
 
+/************************************************************************/
+/*                 VRTSourcedRasterBandTileRasterIOJob                  */
+/************************************************************************/
+
+/** Structure used to declare a threaded job to satisfy IRasterIO()
+ * on a given tile of the request.
+ */
+struct VRTSourcedRasterBandTileRasterIOJob
+{
+    std::atomic<int> *pnCompletedJobs = nullptr;
+    std::atomic<bool> *pbSuccess = nullptr;
+    VRTDataset::QueueWorkingStates *poQueueWorkingStates = nullptr;
+    CPLErrorAccumulator *poErrorAccumulator = nullptr;
+
+    GDALDataType eVRTBandDataType = GDT_Unknown;
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    void *pData = nullptr;
+    GDALDataType eBufType = GDT_Unknown;
+    GSpacing nPixelSpace = 0;
+    GSpacing nLineSpace = 0;
+    GDALRasterIOExtraArg sExtraArg{};
+
+    // Sources intersecting the tile, in their order in the VRT, with the
+    // mutex serializing accesses to their dataset.
+    std::vector<std::pair<VRTSimpleSource *, std::mutex *>> aoSources{};
+
+    static void Func(void *pData);
+};
+
+/************************************************************************/
+/*             VRTSourcedRasterBandTileRasterIOJob::Func()              */
+/************************************************************************/
+
+void VRTSourcedRasterBandTileRasterIOJob::Func(void *pData)
+{
+    auto psJob = std::unique_ptr<VRTSourcedRasterBandTileRasterIOJob>(
+        static_cast<VRTSourcedRasterBandTileRasterIOJob *>(pData));
+    if (*psJob->pbSuccess)
+    {
+        psJob->sExtraArg.pfnProgress = nullptr;
+        psJob->sExtraArg.pProgressData = nullptr;
+
+        std::unique_ptr<VRTSource::WorkingState> poWorkingState;
+        {
+            std::lock_guard oLock(psJob->poQueueWorkingStates->oMutex);
+            poWorkingState =
+                std::move(psJob->poQueueWorkingStates->oStates.back());
+            psJob->poQueueWorkingStates->oStates.pop_back();
+            CPLAssert(poWorkingState.get());
+        }
+
+        auto oAccumulator = psJob->poErrorAccumulator->InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oAccumulator);
+
+        for (const auto &[poSource, poMutex] : psJob->aoSources)
+        {
+            std::lock_guard oLock(*poMutex);
+            if (poSource->RasterIO(
+                    psJob->eVRTBandDataType, psJob->nXOff, psJob->nYOff,
+                    psJob->nXSize, psJob->nYSize, psJob->pData, psJob->nXSize,
+                    psJob->nYSize, psJob->eBufType, psJob->nPixelSpace,
+                    psJob->nLineSpace, &psJob->sExtraArg,
+                    *(poWorkingState.get())) != CE_None)
+            {
+                *psJob->pbSuccess = false;
+                break;
+            }
+        }
+
+        {
+            std::lock_guard oLock(psJob->poQueueWorkingStates->oMutex);
+            psJob->poQueueWorkingStates->oStates.push_back(
+                std::move(poWorkingState));
+        }
+    }
+
+    ++(*psJob->pnCompletedJobs);
+}
+
 /************************************************************************/
 /*                MayMultiBlockReadingBeMultiThreaded()                 */
 /************************************************************************/
@@ -708,12 +836,14 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
 
     int nContributingSources = 0;
     int nMaxThreads = 0;
+    std::vector<int> anContributingSources;
     constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_IO = 1000 * 1000;
-    if (l_poDS &&
-        (static_cast<int64_t>(nBufXSize) * nBufYSize >=
-             MINIMUM_PIXEL_COUNT_FOR_THREADED_IO ||
-         static_cast<int64_t>(nXSize) * nYSize >=
-             MINIMUM_PIXEL_COUNT_FOR_THREADED_IO) &&
+    const bool bLargeEnoughForThreadedIO =
+        static_cast<int64_t>(nBufXSize) * nBufYSize >=
+            MINIMUM_PIXEL_COUNT_FOR_THREADED_IO ||
+        static_cast<int64_t>(nXSize) * nYSize >=
+            MINIMUM_PIXEL_COUNT_FOR_THREADED_IO;
+    if (l_poDS && bLargeEnoughForThreadedIO &&
         CanMultiThreadRasterIO(dfXOff, dfYOff, dfXSize, dfYSize,
                                nContributingSources) &&
         nContributingSources > 1 &&
@@ -749,10 +879,15 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
             }
         }
 
+        std::vector<int> anCandidateSources;
+        GetCandidateSources(dfXOff, dfYOff, dfXSize, dfYSize,
+                            anCandidateSources);
+
         auto oQueue = psThreadPool->CreateJobQueue();
         std::atomic<int> nCompletedJobs = 0;
-        for (auto &poSource : m_papoSources)
+        for (const int iSource : anCandidateSources)
         {
+            const auto &poSource = m_papoSources[iSource];
             if (!poSource->IsSimpleSource())
                 continue;
             auto poSimpleSource =
@@ -804,23 +939,37 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
         errorAccumulator.ReplayErrors();
         eErr = bSuccess ? CE_None : CE_Failure;
     }
+    else if (l_poDS && bLargeEnoughForThreadedIO &&
+             CanTileMultiThreadRasterIO(nXOff, nYOff, nXSize, nYSize,
+                                        nBufXSize, nBufYSize, psExtraArg,
+                                        anContributingSources) &&
+             (nMaxThreads = VRTDataset::GetNumThreads(l_poDS)) > 1)
+    {
+        l_poDS->m_bMultiThreadedRasterIOLastUsed = true;
+        eErr = TiledMultiThreadedRasterIO(
+            nXOff, nYOff, nXSize, nYSize, pData, eBufType, nPixelSpace,
+            nLineSpace, psExtraArg, anContributingSources, nMaxThreads);
+    }
     else
     {
         GDALProgressFunc const pfnProgressGlobal = psExtraArg->pfnProgress;
         void *const pProgressDataGlobal = psExtraArg->pProgressData;
 
         VRTSource::WorkingState oWorkingState;
-        const int nSources = static_cast<int>(m_papoSources.size());
-        for (int iSource = 0; eErr == CE_None && iSource < nSources; iSource++)
+        std::vector<int> anCandidateSources;
+        GetCandidateSources(dfXOff, dfYOff, dfXSize, dfYSize,
+                            anCandidateSources);
+        const int nSources = static_cast<int>(anCandidateSources.size());
+        for (int i = 0; eErr == CE_None && i < nSources; i++)
         {
             psExtraArg->pfnProgress = GDALScaledProgress;
             psExtraArg->pProgressData = GDALCreateScaledProgress(
-                1.0 * iSource / nSources, 1.0 * (iSource + 1) / nSources,
+                1.0 * i / nSources, 1.0 * (i + 1) / nSources,
                 pfnProgressGlobal, pProgressDataGlobal);
             if (psExtraArg->pProgressData == nullptr)
                 psExtraArg->pfnProgress = nullptr;
 
-            eErr = m_papoSources[iSource]->RasterIO(
+            eErr = m_papoSources[anCandidateSources[i]]->RasterIO(
                 eDataType, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
                 nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg,
                 l_poDS ? l_poDS->m_oWorkingState : oWorkingState);
@@ -840,6 +989,154 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
     return eErr;
 }
 
+/************************************************************************/
+/*                     TiledMultiThreadedRasterIO()                     */
+/************************************************************************/
+
+// Splits the request into tiles processed in parallel. Each tile composites
+// the sources intersecting it in their order in the VRT, so that the last
+// one still wins where they overlap.
+
+CPLErr VRTSourcedRasterBand::TiledMultiThreadedRasterIO(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+    GDALDataType eBufType, GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg,
+    const std::vector<int> &anContributingSources, int nMaxThreads)
+{
+    auto l_poDS = cpl::down_cast<VRTDataset *>(poDS);
+    l_poDS->m_oMapSharedSources.InitMutex();
+
+    // Sources reading the same dataset share a mutex, as a dataset cannot be
+    // used concurrently from several threads.
+    std::map<std::string, size_t> oMapDSNameToMutexIdx;
+    std::vector<size_t> anMutexIdx(m_papoSources.size());
+    for (const int iSource : anContributingSources)
+    {
+        const auto poSimpleSource =
+            cpl::down_cast<VRTSimpleSource *>(m_papoSources[iSource].get());
+        anMutexIdx[iSource] =
+            oMapDSNameToMutexIdx
+                .insert({poSimpleSource->m_osSrcDSName,
+                         oMapDSNameToMutexIdx.size()})
+                .first->second;
+    }
+    std::vector<std::mutex> aoMutexes(oMapDSNameToMutexIdx.size());
+
+    constexpr int TILE_SIZE = 512;
+    const int nTilesX = cpl::div_round_up(nXSize, TILE_SIZE);
+    const int nTilesY = cpl::div_round_up(nYSize, TILE_SIZE);
+
+    CPLErrorAccumulator errorAccumulator;
+    std::atomic<bool> bSuccess = true;
+    CPLWorkerThreadPool *psThreadPool = GDALGetGlobalThreadPool(nMaxThreads);
+    const int nThreads =
+        static_cast<int>(std::min<int64_t>(static_cast<int64_t>(nTilesX) *
+                                               nTilesY,
+                                           psThreadPool->GetThreadCount()));
+    CPLDebugOnly("VRT",
+                 "IRasterIO(): use multi-threaded compositing of "
+                 "%d x %d tiles. Using %d threads",
+                 nTilesX, nTilesY, nThreads);
+
+    {
+        std::lock_guard oLock(l_poDS->m_oQueueWorkingStates.oMutex);
+        if (l_poDS->m_oQueueWorkingStates.oStates.size() <
+            static_cast<size_t>(nThreads))
+        {
+            l_poDS->m_oQueueWorkingStates.oStates.resize(nThreads);
+        }
+        for (int i = 0; i < nThreads; ++i)
+        {
+            if (!l_poDS->m_oQueueWorkingStates.oStates[i])
+                l_poDS->m_oQueueWorkingStates.oStates[i] =
+                    std::make_unique<VRTSource::WorkingState>();
+        }
+    }
+
+    auto oQueue = psThreadPool->CreateJobQueue();
+    std::atomic<int> nCompletedJobs = 0;
+    int nJobs = 0;
+    std::vector<int> anTileSources;
+    for (int iTileY = 0; bSuccess && iTileY < nTilesY; ++iTileY)
+    {
+        for (int iTileX = 0; bSuccess && iTileX < nTilesX; ++iTileX)
+        {
+            const int nTileXOff = nXOff + iTileX * TILE_SIZE;
+            const int nTileYOff = nYOff + iTileY * TILE_SIZE;
+            const int nTileXSize =
+                std::min(TILE_SIZE, nXOff + nXSize - nTileXOff);
+            const int nTileYSize =
+                std::min(TILE_SIZE, nYOff + nYSize - nTileYOff);
+
+            GetCandidateSources(nTileXOff, nTileYOff, nTileXSize, nTileYSize,
+                                anTileSources);
+            anTileSources.erase(
+                std::remove_if(
+                    anTileSources.begin(), anTileSources.end(),
+                    [this, nTileXOff, nTileYOff, nTileXSize,
+                     nTileYSize](int iSource)
+                    {
+                        return !cpl::down_cast<VRTSimpleSource *>(
+                                    m_papoSources[iSource].get())
+                                    ->DstWindowIntersects(nTileXOff, nTileYOff,
+                                                          nTileXSize,
+                                                          nTileYSize);
+                    }),
+                anTileSources.end());
+            // The buffer has already been initialized
+            if (anTileSources.empty())
+                continue;
+
+            auto psJob = new VRTSourcedRasterBandTileRasterIOJob();
+            psJob->pbSuccess = &bSuccess;
+            psJob->pnCompletedJobs = &nCompletedJobs;
+            psJob->poQueueWorkingStates = &(l_poDS->m_oQueueWorkingStates);
+            psJob->poErrorAccumulator = &errorAccumulator;
+            psJob->eVRTBandDataType = eDataType;
+            psJob->nXOff = nTileXOff;
+            psJob->nYOff = nTileYOff;
+            psJob->nXSize = nTileXSize;
+            psJob->nYSize = nTileYSize;
+            psJob->pData = static_cast<GByte *>(pData) +
+                           (nTileYOff - nYOff) * nLineSpace +
+                           (nTileXOff - nXOff) * nPixelSpace;
+            psJob->eBufType = eBufType;
+            psJob->nPixelSpace = nPixelSpace;
+            psJob->nLineSpace = nLineSpace;
+            psJob->sExtraArg = *psExtraArg;
+            psJob->sExtraArg.bFloatingPointWindowValidity = FALSE;
+            for (const int iSource : anTileSources)
+            {
+                psJob->aoSources.emplace_back(
+                    cpl::down_cast<VRTSimpleSource *>(
+                        m_papoSources[iSource].get()),
+                    &aoMutexes[anMutexIdx[iSource]]);
+            }
+
+            if (!oQueue->SubmitJob(VRTSourcedRasterBandTileRasterIOJob::Func,
+                                   psJob))
+            {
+                delete psJob;
+                bSuccess = false;
+                break;
+            }
+            ++nJobs;
+        }
+    }
+
+    while (oQueue->WaitEvent())
+    {
+        if (psExtraArg->pfnProgress && nJobs > 0)
+        {
+            psExtraArg->pfnProgress(double(nCompletedJobs.load()) / nJobs, "",
+                                    psExtraArg->pProgressData);
+        }
+    }
+
+    errorAccumulator.ReplayErrors();
+    return bSuccess ? CE_None : CE_Failure;
+}
+
 /************************************************************************/
 /*                       IGetDataCoverageStatus()                       */
 /************************************************************************/
@@ -914,8 +1211,11 @@ int VRTSourcedRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff,
         poPolyNonCoveredBySources->addRingDirectly(poLR.release());
     }
 
-    for (auto &poSource : m_papoSources)
+    std::vector<int> anCandidateSources;
+    GetCandidateSources(nXOff, nYOff, nXSize, nYSize, anCandidateSources);
+    for (const int iSource : anCandidateSources)
     {
+        const auto &poSource = m_papoSources[iSource];
         if (!poSource->IsSimpleSource())
         {
             return GDAL_DATA_COVERAGE_STATUS_UNIMPLEMENTED |
@@ -2307,10 +2607,127 @@ CPLErr VRTSourcedRasterBand::AddSource(std::unique_ptr<VRTSource> poNewSource)
     }
 
     m_papoSources.push_back(std::move(poNewSource));
+    InvalidateSourceIndex();
 
     return CE_None;
 }
 
+/************************************************************************/
+/*                        GetCandidateSources()                         */
+/************************************************************************/
+
+/** Returns the indices, in increasing order, of the sources that may
+ * intersect a window (in raster coordinates).
+ *
+ * On bands with many sources, a spatial index of their destination windows
+ * is used, so that the cost is proportional to the number of intersecting
+ * sources rather than the total number of sources.
+ */
+void VRTSourcedRasterBand::GetCandidateSources(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    std::vector<int> &anSources) const
+{
+    anSources.clear();
+
+    constexpr size_t MIN_SOURCES_FOR_INDEX = 64;
+    if (m_papoSources.size() < MIN_SOURCES_FOR_INDEX)
+    {
+        anSources.resize(m_papoSources.size());
+        std::iota(anSources.begin(), anSources.end(), 0);
+        return;
+    }
+
+    if (m_hSourceIndex &&
+        (m_nIndexedSourceCount != m_papoSources.size() ||
+         m_pIndexedSources != m_papoSources.data()))
+    {
+        InvalidateSourceIndex();
+    }
+    if (!m_hSourceIndex)
+        BuildSourceIndex();
+
+    CPLRectObj sAoi;
+    sAoi.minx = dfXOff;
+    sAoi.miny = dfYOff;
+    sAoi.maxx = dfXOff + dfXSize;
+    sAoi.maxy = dfYOff + dfYSize;
+    int nFeatureCount = 0;
+    void **pahFeatures =
+        CPLQuadTreeSearch(m_hSourceIndex, &sAoi, &nFeatureCount);
+    anSources.reserve(nFeatureCount + m_anNonIndexedSources.size());
+    for (int i = 0; i < nFeatureCount; ++i)
+    {
+        anSources.push_back(
+            static_cast<int>(reinterpret_cast<uintptr_t>(pahFeatures[i])));
+    }
+    CPLFree(pahFeatures);
+    anSources.insert(anSources.end(), m_anNonIndexedSources.begin(),
+                     m_anNonIndexedSources.end());
+    std::sort(anSources.begin(), anSources.end());
+}
+
+/************************************************************************/
+/*                          BuildSourceIndex()                          */
+/************************************************************************/
+
+void VRTSourcedRasterBand::BuildSourceIndex() const
+{
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = 0;
+    sGlobalBounds.miny = 0;
+    sGlobalBounds.maxx = nRasterXSize;
+    sGlobalBounds.maxy = nRasterYSize;
+    m_hSourceIndex = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    m_anNonIndexedSources.clear();
+
+    for (int iSource = 0; iSource < static_cast<int>(m_papoSources.size());
+         iSource++)
+    {
+        const auto &poSource = m_papoSources[iSource];
+        if (!poSource->IsSimpleSource() ||
+            !cpl::down_cast<VRTSimpleSource *>(poSource.get())->IsDstWinSet())
+        {
+            m_anNonIndexedSources.push_back(iSource);
+            continue;
+        }
+        double dfSourceXOff;
+        double dfSourceYOff;
+        double dfSourceXSize;
+        double dfSourceYSize;
+        cpl::down_cast<VRTSimpleSource *>(poSource.get())
+            ->GetDstWindow(dfSourceXOff, dfSourceYOff, dfSourceXSize,
+                           dfSourceYSize);
+        CPLRectObj sSourceBounds;
+        sSourceBounds.minx = dfSourceXOff;
+        sSourceBounds.miny = dfSourceYOff;
+        sSourceBounds.maxx = dfSourceXOff + dfSourceXSize;
+        sSourceBounds.maxy = dfSourceYOff + dfSourceYSize;
+        CPLQuadTreeInsertWithBounds(
+            m_hSourceIndex,
+            reinterpret_cast<void *>(static_cast<uintptr_t>(iSource)),
+            &sSourceBounds);
+    }
+
+    m_nIndexedSourceCount = m_papoSources.size();
+    m_pIndexedSources = m_papoSources.data();
+}
+
+/************************************************************************/
+/*                       InvalidateSourceIndex()                        */
+/************************************************************************/
+
+void VRTSourcedRasterBand::InvalidateSourceIndex() const
+{
+    if (m_hSourceIndex)
+    {
+        CPLQuadTreeDestroy(m_hSourceIndex);
+        m_hSourceIndex = nullptr;
+    }
+    m_anNonIndexedSources.clear();
+    m_nIndexedSourceCount = 0;
+    m_pIndexedSources = nullptr;
+}
+
 /*! @endcond */
 
 /************************************************************************/
@@ -3131,6 +3548,7 @@ CPLErr VRTSourcedRasterBand::SetMetadata(CSLConstList papszNewMD,
         if (EQUAL(pszDomain, "vrt_sources"))
         {
             m_papoSources.clear();
+            InvalidateSourceIndex();
         }
 
         for (const char *const pszMDItem :
@@ -3186,6 +3604,8 @@ int VRTSourcedRasterBand::CloseDependentDatasets()
 {
     int ret = VRTRasterBand::CloseDependentDatasets();
 
+    InvalidateSourceIndex();
+
     if (m_papoSources.empty())
         return ret;
 
@@ -3381,6 +3801,7 @@ void VRTSourcedRasterBand::RemoveCoveredSources(CSLConstList papszOptions)
                                        [](const std::unique_ptr<VRTSource> &src)
                                        { return src.get() == nullptr; }),
                         m_papoSources.end());
+    InvalidateSourceIndex();
 
     CPLQuadTreeDestroy(hTree);
 #endif
@@ -1440,6 +1440,12 @@ void CPL_DLL CPL_STDCALL GDALGetOpenDatasets(GDALDatasetH **hDS, int *pnCount);
 int CPL_DLL CPL_STDCALL GDALGetAccess(GDALDatasetH hDS);
 CPLErr CPL_DLL CPL_STDCALL GDALFlushCache(GDALDatasetH hDS);
 CPLErr CPL_DLL CPL_STDCALL GDALDropCache(GDALDatasetH hDS);
+void CPL_DLL CPL_STDCALL GDALDatasetGetCacheStatistics(
+    GDALDatasetH hDS, GIntBig *pnCacheUsed, GIntBig *pnDirtyBytes,
+    GUIntBig *pnHits, GUIntBig *pnMisses, GUIntBig *pnEvictions);
+void CPL_DLL CPL_STDCALL GDALDatasetSetCacheMax(GDALDatasetH hDS,
+                                                GIntBig nCacheMax);
+GIntBig CPL_DLL CPL_STDCALL GDALDatasetGetCacheMax(GDALDatasetH hDS);
 
 CPLErr CPL_DLL CPL_STDCALL GDALCreateDatasetMaskBand(GDALDatasetH hDS,
                                                      int nFlags);
@@ -2549,6 +2555,9 @@ int CPL_DLL CPL_STDCALL GDALGetCacheUsed(void);
 void CPL_DLL CPL_STDCALL GDALSetCacheMax64(GIntBig nBytes);
 GIntBig CPL_DLL CPL_STDCALL GDALGetCacheMax64(void);
 GIntBig CPL_DLL CPL_STDCALL GDALGetCacheUsed64(void);
+void CPL_DLL CPL_STDCALL GDALGetCacheStatistics(GUIntBig *pnHits,
+                                                GUIntBig *pnMisses,
+                                                GUIntBig *pnEvictions);
 
 int CPL_DLL CPL_STDCALL GDALFlushCacheBlock(void);
 
@@ -18,6 +18,8 @@
 #include "cpl_port.h"
 #include "cpl_error.h"
 
+#include <atomic>
+
 typedef struct _CPLCond CPLCond;
 typedef struct _CPLLock CPLLock;
 typedef struct _CPLMutex CPLMutex;
@@ -25,11 +27,59 @@ typedef struct _CPLMutex CPLMutex;
 class GDALRasterBand;
 class GDALRasterBlock;
 
+//! @cond Doxygen_Suppress
+
 /* ******************************************************************** */
-/*                       GDALAbstractBandBlockCache                     */
+/*                         GDALBlockCacheCounters                       */
 /* ******************************************************************** */
 
-//! @cond Doxygen_Suppress
+/** Hit, miss and eviction counters of the block cache.
+ *
+ * The counters are split into several cache lines. Each thread only updates
+ * the one matching its index, so that threads reading blocks concurrently
+ * do not contend on the same cache line. The values are summed on read.
+ */
+class GDALBlockCacheCounters
+{
+    static constexpr int STRIPE_COUNT = 16;
+
+    struct alignas(64) Stripe
+    {
+        std::atomic<GUIntBig> nHits{0};
+        std::atomic<GUIntBig> nMisses{0};
+        std::atomic<GUIntBig> nEvictions{0};
+    };
+
+    Stripe m_asStripes[STRIPE_COUNT]{};
+
+    static int GetThreadStripe();
+
+  public:
+    void IncHits()
+    {
+        m_asStripes[GetThreadStripe()].nHits.fetch_add(
+            1, std::memory_order_relaxed);
+    }
+
+    void IncMisses()
+    {
+        m_asStripes[GetThreadStripe()].nMisses.fetch_add(
+            1, std::memory_order_relaxed);
+    }
+
+    void IncEvictions()
+    {
+        m_asStripes[GetThreadStripe()].nEvictions.fetch_add(
+            1, std::memory_order_relaxed);
+    }
+
+    void Add(GUIntBig *pnHits, GUIntBig *pnMisses,
+             GUIntBig *pnEvictions) const;
+};
+
+/* ******************************************************************** */
+/*                       GDALAbstractBandBlockCache                     */
+/* ******************************************************************** */
 
 //! This manages how a raster band store its cached block.
 // only used by GDALRasterBand implementation.
@@ -47,6 +97,11 @@ class GDALAbstractBandBlockCache /* non final */
 
     volatile int m_nDirtyBlocks = 0;
 
+    // Statistics of the global block cache for this band, updated by
+    // GDALRasterBlock
+    std::atomic<GIntBig> m_nCacheUsed{0};
+    GDALBlockCacheCounters m_oCounters{};
+
     CPL_DISALLOW_COPY_ASSIGN(GDALAbstractBandBlockCache)
 
   protected:
@@ -88,6 +143,35 @@ class GDALAbstractBandBlockCache /* non final */
         return m_nDirtyBlocks > 0;
     }
 
+    void IncCacheUsed(GIntBig nInc)
+    {
+        m_nCacheUsed.fetch_add(nInc, std::memory_order_relaxed);
+    }
+
+    GIntBig GetCacheUsed() const
+    {
+        return m_nCacheUsed.load(std::memory_order_relaxed);
+    }
+
+    void IncHits()
+    {
+        m_oCounters.IncHits();
+    }
+
+    void IncMisses()
+    {
+        m_oCounters.IncMisses();
+    }
+
+    void IncEvictions()
+    {
+        m_oCounters.IncEvictions();
+    }
+
+    void GetStatistics(GIntBig *pnCacheUsed, GIntBig *pnDirtyBytes,
+                       GUIntBig *pnHits, GUIntBig *pnMisses,
+                       GUIntBig *pnEvictions) const;
+
     virtual bool Init() = 0;
     virtual bool IsInitOK() = 0;
     virtual CPLErr FlushCache() = 0;
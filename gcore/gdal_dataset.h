@@ -330,6 +330,12 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     virtual CPLErr FlushCache(bool bAtClosing = false);
     virtual CPLErr DropCache();
 
+    void GetCacheStatistics(GIntBig *pnCacheUsed, GIntBig *pnDirtyBytes,
+                            GUIntBig *pnHits, GUIntBig *pnMisses,
+                            GUIntBig *pnEvictions) const;
+    void SetCacheMax(GIntBig nCacheMax);
+    GIntBig GetCacheMax() const;
+
     virtual GIntBig GetEstimatedRAMUsage();
 
     virtual const OGRSpatialReference *GetSpatialRef() const;
@@ -19,11 +19,15 @@
 #include "cpl_atomic_ops.h"
 #include "gdal.h"
 
+#include <atomic>
+
 /* ******************************************************************** */
 /*                           GDALRasterBlock                            */
 /* ******************************************************************** */
 
 class GDALRasterBand;
+struct GDALRasterBlockCacheShard;
+struct GDALRasterBlockDatasetList;
 
 /** A single raster block in the block cache.
  *
@@ -32,6 +36,7 @@ class GDALRasterBand;
 class CPL_DLL GDALRasterBlock final
 {
     friend class GDALAbstractBandBlockCache;
+    friend struct GDALRasterBlockCacheShard;
 
     GDALDataType eType = GDT_Unknown;
 
@@ -51,8 +56,22 @@ class CPL_DLL GDALRasterBlock final
     GDALRasterBlock *poNext = nullptr;
     GDALRasterBlock *poPrevious = nullptr;
 
+    // List of the blocks of the same dataset and cache shard, and links in
+    // it. Only set for blocks of datasets with a cache quota.
+    GDALRasterBlockDatasetList *psDatasetList = nullptr;
+    GDALRasterBlock *poDatasetNext = nullptr;
+    GDALRasterBlock *poDatasetPrevious = nullptr;
+
     bool bMustDetach = false;
 
+    // Whether the block is in the protected list of the 2Q eviction policy.
+    // Only modified with the shard lock held, but read without it by Touch().
+    std::atomic<bool> bProtected{false};
+
+    // Value of the touch counter of the cache shard when this block was last
+    // moved to the head of its LRU list. Read without the lock by Touch().
+    std::atomic<GUInt32> nLastTouchCounter{0};
+
     CPL_INTERNAL void Detach_unlocked(void);
     CPL_INTERNAL void Touch_unlocked(void);
 
@@ -150,6 +169,7 @@ class CPL_DLL GDALRasterBlock final
     }
 
     int TakeLock();
+    int TakeLockNoTouch();
     int DropLockForRemovalFromStorage();
 
     /// @brief Accessor to source GDALRasterBand object.
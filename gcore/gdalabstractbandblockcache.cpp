@@ -29,6 +29,39 @@
 static int nAllBandsKeptAlivedBlocks = 0;
 #endif
 
+/************************************************************************/
+/*               GDALBlockCacheCounters::GetThreadStripe()              */
+/************************************************************************/
+
+int GDALBlockCacheCounters::GetThreadStripe()
+{
+    static std::atomic<int> nNextStripe{0};
+    // Threads are assigned stripes in a round-robin way
+    static thread_local const int nStripe =
+        nNextStripe.fetch_add(1, std::memory_order_relaxed) % STRIPE_COUNT;
+    return nStripe;
+}
+
+/************************************************************************/
+/*                   GDALBlockCacheCounters::Add()                      */
+/*                                                                      */
+/*      Add the values of the counters to the passed ones.              */
+/************************************************************************/
+
+void GDALBlockCacheCounters::Add(GUIntBig *pnHits, GUIntBig *pnMisses,
+                                 GUIntBig *pnEvictions) const
+{
+    for (const Stripe &sStripe : m_asStripes)
+    {
+        if (pnHits)
+            *pnHits += sStripe.nHits.load(std::memory_order_relaxed);
+        if (pnMisses)
+            *pnMisses += sStripe.nMisses.load(std::memory_order_relaxed);
+        if (pnEvictions)
+            *pnEvictions += sStripe.nEvictions.load(std::memory_order_relaxed);
+    }
+}
+
 /************************************************************************/
 /*                      GDALArrayBandBlockCache()                       */
 /************************************************************************/
@@ -184,6 +217,33 @@ GDALRasterBlock *GDALAbstractBandBlockCache::CreateBlock(int nXBlockOff,
     return poBlock;
 }
 
+/************************************************************************/
+/*                           GetStatistics()                            */
+/*                                                                      */
+/*      Add the statistics of the blocks of this band in the global     */
+/*      block cache to the passed counters.                             */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::GetStatistics(GIntBig *pnCacheUsed,
+                                               GIntBig *pnDirtyBytes,
+                                               GUIntBig *pnHits,
+                                               GUIntBig *pnMisses,
+                                               GUIntBig *pnEvictions) const
+{
+    if (pnCacheUsed)
+        *pnCacheUsed += GetCacheUsed();
+    if (pnDirtyBytes)
+    {
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+        *pnDirtyBytes +=
+            static_cast<GIntBig>(m_nDirtyBlocks) * nBlockXSize * nBlockYSize *
+            GDALGetDataTypeSizeBytes(poBand->GetRasterDataType());
+    }
+    m_oCounters.Add(pnHits, pnMisses, pnEvictions);
+}
+
 /************************************************************************/
 /*                           IncDirtyBlocks()                           */
 /************************************************************************/
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <cmath>
@@ -130,6 +131,11 @@ class GDALDataset::Private
     std::vector<int>
         m_anBandMap{};  // used by RasterIO(). Values are 1, 2, etc.
 
+    // Soft quota of the dataset in the global block cache, in bytes.
+    // 0 means no quota, and -1 that GDAL_DATASET_CACHEMAX has not been
+    // read yet. Read by GDALRasterBlock::Internalize() from any thread.
+    std::atomic<GIntBig> m_nCacheMax{-1};
+
     Private() = default;
 };
 
@@ -831,6 +837,209 @@ CPLErr CPL_STDCALL GDALDropCache(GDALDatasetH hDS)
     return GDALDataset::FromHandle(hDS)->DropCache();
 }
 
+/************************************************************************/
+/*                         GetCacheStatistics()                         */
+/************************************************************************/
+
+/**
+ * \brief Get statistics on the blocks of this dataset in the global raster
+ * block cache.
+ *
+ * The statistics are the sum of the ones of the raster bands of the dataset.
+ * Counters of hits, misses and evictions are cumulated since the bands were
+ * created.
+ *
+ * This method is the same as the C function GDALDatasetGetCacheStatistics().
+ *
+ * @param[out] pnCacheUsed Pointer to the number of bytes of the cache used by
+ *                         the blocks of the dataset, or nullptr.
+ * @param[out] pnDirtyBytes Pointer to the number of bytes of blocks modified
+ *                          but not yet written, or nullptr.
+ * @param[out] pnHits Pointer to the number of block requests served from the
+ *                    cache, or nullptr.
+ * @param[out] pnMisses Pointer to the number of blocks that had to be loaded
+ *                      in the cache, or nullptr.
+ * @param[out] pnEvictions Pointer to the number of blocks evicted from the
+ *                         cache, or nullptr.
+ * @since GDAL 3.14
+ */
+
+void GDALDataset::GetCacheStatistics(GIntBig *pnCacheUsed,
+                                     GIntBig *pnDirtyBytes, GUIntBig *pnHits,
+                                     GUIntBig *pnMisses,
+                                     GUIntBig *pnEvictions) const
+{
+    if (pnCacheUsed)
+        *pnCacheUsed = 0;
+    if (pnDirtyBytes)
+        *pnDirtyBytes = 0;
+    if (pnHits)
+        *pnHits = 0;
+    if (pnMisses)
+        *pnMisses = 0;
+    if (pnEvictions)
+        *pnEvictions = 0;
+
+    if (papoBands)
+    {
+        for (int i = 0; i < nBands; ++i)
+        {
+            if (papoBands[i] && papoBands[i]->poBandBlockCache)
+            {
+                papoBands[i]->poBandBlockCache->GetStatistics(
+                    pnCacheUsed, pnDirtyBytes, pnHits, pnMisses, pnEvictions);
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                   GDALDatasetGetCacheStatistics()                    */
+/************************************************************************/
+
+/**
+ * \brief Get statistics on the blocks of this dataset in the global raster
+ * block cache.
+ *
+ * @see GDALDataset::GetCacheStatistics()
+ * @since GDAL 3.14
+ */
+
+void CPL_STDCALL GDALDatasetGetCacheStatistics(
+    GDALDatasetH hDS, GIntBig *pnCacheUsed, GIntBig *pnDirtyBytes,
+    GUIntBig *pnHits, GUIntBig *pnMisses, GUIntBig *pnEvictions)
+
+{
+    VALIDATE_POINTER0(hDS, "GDALDatasetGetCacheStatistics");
+
+    GDALDataset::FromHandle(hDS)->GetCacheStatistics(
+        pnCacheUsed, pnDirtyBytes, pnHits, pnMisses, pnEvictions);
+}
+
+/************************************************************************/
+/*                            SetCacheMax()                             */
+/************************************************************************/
+
+/**
+ * \brief Set the soft quota of this dataset in the global raster block cache.
+ *
+ * When loading a new block of this dataset would make the blocks of the
+ * dataset use more than nCacheMax bytes of the cache, the least recently used
+ * blocks of the dataset are evicted first, instead of blocks of other
+ * datasets. The quota is soft: it does not prevent blocks currently locked
+ * from staying in the cache, and only accounts for the blocks loaded while a
+ * quota is set. With GDAL_CACHE_SHARDS &gt; 1, the quota is split evenly
+ * between the shards, like GDAL_CACHEMAX.
+ *
+ * The default value comes from the GDAL_DATASET_CACHEMAX configuration option.
+ *
+ * This method is the same as the C function GDALDatasetSetCacheMax().
+ *
+ * @param nCacheMax Quota in bytes, or 0 for no quota (other than the global
+ *                  one, GDAL_CACHEMAX).
+ * @since GDAL 3.14
+ */
+
+void GDALDataset::SetCacheMax(GIntBig nCacheMax)
+{
+    if (m_poPrivate)
+        m_poPrivate->m_nCacheMax.store(std::max<GIntBig>(0, nCacheMax),
+                                       std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                       GDALDatasetSetCacheMax()                       */
+/************************************************************************/
+
+/**
+ * \brief Set the soft quota of this dataset in the global raster block cache.
+ *
+ * @see GDALDataset::SetCacheMax()
+ * @since GDAL 3.14
+ */
+
+void CPL_STDCALL GDALDatasetSetCacheMax(GDALDatasetH hDS, GIntBig nCacheMax)
+
+{
+    VALIDATE_POINTER0(hDS, "GDALDatasetSetCacheMax");
+
+    GDALDataset::FromHandle(hDS)->SetCacheMax(nCacheMax);
+}
+
+/************************************************************************/
+/*                            GetCacheMax()                             */
+/************************************************************************/
+
+/**
+ * \brief Get the soft quota of this dataset in the global raster block cache.
+ *
+ * This method is the same as the C function GDALDatasetGetCacheMax().
+ *
+ * @return quota in bytes, or 0 if there is none.
+ * @see GDALDataset::SetCacheMax()
+ * @since GDAL 3.14
+ */
+
+GIntBig GDALDataset::GetCacheMax() const
+{
+    if (!m_poPrivate)
+        return 0;
+    GIntBig nCurCacheMax =
+        m_poPrivate->m_nCacheMax.load(std::memory_order_relaxed);
+    if (nCurCacheMax < 0)
+    {
+        GIntBig nCacheMax = 0;
+        const char *pszCacheMax =
+            CPLGetConfigOption("GDAL_DATASET_CACHEMAX", nullptr);
+        if (pszCacheMax)
+        {
+            bool bUnitSpecified = false;
+            if (CPLParseMemorySize(pszCacheMax, &nCacheMax, &bUnitSpecified) !=
+                    CE_None ||
+                nCacheMax < 0)
+            {
+                CPLError(CE_Warning, CPLE_IllegalArg,
+                         "Invalid value for GDAL_DATASET_CACHEMAX: %s",
+                         pszCacheMax);
+                nCacheMax = 0;
+            }
+            else if (!bUnitSpecified && nCacheMax < 100000)
+            {
+                // Same convention as GDAL_CACHEMAX: small values without
+                // unit are megabytes.
+                nCacheMax *= 1024 * 1024;
+            }
+        }
+        // Several threads may get there concurrently: only the first one
+        // (or a concurrent SetCacheMax()) sets the value.
+        if (m_poPrivate->m_nCacheMax.compare_exchange_strong(
+                nCurCacheMax, nCacheMax, std::memory_order_relaxed))
+        {
+            nCurCacheMax = nCacheMax;
+        }
+    }
+    return nCurCacheMax;
+}
+
+/************************************************************************/
+/*                       GDALDatasetGetCacheMax()                       */
+/************************************************************************/
+
+/**
+ * \brief Get the soft quota of this dataset in the global raster block cache.
+ *
+ * @see GDALDataset::GetCacheMax()
+ * @since GDAL 3.14
+ */
+
+GIntBig CPL_STDCALL GDALDatasetGetCacheMax(GDALDatasetH hDS)
+
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetGetCacheMax", 0);
+
+    return GDALDataset::FromHandle(hDS)->GetCacheMax();
+}
+
 /************************************************************************/
 /*                        GetEstimatedRAMUsage()                        */
 /************************************************************************/
@@ -14,9 +14,11 @@
 #include "cpl_port.h"
 #include "gdal_priv.h"
 
-#include <cstddef>
 #include <algorithm>
-#include <set>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #include "cpl_config.h"
@@ -26,6 +28,69 @@
 
 //! @cond Doxygen_Suppress
 
+namespace
+{
+/** Hazard pointer of a thread, announcing the block table that a lock-free
+ * lookup of this thread is reading. Records are never freed, but they are
+ * reused once their thread has exited.
+ */
+struct HazardRecord
+{
+    std::atomic<const void *> pTable{nullptr};
+    std::atomic<bool> bInUse{false};
+    HazardRecord *psNext = nullptr;
+};
+
+std::atomic<HazardRecord *> gpsHazardRecords{nullptr};
+
+HazardRecord *AcquireHazardRecord()
+{
+    HazardRecord *psHead = gpsHazardRecords.load(std::memory_order_acquire);
+    for (HazardRecord *psIter = psHead; psIter; psIter = psIter->psNext)
+    {
+        bool bExpected = false;
+        if (psIter->bInUse.compare_exchange_strong(bExpected, true))
+            return psIter;
+    }
+    HazardRecord *psRecord = new HazardRecord();
+    psRecord->bInUse.store(true, std::memory_order_relaxed);
+    do
+    {
+        psRecord->psNext = psHead;
+    } while (!gpsHazardRecords.compare_exchange_weak(psHead, psRecord));
+    return psRecord;
+}
+
+struct ThreadHazardRecord
+{
+    HazardRecord *const psRecord = AcquireHazardRecord();
+
+    ThreadHazardRecord() = default;
+
+    ~ThreadHazardRecord()
+    {
+        psRecord->pTable.store(nullptr, std::memory_order_relaxed);
+        psRecord->bInUse.store(false, std::memory_order_release);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(ThreadHazardRecord)
+};
+
+thread_local ThreadHazardRecord tlsHazardRecord;
+
+/** Wait until no lock-free lookup reads pTable. */
+void WaitForLookups(const void *pTable)
+{
+    for (HazardRecord *psIter =
+             gpsHazardRecords.load(std::memory_order_acquire);
+         psIter; psIter = psIter->psNext)
+    {
+        while (psIter->pTable.load(std::memory_order_seq_cst) == pTable)
+            std::this_thread::yield();
+    }
+}
+}  // namespace
+
 /* ******************************************************************** */
 /*                        GDALHashSetBandBlockCache                     */
 /* ******************************************************************** */
@@ -48,9 +113,66 @@ class GDALHashSetBandBlockCache final : public GDALAbstractBandBlockCache
         }
     };
 
-    std::set<GDALRasterBlock *, BlockComparator> m_oSet{};
+    /** Open-addressing (linear probing) hash table of blocks, keyed by
+     * their coordinates.
+     *
+     * Slots are only ever changed from null to a block, or from a block to
+     * a tombstone, with atomic stores, and the table is kept at most 3/4
+     * full, so that a lookup can run without taking hLock while other
+     * threads evict blocks. Insertions, removals and resizing are done
+     * under hLock.
+     *
+     * A lookup announces the table it reads in the hazard record of its
+     * thread. A table that has been replaced, or a block that has been
+     * removed from the table, is only freed once no lookup reads the
+     * table any longer (see WaitForLookups()).
+     */
+    struct BlockTable
+    {
+        explicit BlockTable(size_t nSize)
+            : nMask(nSize - 1),
+              apoSlots(new std::atomic<GDALRasterBlock *>[nSize])
+        {
+            for (size_t i = 0; i < nSize; ++i)
+                apoSlots[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        size_t GetSize() const
+        {
+            return nMask + 1;
+        }
+
+        const size_t nMask;
+        std::unique_ptr<std::atomic<GDALRasterBlock *>[]> apoSlots;
+
+        CPL_DISALLOW_COPY_ASSIGN(BlockTable)
+    };
+
+    static constexpr size_t MIN_TABLE_SIZE = 16;
+
+    // Table used by lock-free lookups.
+    std::atomic<BlockTable *> m_poTable{nullptr};
+    // Owner of the current table.
+    std::unique_ptr<BlockTable> m_poCurTable{};
+    // Number of blocks in the current table.
+    size_t m_nBlocks = 0;
+    // Number of non-null slots (blocks + tombstones) in the current table.
+    size_t m_nUsedSlots = 0;
     CPLLock *hLock = nullptr;
 
+    static GDALRasterBlock *Tombstone()
+    {
+        return reinterpret_cast<GDALRasterBlock *>(
+            static_cast<GUIntptr_t>(1));
+    }
+
+    static size_t Hash(int nXBlockOff, int nYBlockOff);
+    static std::atomic<GDALRasterBlock *> *
+    FindSlot(BlockTable *poTable, int nXBlockOff, int nYBlockOff);
+    static void InsertInTable(BlockTable *poTable, GDALRasterBlock *poBlock);
+    void InsertUnlocked(GDALRasterBlock *poBlock);
+    void SetTableUnlocked(std::unique_ptr<BlockTable> poNewTable);
+
     CPL_DISALLOW_COPY_ASSIGN(GDALHashSetBandBlockCache)
 
   public:
@@ -87,6 +209,7 @@ GDALHashSetBandBlockCache::GDALHashSetBandBlockCache(GDALRasterBand *poBandIn)
 
       hLock(CPLCreateLock(LOCK_ADAPTIVE_MUTEX))
 {
+    SetTableUnlocked(std::make_unique<BlockTable>(MIN_TABLE_SIZE));
 }
 
 /************************************************************************/
@@ -117,6 +240,116 @@ bool GDALHashSetBandBlockCache::IsInitOK()
     return true;
 }
 
+/************************************************************************/
+/*                                Hash()                                */
+/************************************************************************/
+
+size_t GDALHashSetBandBlockCache::Hash(int nXBlockOff, int nYBlockOff)
+{
+    // splitmix64 finalizer, to get well distributed low bits
+    GUInt64 nKey =
+        (static_cast<GUInt64>(static_cast<GUInt32>(nYBlockOff)) << 32) |
+        static_cast<GUInt32>(nXBlockOff);
+    nKey ^= nKey >> 30;
+    nKey *= static_cast<GUInt64>(0xBF58476D1CE4E5B9ULL);
+    nKey ^= nKey >> 27;
+    nKey *= static_cast<GUInt64>(0x94D049BB133111EBULL);
+    nKey ^= nKey >> 31;
+    return static_cast<size_t>(nKey);
+}
+
+/************************************************************************/
+/*                              FindSlot()                              */
+/************************************************************************/
+
+/** Return the slot holding the block of the specified coordinates, or
+ * nullptr if there is none. May be called without holding hLock. */
+std::atomic<GDALRasterBlock *> *
+GDALHashSetBandBlockCache::FindSlot(BlockTable *poTable, int nXBlockOff,
+                                    int nYBlockOff)
+{
+    const size_t nMask = poTable->nMask;
+    for (size_t i = Hash(nXBlockOff, nYBlockOff) & nMask;; i = (i + 1) & nMask)
+    {
+        auto &slot = poTable->apoSlots[i];
+        GDALRasterBlock *poBlock = slot.load(std::memory_order_acquire);
+        if (poBlock == nullptr)
+            return nullptr;
+        if (poBlock != Tombstone() && poBlock->GetXOff() == nXBlockOff &&
+            poBlock->GetYOff() == nYBlockOff)
+        {
+            return &slot;
+        }
+    }
+}
+
+/************************************************************************/
+/*                          SetTableUnlocked()                          */
+/************************************************************************/
+
+/** Publish a new table, and free the previous one once no lookup reads it
+ * any longer. Must be called with hLock held (or from the constructor). */
+void GDALHashSetBandBlockCache::SetTableUnlocked(
+    std::unique_ptr<BlockTable> poNewTable)
+{
+    m_poTable.store(poNewTable.get(), std::memory_order_seq_cst);
+    if (m_poCurTable)
+        WaitForLookups(m_poCurTable.get());
+    m_poCurTable = std::move(poNewTable);
+}
+
+/************************************************************************/
+/*                           InsertInTable()                            */
+/************************************************************************/
+
+void GDALHashSetBandBlockCache::InsertInTable(BlockTable *poTable,
+                                              GDALRasterBlock *poBlock)
+{
+    const size_t nMask = poTable->nMask;
+    for (size_t i = Hash(poBlock->GetXOff(), poBlock->GetYOff()) & nMask;;
+         i = (i + 1) & nMask)
+    {
+        auto &slot = poTable->apoSlots[i];
+        if (slot.load(std::memory_order_relaxed) == nullptr)
+        {
+            slot.store(poBlock, std::memory_order_release);
+            break;
+        }
+    }
+}
+
+/************************************************************************/
+/*                           InsertUnlocked()                           */
+/************************************************************************/
+
+/** Insert a block in the current table. Must be called with hLock held. */
+void GDALHashSetBandBlockCache::InsertUnlocked(GDALRasterBlock *poBlock)
+{
+    if ((m_nUsedSlots + 1) * 4 > m_poCurTable->GetSize() * 3)
+    {
+        // Rebuild the table, dropping tombstones, and growing it if needed.
+        // The new table is filled before being published, so that lookups
+        // never see it partially filled.
+        size_t nNewSize = MIN_TABLE_SIZE;
+        while (nNewSize < (m_nBlocks + 1) * 2)
+            nNewSize *= 2;
+        auto poNewTable = std::make_unique<BlockTable>(nNewSize);
+        for (size_t i = 0; i < m_poCurTable->GetSize(); ++i)
+        {
+            GDALRasterBlock *poIter =
+                m_poCurTable->apoSlots[i].load(std::memory_order_relaxed);
+            if (poIter != nullptr && poIter != Tombstone())
+                InsertInTable(poNewTable.get(), poIter);
+        }
+        SetTableUnlocked(std::move(poNewTable));
+        m_nUsedSlots = m_nBlocks;
+    }
+
+    InsertInTable(m_poCurTable.get(), poBlock);
+    ++m_nBlocks;
+    ++m_nUsedSlots;
+}
+
 /************************************************************************/
 /*                             AdoptBlock()                             */
 /************************************************************************/
@@ -127,7 +360,9 @@ CPLErr GDALHashSetBandBlockCache::AdoptBlock(GDALRasterBlock *poBlock)
     FreeDanglingBlocks();
 
     CPLLockHolderOptionalLockD(hLock);
-    m_oSet.insert(poBlock);
+    CPLAssert(FindSlot(m_poCurTable.get(), poBlock->GetXOff(),
+                       poBlock->GetYOff()) == nullptr);
+    InsertUnlocked(poBlock);
 
     return CE_None;
 }
@@ -142,14 +377,25 @@ CPLErr GDALHashSetBandBlockCache::FlushCache()
 
     CPLErr eGlobalErr = poBand->eFlushBlockErr;
 
-    std::set<GDALRasterBlock *, BlockComparator> oOldSet;
+    std::vector<GDALRasterBlock *> apoOldBlocks;
     {
         CPLLockHolderOptionalLockD(hLock);
-        oOldSet = std::move(m_oSet);
+        apoOldBlocks.reserve(m_nBlocks);
+        for (size_t i = 0; i < m_poCurTable->GetSize(); ++i)
+        {
+            GDALRasterBlock *poBlock =
+                m_poCurTable->apoSlots[i].load(std::memory_order_relaxed);
+            if (poBlock != nullptr && poBlock != Tombstone())
+                apoOldBlocks.push_back(poBlock);
+        }
+        SetTableUnlocked(std::make_unique<BlockTable>(MIN_TABLE_SIZE));
+        m_nBlocks = 0;
+        m_nUsedSlots = 0;
     }
+    std::sort(apoOldBlocks.begin(), apoOldBlocks.end(), BlockComparator());
 
     StartDirtyBlockFlushingLog();
-    for (auto &poBlock : oOldSet)
+    for (auto &poBlock : apoOldBlocks)
     {
         if (poBlock->DropLockForRemovalFromStorage())
         {
@@ -184,7 +430,15 @@ CPLErr GDALHashSetBandBlockCache::UnreferenceBlock(GDALRasterBlock *poBlock)
     UnreferenceBlockBase();
 
     CPLLockHolderOptionalLockD(hLock);
-    m_oSet.erase(poBlock);
+    auto poSlot = FindSlot(m_poCurTable.get(), poBlock->GetXOff(),
+                           poBlock->GetYOff());
+    if (poSlot)
+    {
+        poSlot->store(Tombstone(), std::memory_order_release);
+        --m_nBlocks;
+        // The caller frees the block
+        WaitForLookups(m_poCurTable.get());
+    }
     return CE_None;
 }
 
@@ -196,15 +450,16 @@ CPLErr GDALHashSetBandBlockCache::FlushBlock(int nXBlockOff, int nYBlockOff,
                                              int bWriteDirtyBlock)
 
 {
-    GDALRasterBlock oBlockForLookup(nXBlockOff, nYBlockOff);
     GDALRasterBlock *poBlock = nullptr;
     {
         CPLLockHolderOptionalLockD(hLock);
-        auto oIter = m_oSet.find(&oBlockForLookup);
-        if (oIter == m_oSet.end())
+        auto poSlot = FindSlot(m_poCurTable.get(), nXBlockOff, nYBlockOff);
+        if (poSlot == nullptr)
             return CE_None;
-        poBlock = *oIter;
-        m_oSet.erase(oIter);
+        poBlock = poSlot->load(std::memory_order_relaxed);
+        poSlot->store(Tombstone(), std::memory_order_release);
+        --m_nBlocks;
+        WaitForLookups(m_poCurTable.get());
     }
 
     if (!poBlock->DropLockForRemovalFromStorage())
@@ -228,17 +483,35 @@ GDALRasterBlock *GDALHashSetBandBlockCache::TryGetLockedBlockRef(int nXBlockOff,
                                                                  int nYBlockOff)
 
 {
-    GDALRasterBlock oBlockForLookup(nXBlockOff, nYBlockOff);
-    GDALRasterBlock *poBlock;
+    // Lock-free lookup. If the block is concurrently evicted,
+    // TakeLockNoTouch() will detect it.
+    HazardRecord *psRecord = tlsHazardRecord.psRecord;
+    BlockTable *poTable = m_poTable.load(std::memory_order_seq_cst);
+    while (true)
     {
-        CPLLockHolderOptionalLockD(hLock);
-        auto oIter = m_oSet.find(&oBlockForLookup);
-        if (oIter == m_oSet.end())
-            return nullptr;
-        poBlock = *oIter;
+        // Announce the table, and check that it has not been replaced in
+        // the meantime, in which case it might already be freed.
+        psRecord->pTable.store(poTable, std::memory_order_seq_cst);
+        BlockTable *poCurTable = m_poTable.load(std::memory_order_seq_cst);
+        if (poCurTable == poTable)
+            break;
+        poTable = poCurTable;
+    }
+
+    GDALRasterBlock *poBlock = nullptr;
+    auto poSlot = FindSlot(poTable, nXBlockOff, nYBlockOff);
+    if (poSlot != nullptr)
+    {
+        poBlock = poSlot->load(std::memory_order_acquire);
+        if (poBlock == Tombstone() || !poBlock->TakeLockNoTouch())
+            poBlock = nullptr;
     }
-    if (!poBlock->TakeLock())
-        return nullptr;
+    // Once locked, the block cannot be freed, so stop announcing the table
+    // before Touch(): it takes the lock of the cache shard, under which
+    // UnreferenceBlock() waits for lookups.
+    psRecord->pTable.store(nullptr, std::memory_order_release);
+    if (poBlock)
+        poBlock->Touch();
     return poBlock;
 }
 
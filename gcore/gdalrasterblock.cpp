@@ -17,8 +17,10 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstring>
+#include <map>
 #include <mutex>
 
 #include "cpl_atomic_ops.h"
@@ -28,23 +30,132 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 
+#include "gdal_abstractbandblockcache.h"
+
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
 
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+/************************************************************************/
+/*                        GDALRasterBlockList                           */
+/************************************************************************/
 
-static int nDisableDirtyBlockFlushCounter = 0;
+namespace
+{
+/* Doubly-linked list of blocks, ordered from the most recently used (head)
+ * to the least recently used (tail). */
+struct GDALRasterBlockList
+{
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    // Number of blocks in the list. Only modified with the shard lock held,
+    // but read without it by GDALRasterBlock::Touch().
+    std::atomic<int> nBlockCount{0};
+};
+
+enum class GDALBlockCachePolicy
+{
+    LRU,
+    LAZY_LRU,
+    TWO_Q,
+};
+}  // namespace
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
+/************************************************************************/
+/*                      GDALRasterBlockDatasetList                      */
+/************************************************************************/
+
+/* Doubly-linked list of the blocks of a dataset with a cache quota (see
+ * GDALDataset::SetCacheMax()) within a cache shard, ordered from the most
+ * recently used (head) to the least recently used (tail), so that the blocks
+ * to evict to honour the quota can be found without scanning the blocks of
+ * other datasets. */
+struct GDALRasterBlockDatasetList
+{
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    // Memory used by the blocks of the list, and by the block being
+    // loaded, if any.
+    GIntBig nCacheUsed = 0;
+};
+
+/************************************************************************/
+/*                      GDALRasterBlockCacheShard                       */
+/************************************************************************/
+
+/* The global block cache is made of one or several independent shards,
+ * each protected by its own lock and owning an equal share of the cache
+ * budget. A block is assigned to a shard from a hash of its band and
+ * coordinates. By default (GDAL_CACHE_SHARDS=1), there is a single shard,
+ * which is the historical behavior.
+ *
+ * With the LRU eviction policy (default), a shard only uses its first list.
+ * The LAZY_LRU policy (GDAL_CACHE_POLICY=LAZY_LRU) is the same, except that
+ * accessing a block that is already among the most recently used quarter
+ * of the list does not move it, so that hits on hot blocks do not take the
+ * shard lock.
+ * With the 2Q policy (GDAL_CACHE_POLICY=2Q), new blocks enter the first,
+ * probationary, list and are moved to the second, protected, list when they
+ * are accessed again while being cached. The protected list is limited to
+ * 3/4 of the shard budget, and its least recently used blocks are demoted to
+ * the head of the probationary list when it exceeds it. Blocks are evicted
+ * from the tail of the probationary list first, so that a large sequential
+ * scan of blocks accessed once does not flush the working set.
+ */
+struct alignas(64) GDALRasterBlockCacheShard
+{
+    CPLLock *hLock = nullptr;
+    GDALRasterBlockList aoLists[2]{};
+    // Only modified with the lock held, but read without it by
+    // GDALGetCacheUsed64().
+    std::atomic<GIntBig> nCacheUsed{0};
+    // Part of nCacheUsed taken by the blocks of the protected list.
+    GIntBig nProtectedCacheUsed = 0;
+    // Incremented each time a block is moved to the head of a list. Only
+    // modified with the lock held, but read without it by
+    // GDALRasterBlock::Touch().
+    std::atomic<GUInt32> nTouchCounter{0};
+    // Blocks of the datasets that have a cache quota. An entry is removed
+    // when it no longer accounts for any block.
+    std::map<const GDALDataset *, GDALRasterBlockDatasetList>
+        oMapDatasetLists{};
+
+    GIntBig GetCacheUsed() const
+    {
+        return nCacheUsed.load(std::memory_order_relaxed);
+    }
+
+    // Must be called with the lock held.
+    void IncCacheUsed(GIntBig nInc)
+    {
+        nCacheUsed.store(nCacheUsed.load(std::memory_order_relaxed) + nInc,
+                         std::memory_order_relaxed);
+    }
+
+    bool IsLinked(const GDALRasterBlock *poBlock) const;
+    void Unlink(GDALRasterBlock *poBlock);
+    void LinkAtHead(GDALRasterBlock *poBlock, bool bProtected);
+    void DemoteProtectedBlocks(GIntBig nShardCacheMax);
+    GDALRasterBlockDatasetList *GetDatasetList(const GDALDataset *poDS);
+    void ReleaseDatasetList(const GDALRasterBlock *poBlock, GIntBig nSize);
+    static void UnlinkFromDatasetList(GDALRasterBlock *poBlock);
+    static void LinkAtDatasetListHead(GDALRasterBlock *poBlock);
+    GDALRasterBlock *GetFirstEvictionCandidate() const;
+    GDALRasterBlock *
+    GetNextEvictionCandidate(const GDALRasterBlock *poBlock) const;
+};
+
+constexpr int MAX_CACHE_SHARDS = 64;
+static GDALRasterBlockCacheShard asShards[MAX_CACHE_SHARDS];
+static GDALBlockCacheCounters goCacheCounters;
+static int nShards = 1;
+static GDALBlockCachePolicy eCachePolicy = GDALBlockCachePolicy::LRU;
+// Below that number of blocks in a list, blocks are always promoted to the
+// head of the list when accessed.
+constexpr int MIN_BLOCKS_FOR_LAZY_TOUCH = 64;
+static volatile int nFlushShardCounter = 0;
+
+static int nDisableDirtyBlockFlushCounter = 0;
 
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
@@ -75,13 +186,44 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+#define INITIALIZE_LOCK(psShard)                                               \
+    CPLLockHolderD(&((psShard)->hLock), GetLockType());                        \
+    CPLLockSetDebugPerf((psShard)->hLock, bDebugContention)
+#define TAKE_LOCK(psShard) CPLLockHolderOptionalLockD((psShard)->hLock)
 
-#endif
+/************************************************************************/
+/*                          InitializeLocks()                           */
+/************************************************************************/
+
+static void InitializeLocks()
+{
+    for (int i = 0; i < nShards; ++i)
+    {
+        INITIALIZE_LOCK(&asShards[i]);
+    }
+}
+
+/************************************************************************/
+/*                              GetShard()                              */
+/************************************************************************/
+
+static GDALRasterBlockCacheShard *GetShard(const GDALRasterBand *poBand,
+                                           int nXOff, int nYOff)
+{
+    if (nShards == 1)
+        return &asShards[0];
+
+    // Mix the band pointer with the block coordinates, so that the blocks
+    // of a same band are spread over all shards.
+    GUIntBig nHash = static_cast<GUIntBig>(reinterpret_cast<GUIntptr_t>(poBand));
+    nHash ^= static_cast<GUIntBig>(static_cast<unsigned>(nXOff)) *
+             static_cast<GUIntBig>(0x9E3779B97F4A7C15ULL);
+    nHash ^= static_cast<GUIntBig>(static_cast<unsigned>(nYOff)) *
+             static_cast<GUIntBig>(0xC2B2AE3D27D4EB4FULL);
+    nHash ^= nHash >> 32;
+    nHash ^= nHash >> 16;
+    return &asShards[nHash % static_cast<unsigned>(nShards)];
+}
 
 // #define ENABLE_DEBUG
 
@@ -145,13 +287,13 @@ void CPL_STDCALL GDALSetCacheMax64(GIntBig nNewSizeInBytes)
     /*      Flush blocks till we are under the new limit or till we         */
     /*      can't seem to flush anymore.                                    */
     /* -------------------------------------------------------------------- */
-    while (nCacheUsed > nCacheMax)
+    while (GDALGetCacheUsed64() > nCacheMax)
     {
-        const GIntBig nOldCacheUsed = nCacheUsed;
+        const GIntBig nOldCacheUsed = GDALGetCacheUsed64();
 
         GDALFlushCacheBlock();
 
-        if (nCacheUsed == nOldCacheUsed)
+        if (GDALGetCacheUsed64() == nOldCacheUsed)
             break;
     }
 }
@@ -219,9 +361,41 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
+            const char *pszShards =
+                CPLGetConfigOption("GDAL_CACHE_SHARDS", "1");
+            if (EQUAL(pszShards, "AUTO"))
+                nShards = CPLGetNumCPUs();
+            else
+                nShards = atoi(pszShards);
+            if (nShards < 1 || nShards > MAX_CACHE_SHARDS)
             {
-                INITIALIZE_LOCK;
+                const int nNewShards =
+                    std::clamp(nShards, 1, MAX_CACHE_SHARDS);
+                if (!EQUAL(pszShards, "AUTO"))
+                {
+                    CPLError(CE_Warning, CPLE_NotSupported,
+                             "Invalid value for GDAL_CACHE_SHARDS. Using %d",
+                             nNewShards);
+                }
+                nShards = nNewShards;
             }
+
+            InitializeLocks();
+
+            const char *pszPolicy =
+                CPLGetConfigOption("GDAL_CACHE_POLICY", "LRU");
+            if (EQUAL(pszPolicy, "2Q"))
+                eCachePolicy = GDALBlockCachePolicy::TWO_Q;
+            else if (EQUAL(pszPolicy, "LAZY_LRU"))
+                eCachePolicy = GDALBlockCachePolicy::LAZY_LRU;
+            else if (!EQUAL(pszPolicy, "LRU"))
+            {
+                CPLError(CE_Warning, CPLE_NotSupported,
+                         "GDAL_CACHE_POLICY=%s not supported. "
+                         "Falling back to LRU",
+                         pszPolicy);
+            }
+
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
 
@@ -252,6 +426,12 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
             nCacheMax = nNewCacheMax;
             CPLDebug("GDAL", "GDAL_CACHEMAX = " CPL_FRMT_GIB " MB",
                      nCacheMax / (1024 * 1024));
+            if (nShards > 1)
+                CPLDebug("GDAL", "Block cache split into %d shards", nShards);
+            if (eCachePolicy == GDALBlockCachePolicy::TWO_Q)
+                CPLDebug("GDAL", "Block cache uses 2Q eviction policy");
+            else if (eCachePolicy == GDALBlockCachePolicy::LAZY_LRU)
+                CPLDebug("GDAL", "Block cache uses lazy LRU eviction policy");
         });
 
     return nCacheMax;
@@ -270,6 +450,7 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
+    const GIntBig nCacheUsed = GDALGetCacheUsed64();
     if (nCacheUsed > INT_MAX)
     {
         CPLErrorOnce(CE_Warning, CPLE_AppDefined,
@@ -294,9 +475,49 @@ int CPL_STDCALL GDALGetCacheUsed()
 
 GIntBig CPL_STDCALL GDALGetCacheUsed64()
 {
+    GIntBig nCacheUsed = 0;
+    for (int i = 0; i < nShards; ++i)
+        nCacheUsed += asShards[i].GetCacheUsed();
     return nCacheUsed;
 }
 
+/************************************************************************/
+/*                       GDALGetCacheStatistics()                       */
+/************************************************************************/
+
+/**
+ * \brief Get statistics of the global raster block cache.
+ *
+ * The counters are cumulated since the start of the process. They can be
+ * used to compare the efficiency of the eviction policies selected with the
+ * GDAL_CACHE_POLICY configuration option.
+ *
+ * @param pnHits Pointer to the number of block requests that were served
+ *               from the cache, or NULL.
+ * @param pnMisses Pointer to the number of blocks that had to be loaded
+ *                 (or initialized) in the cache, or NULL.
+ * @param pnEvictions Pointer to the number of blocks that were evicted from
+ *                    the cache to make room for other blocks or to honour
+ *                    a reduction of the cache size, or NULL.
+ *
+ * @since GDAL 3.14
+ */
+
+void CPL_STDCALL GDALGetCacheStatistics(GUIntBig *pnHits, GUIntBig *pnMisses,
+                                        GUIntBig *pnEvictions)
+{
+    GUIntBig nHits = 0;
+    GUIntBig nMisses = 0;
+    GUIntBig nEvictions = 0;
+    goCacheCounters.Add(&nHits, &nMisses, &nEvictions);
+    if (pnHits)
+        *pnHits = nHits;
+    if (pnMisses)
+        *pnMisses = nMisses;
+    if (pnEvictions)
+        *pnEvictions = nEvictions;
+}
+
 /************************************************************************/
 /*                        GDALFlushCacheBlock()                         */
 /*                                                                      */
@@ -334,6 +555,11 @@ int CPL_STDCALL GDALFlushCacheBlock()
  * a least recently used (LRU) list and an upper cache limit (see
  * GDALSetCacheMax()) under which the cache size is normally kept.
  *
+ * When the GDAL_CACHE_SHARDS configuration option is set to a value greater
+ * than 1, the global cache is split into that number of independent LRU
+ * lists, each with its own lock and an equal share of the cache limit, so
+ * that threads working on unrelated blocks do not contend on a single lock.
+ *
  * Some blocks in the cache may be modified relative to the state on disk
  * (they are marked "Dirty") and must be flushed to disk before they can
  * be discarded.  Other (Clean) blocks may just be discarded if their memory
@@ -374,11 +600,22 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
-    GDALRasterBlock *poTarget;
-
+    GDALRasterBlock *poTarget = nullptr;
+
+    // Start from a different shard at each call, so that repeated calls
+    // (e.g. from GDALSetCacheMax64()) drain all shards evenly.
+    const int nFirstShard =
+        nShards == 1 ? 0
+                     : static_cast<int>(
+                           static_cast<unsigned>(
+                               CPLAtomicInc(&nFlushShardCounter)) %
+                           static_cast<unsigned>(nShards));
+    for (int iShard = 0; iShard < nShards && poTarget == nullptr; ++iShard)
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        GDALRasterBlockCacheShard *psShard =
+            &asShards[(nFirstShard + iShard) % nShards];
+        INITIALIZE_LOCK(psShard);
+        poTarget = psShard->GetFirstEvictionCandidate();
 
         while (poTarget != nullptr)
         {
@@ -388,11 +625,11 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
                 if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0, -1))
                     break;
             }
-            poTarget = poTarget->poPrevious;
+            poTarget = psShard->GetNextEvictionCandidate(poTarget);
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            continue;
 #ifndef __COVERITY__
         // Disabled to avoid complains about sleeping under locks, that
         // are only true for debug/testing code
@@ -407,8 +644,13 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
         poTarget->Detach_unlocked();
         poTarget->GetBand()->UnreferenceBlock(poTarget);
+        goCacheCounters.IncEvictions();
+        poTarget->poBand->poBandBlockCache->IncEvictions();
     }
 
+    if (poTarget == nullptr)
+        return FALSE;
+
 #ifndef __COVERITY__
     // Disabled to avoid complains about sleeping under locks, that
     // are only true for debug/testing code
@@ -529,11 +771,11 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
     : eType(poBandIn->GetRasterDataType()), nXOff(nXOffIn), nYOff(nYOffIn),
       poBand(poBandIn), bMustDetach(true)
 {
-    if (!hRBLock)
+    if (!asShards[0].hLock)
     {
         // Needed for scenarios where GDALAllRegister() is called after
         // GDALDestroyDriverManager()
-        INITIALIZE_LOCK;
+        InitializeLocks();
     }
 
     CPLAssert(poBandIn != nullptr);
@@ -582,6 +824,10 @@ void GDALRasterBlock::RecycleFor(int nXOffIn, int nYOffIn)
 
     poNext = nullptr;
     poPrevious = nullptr;
+    bProtected = false;
+    psDatasetList = nullptr;
+    poDatasetNext = nullptr;
+    poDatasetPrevious = nullptr;
 
     nXOff = nXOffIn;
     nYOff = nYOffIn;
@@ -630,6 +876,197 @@ static size_t GetEffectiveBlockSize(GPtrDiff_t nBlockSize)
                      2 * sizeof(GDALRasterBlock)));
 }
 
+/************************************************************************/
+/*                 GDALRasterBlockCacheShard::IsLinked()                */
+/************************************************************************/
+
+bool GDALRasterBlockCacheShard::IsLinked(const GDALRasterBlock *poBlock) const
+{
+    return poBlock->poPrevious != nullptr || poBlock->poNext != nullptr ||
+           aoLists[0].poNewest == poBlock || aoLists[1].poNewest == poBlock;
+}
+
+/************************************************************************/
+/*                  GDALRasterBlockCacheShard::Unlink()                 */
+/************************************************************************/
+
+void GDALRasterBlockCacheShard::Unlink(GDALRasterBlock *poBlock)
+{
+    GDALRasterBlockList &oList = aoLists[poBlock->bProtected ? 1 : 0];
+
+    if (oList.poOldest == poBlock)
+        oList.poOldest = poBlock->poPrevious;
+
+    if (oList.poNewest == poBlock)
+        oList.poNewest = poBlock->poNext;
+
+    if (poBlock->poPrevious != nullptr)
+        poBlock->poPrevious->poNext = poBlock->poNext;
+
+    if (poBlock->poNext != nullptr)
+        poBlock->poNext->poPrevious = poBlock->poPrevious;
+
+    poBlock->poPrevious = nullptr;
+    poBlock->poNext = nullptr;
+    oList.nBlockCount.fetch_sub(1, std::memory_order_relaxed);
+
+    if (poBlock->bProtected)
+    {
+        nProtectedCacheUsed -=
+            GetEffectiveBlockSize(poBlock->GetBlockSize());
+        poBlock->bProtected = false;
+    }
+}
+
+/************************************************************************/
+/*                GDALRasterBlockCacheShard::LinkAtHead()               */
+/************************************************************************/
+
+void GDALRasterBlockCacheShard::LinkAtHead(GDALRasterBlock *poBlock,
+                                           bool bProtected)
+{
+    CPLAssert(poBlock->poPrevious == nullptr && poBlock->poNext == nullptr);
+
+    GDALRasterBlockList &oList = aoLists[bProtected ? 1 : 0];
+
+    poBlock->poNext = oList.poNewest;
+    if (oList.poNewest != nullptr)
+    {
+        CPLAssert(oList.poNewest->poPrevious == nullptr);
+        oList.poNewest->poPrevious = poBlock;
+    }
+    oList.poNewest = poBlock;
+
+    if (oList.poOldest == nullptr)
+    {
+        CPLAssert(poBlock->poNext == nullptr);
+        oList.poOldest = poBlock;
+    }
+    oList.nBlockCount.fetch_add(1, std::memory_order_relaxed);
+
+    poBlock->bProtected = bProtected;
+    if (bProtected)
+        nProtectedCacheUsed += GetEffectiveBlockSize(poBlock->GetBlockSize());
+
+    poBlock->nLastTouchCounter.store(
+        nTouchCounter.fetch_add(1, std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*          GDALRasterBlockCacheShard::DemoteProtectedBlocks()          */
+/************************************************************************/
+
+/** Move the least recently used blocks of the protected list to the head of
+ * the probationary list, until the protected list fits in 3/4 of the shard
+ * budget. */
+void GDALRasterBlockCacheShard::DemoteProtectedBlocks(GIntBig nShardCacheMax)
+{
+    const GIntBig nProtectedCacheMax = nShardCacheMax / 4 * 3;
+    while (nProtectedCacheUsed > nProtectedCacheMax &&
+           aoLists[1].nBlockCount > 1)
+    {
+        GDALRasterBlock *poBlock = aoLists[1].poOldest;
+        Unlink(poBlock);
+        LinkAtHead(poBlock, false);
+    }
+}
+
+/************************************************************************/
+/*              GDALRasterBlockCacheShard::GetDatasetList()             */
+/************************************************************************/
+
+/** Return the list of blocks of poDS in this shard, creating it if needed.
+ * It is kept alive as long as its memory usage is not zero. */
+GDALRasterBlockDatasetList *
+GDALRasterBlockCacheShard::GetDatasetList(const GDALDataset *poDS)
+{
+    return &oMapDatasetLists[poDS];
+}
+
+/************************************************************************/
+/*           GDALRasterBlockCacheShard::ReleaseDatasetList()            */
+/************************************************************************/
+
+/** Remove the memory usage of poBlock (not linked in its dataset list any
+ * longer) from its dataset list, and destroy the list if it becomes unused.
+ */
+void GDALRasterBlockCacheShard::ReleaseDatasetList(
+    const GDALRasterBlock *poBlock, GIntBig nSize)
+{
+    GDALRasterBlockDatasetList *psList = poBlock->psDatasetList;
+    psList->nCacheUsed -= nSize;
+    if (psList->nCacheUsed <= 0 && psList->poNewest == nullptr)
+        oMapDatasetLists.erase(poBlock->poBand->GetDataset());
+}
+
+/************************************************************************/
+/*          GDALRasterBlockCacheShard::UnlinkFromDatasetList()          */
+/************************************************************************/
+
+void GDALRasterBlockCacheShard::UnlinkFromDatasetList(GDALRasterBlock *poBlock)
+{
+    GDALRasterBlockDatasetList *psList = poBlock->psDatasetList;
+
+    if (psList->poOldest == poBlock)
+        psList->poOldest = poBlock->poDatasetPrevious;
+
+    if (psList->poNewest == poBlock)
+        psList->poNewest = poBlock->poDatasetNext;
+
+    if (poBlock->poDatasetPrevious != nullptr)
+        poBlock->poDatasetPrevious->poDatasetNext = poBlock->poDatasetNext;
+
+    if (poBlock->poDatasetNext != nullptr)
+        poBlock->poDatasetNext->poDatasetPrevious = poBlock->poDatasetPrevious;
+
+    poBlock->poDatasetPrevious = nullptr;
+    poBlock->poDatasetNext = nullptr;
+}
+
+/************************************************************************/
+/*          GDALRasterBlockCacheShard::LinkAtDatasetListHead()          */
+/************************************************************************/
+
+void GDALRasterBlockCacheShard::LinkAtDatasetListHead(GDALRasterBlock *poBlock)
+{
+    GDALRasterBlockDatasetList *psList = poBlock->psDatasetList;
+
+    poBlock->poDatasetNext = psList->poNewest;
+    if (psList->poNewest != nullptr)
+        psList->poNewest->poDatasetPrevious = poBlock;
+    psList->poNewest = poBlock;
+
+    if (psList->poOldest == nullptr)
+        psList->poOldest = poBlock;
+}
+
+/************************************************************************/
+/*        GDALRasterBlockCacheShard::GetFirstEvictionCandidate()        */
+/************************************************************************/
+
+GDALRasterBlock *GDALRasterBlockCacheShard::GetFirstEvictionCandidate() const
+{
+    return aoLists[0].poOldest ? aoLists[0].poOldest : aoLists[1].poOldest;
+}
+
+/************************************************************************/
+/*         GDALRasterBlockCacheShard::GetNextEvictionCandidate()        */
+/************************************************************************/
+
+/** Return the block to consider for eviction after poBlock: the previous one
+ * in its list, and once the probationary list is exhausted, the oldest block
+ * of the protected list. */
+GDALRasterBlock *GDALRasterBlockCacheShard::GetNextEvictionCandidate(
+    const GDALRasterBlock *poBlock) const
+{
+    if (poBlock->poPrevious != nullptr)
+        return poBlock->poPrevious;
+    if (!poBlock->bProtected)
+        return aoLists[1].poOldest;
+    return nullptr;
+}
+
 /************************************************************************/
 /*                               Detach()                               */
 /************************************************************************/
@@ -648,33 +1085,37 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(GetShard(poBand, nXOff, nYOff));
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
-
-    if (poNewest == this)
-    {
-        poNewest = poNext;
-    }
-
-    if (poPrevious != nullptr)
-        poPrevious->poNext = poNext;
+    GDALRasterBlockCacheShard *psShard = GetShard(poBand, nXOff, nYOff);
 
-    if (poNext != nullptr)
-        poNext->poPrevious = poPrevious;
+    const bool bLinked = psShard->IsLinked(this);
+    if (bLinked)
+        psShard->Unlink(this);
 
-    poPrevious = nullptr;
-    poNext = nullptr;
     bMustDetach = false;
 
+    const GIntBig nEffectiveSize =
+        pData ? GetEffectiveBlockSize(GetBlockSize()) : 0;
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+    {
+        psShard->IncCacheUsed(-nEffectiveSize);
+        if (poBand->poBandBlockCache)
+            poBand->poBandBlockCache->IncCacheUsed(-nEffectiveSize);
+    }
+
+    if (psDatasetList)
+    {
+        if (bLinked)
+            psShard->UnlinkFromDatasetList(this);
+        psShard->ReleaseDatasetList(this, nEffectiveSize);
+        psDatasetList = nullptr;
+    }
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -694,26 +1135,38 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (int iShard = 0; iShard < nShards; ++iShard)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        GDALRasterBlockCacheShard *psShard = &asShards[iShard];
+        TAKE_LOCK(psShard);
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        for (const auto &oList : psShard->aoLists)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(
+                (oList.poNewest == nullptr && oList.poOldest == nullptr) ||
+                (oList.poNewest != nullptr && oList.poOldest != nullptr));
 
-            poLast = poBlock;
-        }
+            if (oList.poNewest != nullptr)
+            {
+                CPLAssert(oList.poNewest->poPrevious == nullptr);
+                CPLAssert(oList.poOldest->poNext == nullptr);
+
+                GDALRasterBlock *poLast = nullptr;
+                int nCount = 0;
+                for (GDALRasterBlock *poBlock = oList.poNewest;
+                     poBlock != nullptr; poBlock = poBlock->poNext)
+                {
+                    CPLAssert(poBlock->poPrevious == poLast);
+
+                    poLast = poBlock;
+                    ++nCount;
+                }
 
-        CPLAssert(poOldest == poLast);
+                CPLAssert(oList.poOldest == poLast);
+                CPLAssert(oList.nBlockCount == nCount);
+                CPL_IGNORE_RET_VAL(nCount);
+            }
+        }
     }
 }
 
@@ -726,24 +1179,29 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-         poBlock = poBlock->poNext)
+    for (int iShard = 0; iShard < nShards; ++iShard)
     {
-        if (poBlock->GetBand() == poBand)
+        TAKE_LOCK(&asShards[iShard]);
+        for (GDALRasterBlock *poBlock =
+                 asShards[iShard].GetFirstEvictionCandidate();
+             poBlock != nullptr;
+             poBlock = asShards[iShard].GetNextEvictionCandidate(poBlock))
         {
-            printf("Cache has still blocks of band %p\n", poBand); /*ok*/
-            printf("Band : %d\n", poBand->GetBand());              /*ok*/
-            printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
-            printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
-            int nBlockXSize, nBlockYSize;
-            poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
-            printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
-            printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
-            printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
-            if (poBand->GetDataset())
-                printf("Dataset : %s\n", /*ok*/
-                       poBand->GetDataset()->GetDescription());
+            if (poBlock->GetBand() == poBand)
+            {
+                printf("Cache has still blocks of band %p\n", poBand); /*ok*/
+                printf("Band : %d\n", poBand->GetBand());              /*ok*/
+                printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
+                printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
+                int nBlockXSize, nBlockYSize;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
+                printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
+                printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
+                if (poBand->GetDataset())
+                    printf("Dataset : %s\n", /*ok*/
+                           poBand->GetDataset()->GetDescription());
+            }
         }
     }
 }
@@ -800,54 +1258,77 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    GDALRasterBlockCacheShard *psShard = GetShard(poBand, nXOff, nYOff);
+    const GDALRasterBlockList &oList =
+        psShard->aoLists[bProtected.load(std::memory_order_relaxed) ? 1 : 0];
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (oList.poNewest == this)
         return;
 
-    TAKE_LOCK;
+    // Lazy promotion (LAZY_LRU and 2Q policies): each move to the head of a
+    // list pushes the other blocks of that list by at most one position, so
+    // this block is at most (nTouchCounter - nLastTouchCounter) positions
+    // away from the head of its list. If it is already among the most
+    // recently used quarter of it, leave it in place, so that hits on hot
+    // blocks do not take the lock.
+    // With the 2Q policy, this also prevents a block from being promoted to
+    // the protected list by accesses that closely follow its loading.
+    // This is also safe to test outside the lock, as a stale value only
+    // results in a (harmless) missed or extra promotion.
+    if (eCachePolicy != GDALBlockCachePolicy::LRU)
+    {
+        const int nBlockCount =
+            oList.nBlockCount.load(std::memory_order_relaxed);
+        if (nBlockCount >= MIN_BLOCKS_FOR_LAZY_TOUCH &&
+            psShard->nTouchCounter.load(std::memory_order_relaxed) -
+                    nLastTouchCounter.load(std::memory_order_relaxed) <
+                static_cast<GUInt32>(nBlockCount / 4))
+        {
+            return;
+        }
+    }
+
+    TAKE_LOCK(psShard);
     Touch_unlocked();
 }
 
 void GDALRasterBlock::Touch_unlocked()
 
 {
+    GDALRasterBlockCacheShard *psShard = GetShard(poBand, nXOff, nYOff);
+
     // Could happen even if tested in Touch() before taking the lock
     // Scenario would be :
     // 0. this is the second block (the one pointed by poNewest->poNext)
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    if (psShard->aoLists[bProtected ? 1 : 0].poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
-
-    if (poPrevious != nullptr)
-        poPrevious->poNext = poNext;
-
-    if (poNext != nullptr)
-        poNext->poPrevious = poPrevious;
-
-    poPrevious = nullptr;
-    poNext = poNewest;
-
-    if (poNewest != nullptr)
+    // A block that is not linked yet is being inserted by Internalize(), and
+    // always starts in the first list. With the 2Q policy, a block that is
+    // accessed again is moved to the protected list.
+    bool bToProtected = false;
+    if (psShard->IsLinked(this))
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        bToProtected = eCachePolicy == GDALBlockCachePolicy::TWO_Q;
+        psShard->Unlink(this);
+        if (psDatasetList)
+            psShard->UnlinkFromDatasetList(this);
     }
-    poNewest = this;
+    psShard->LinkAtHead(this, bToProtected);
+    if (psDatasetList)
+        psShard->LinkAtDatasetListHead(this);
+
+    if (bToProtected)
+        psShard->DemoteProtectedBlocks(nCacheMax / nShards);
 
-    if (poOldest == nullptr)
-    {
-        CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
-    }
 #ifdef ENABLE_DEBUG
     Verify();
 #endif
@@ -875,12 +1356,19 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard locks. Other call places can
     // only be called if we have go through there.
-    const GIntBig nCurCacheMax = GDALGetCacheMax64();
+    const GIntBig nGlobalCacheMax = GDALGetCacheMax64();
+    // Each shard is given an equal share of the cache budget.
+    const GIntBig nCurCacheMax = nGlobalCacheMax / nShards;
+    GDALRasterBlockCacheShard *psShard = GetShard(poBand, nXOff, nYOff);
+    goCacheCounters.IncMisses();
+    GDALAbstractBandBlockCache *poBandBlockCache = poBand->poBandBlockCache;
+    poBandBlockCache->IncMisses();
 
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
+    const GIntBig nEffectiveSize = GetEffectiveBlockSize(nSizeInBytes);
 
     /* -------------------------------------------------------------------- */
     /*      Flush old blocks if we are nearing our memory limit.            */
@@ -888,19 +1376,60 @@ CPLErr GDALRasterBlock::Internalize()
     bool bFirstIter = true;
     bool bLoopAgain = false;
     GDALDataset *poThisDS = poBand->GetDataset();
+    // Soft quota of the dataset, if any. Like the global one, it is split
+    // evenly between the shards.
+    const GIntBig nDatasetCacheMax =
+        poThisDS ? poThisDS->GetCacheMax() / nShards : 0;
     do
     {
         bLoopAgain = false;
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
         {
-            TAKE_LOCK;
+            TAKE_LOCK(psShard);
 
             if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while (nCacheUsed > nCurCacheMax)
             {
+                psShard->IncCacheUsed(nEffectiveSize);
+                poBandBlockCache->IncCacheUsed(nEffectiveSize);
+                if (nDatasetCacheMax > 0)
+                {
+                    psDatasetList = psShard->GetDatasetList(poThisDS);
+                    psDatasetList->nCacheUsed += nEffectiveSize;
+                }
+            }
+            const auto IsOverBudget = [&]()
+            {
+                return psShard->GetCacheUsed() > nCurCacheMax ||
+                       (psDatasetList &&
+                        psDatasetList->nCacheUsed > nDatasetCacheMax);
+            };
+
+            // When only the quota of the dataset is exceeded, only evict
+            // blocks of this dataset, from its own list.
+            bool bOnlyThisDataset =
+                psDatasetList && psShard->GetCacheUsed() <= nCurCacheMax;
+            const auto GetFirstCandidate = [&]()
+            {
+                return bOnlyThisDataset ? psDatasetList->poOldest
+                                        : psShard->GetFirstEvictionCandidate();
+            };
+            const auto GetNextCandidate = [&](const GDALRasterBlock *poBlock)
+            {
+                return bOnlyThisDataset
+                           ? poBlock->poDatasetPrevious
+                           : psShard->GetNextEvictionCandidate(poBlock);
+            };
+
+            GDALRasterBlock *poTarget = GetFirstCandidate();
+            while (IsOverBudget())
+            {
+                if (!bOnlyThisDataset &&
+                    psShard->GetCacheUsed() <= nCurCacheMax)
+                {
+                    bOnlyThisDataset = true;
+                    poTarget = GetFirstCandidate();
+                }
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
                 // In this first pass, only discard dirty blocks of this
                 // dataset. We do this to decrease significantly the likelihood
@@ -932,7 +1461,7 @@ CPLErr GDALRasterBlock::Internalize()
                             poDirtyBlockOtherDataset = poTarget;
                         }
                     }
-                    poTarget = poTarget->poPrevious;
+                    poTarget = GetNextCandidate(poTarget);
                 }
                 if (poTarget == nullptr && poDirtyBlockOtherDataset)
                 {
@@ -945,7 +1474,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = psShard->GetFirstEvictionCandidate();
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -956,7 +1485,8 @@ CPLErr GDALRasterBlock::Internalize()
                                     "Evicting dirty block of another dataset");
                                 break;
                             }
-                            poTarget = poTarget->poPrevious;
+                            poTarget =
+                                psShard->GetNextEvictionCandidate(poTarget);
                         }
                     }
                 }
@@ -975,10 +1505,13 @@ CPLErr GDALRasterBlock::Internalize()
                     }
 #endif
 
-                    GDALRasterBlock *_poPrevious = poTarget->poPrevious;
+                    GDALRasterBlock *poNextCandidate =
+                        GetNextCandidate(poTarget);
 
                     poTarget->Detach_unlocked();
                     poTarget->GetBand()->UnreferenceBlock(poTarget);
+                    goCacheCounters.IncEvictions();
+                    poTarget->poBand->poBandBlockCache->IncEvictions();
 
                     apoBlocksToFree[nBlocksToFree++] = poTarget;
                     if (poTarget->GetDirty())
@@ -986,16 +1519,16 @@ CPLErr GDALRasterBlock::Internalize()
                         // Only free one dirty block at a time so that
                         // other dirty blocks of other bands with the same
                         // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
+                        bLoopAgain = IsOverBudget();
                         break;
                     }
                     if (nBlocksToFree == 64)
                     {
-                        bLoopAgain = (nCacheUsed > nCurCacheMax);
+                        bLoopAgain = IsOverBudget();
                         break;
                     }
 
-                    poTarget = _poPrevious;
+                    poTarget = poNextCandidate;
                 }
                 else
                 {
@@ -1120,9 +1653,12 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    for (auto &sShard : asShards)
+    {
+        if (sShard.hLock != nullptr)
+            CPLDestroyLock(sShard.hLock);
+        sShard.hLock = nullptr;
+    }
 }
 
 /*! @endcond */
@@ -1135,7 +1671,6 @@ void GDALRasterBlock::DestroyRBMutex()
  * Take a lock and Touch().
  *
  * Should only be used by GDALArrayBandBlockCache::TryGetLockedBlockRef()
- * and GDALHashSetBandBlockCache::TryGetLockedBlockRef()
  *
  * @return TRUE if the lock has been successfully acquired. If FALSE, the
  *         block is being evicted by another thread, and so should be
@@ -1143,6 +1678,31 @@ void GDALRasterBlock::DestroyRBMutex()
  */
 
 int GDALRasterBlock::TakeLock()
+{
+    if (!TakeLockNoTouch())
+        return FALSE;
+    Touch();
+    return TRUE;
+}
+
+/************************************************************************/
+/*                          TakeLockNoTouch()                           */
+/************************************************************************/
+
+/**
+ * Take a lock, without calling Touch().
+ *
+ * Should only be used by GDALHashSetBandBlockCache::TryGetLockedBlockRef(),
+ * which must stop announcing the table it reads before calling Touch(), as
+ * blocks are removed from that table with the lock of their cache shard
+ * held.
+ *
+ * @return TRUE if the lock has been successfully acquired. If FALSE, the
+ *         block is being evicted by another thread, and so should be
+ *         considered as invalid.
+ */
+
+int GDALRasterBlock::TakeLockNoTouch()
 {
     const int nLockVal = AddLock();
     CPLAssert(nLockVal >= 0);
@@ -1174,7 +1734,8 @@ int GDALRasterBlock::TakeLock()
 
         return FALSE;
     }
-    Touch();
+    goCacheCounters.IncHits();
+    poBand->poBandBlockCache->IncHits();
     return TRUE;
 }
 
@@ -1205,7 +1766,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(GetShard(poBand, nXOff, nYOff));
 
     return FALSE;
 }
@@ -1214,14 +1775,20 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    for( int iShard = 0; iShard < nShards; ++iShard )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        for( const auto &oList : asShards[iShard].aoLists )
+        {
+            for( GDALRasterBlock *poBlock = oList.poNewest;
+                 poBlock != nullptr;
+                 poBlock = poBlock->poNext )
+            {
+                printf("Block %d\n", iBlock);/*ok*/
+                poBlock->DumpBlock();
+                printf("\n");/*ok*/
+                iBlock++;
+            }
+        }
     }
 }
 
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <complex>
 #include <condition_variable>
+#include <functional>
 #include <limits>
 #include <list>
 #include <memory>
@@ -73,6 +74,11 @@
 
 #endif
 
+#if defined(USE_SSE2) && !defined(__AVX__) && defined(HAVE_AVX_AT_COMPILE_TIME)
+#include "cpl_cpu_features.h"
+#include "overview_avx.h"
+#endif
+
 // To be included after above USE_SSE2 and include gdalsse_priv.h
 // to avoid build issue on Windows x86
 #include "gdal_priv_templates.hpp"
@@ -2381,7 +2387,14 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
 
     const int nChunkRightXOff = nChunkXOff + nChunkXSize;
     const int nChunkBottomYOff = nChunkYOff + nChunkYSize;
-    std::vector<int> anVals(256, 0);
+
+    // 8-bit and 16-bit integer values are counted in a histogram indexed by
+    // the value, instead of searching a list of distinct values.
+    constexpr bool bUseHistogram =
+        std::is_integral_v<T> && sizeof(T) <= sizeof(uint16_t);
+    std::vector<CountType> anHistogram;
+    if constexpr (bUseHistogram)
+        anHistogram.resize(static_cast<size_t>(1) << (8 * sizeof(T)));
 
     /* ==================================================================== */
     /*      Loop over destination scanlines.                                */
@@ -2461,9 +2474,10 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
                 nSrcXOff2 = nChunkRightXOff;
 
             bool bRegularProcessing = false;
-            if constexpr (!std::is_same<T, GByte>::value)
+            if constexpr (!bUseHistogram)
                 bRegularProcessing = true;
-            else if (poColorTable && poColorTable->GetColorEntryCount() > 256)
+            else if (std::is_same<T, GByte>::value && poColorTable &&
+                     poColorTable->GetColorEntryCount() > 256)
                 bRegularProcessing = true;
 
             if (bRegularProcessing)
@@ -2557,19 +2571,16 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
                 else
                     paDstScanline[iDstPixel - nDstXOff] = paVals[iMaxVal];
             }
-            else if constexpr (std::is_same<T, GByte>::value)
-            // ( eSrcDataType == GDT_UInt8 && nEntryCount < 256 )
+            else if constexpr (bUseHistogram)
             {
-                // So we go here for a paletted or non-paletted byte band.
-                // The input values are then between 0 and 255.
-                int nMaxVal = 0;
+                // So we go here for a 8-bit or 16-bit band, paletted or not.
+                // Only the histogram bins touched by the source window are
+                // reset afterwards, so that the cost does not depend on the
+                // number of possible values.
+                using UnsignedT = std::make_unsigned_t<T>;
+                CountType nMaxVal = 0;
                 int iMaxInd = -1;
 
-                // The cost of this zeroing might be high. Perhaps we should
-                // just use the above generic case, and go to this one if the
-                // number of source pixels is large enough
-                std::fill(anVals.begin(), anVals.end(), 0);
-
                 for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
                 {
                     const GPtrDiff_t iTotYOff =
@@ -2578,25 +2589,49 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
                     for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
                     {
                         const T val = paSrcScanline[iX + iTotYOff];
-                        if (!bHasNoData || val != tNoDataValue)
+                        bool bValid;
+                        if constexpr (std::is_same<T, GByte>::value)
+                            bValid = !bHasNoData || val != tNoDataValue;
+                        else
+                            bValid = pabySrcScanlineNodataMask == nullptr ||
+                                     pabySrcScanlineNodataMask[iX + iTotYOff];
+                        if (bValid)
                         {
-                            int nVal = static_cast<int>(val);
-                            if (++anVals[nVal] > nMaxVal)
+                            const int nVal =
+                                static_cast<int>(static_cast<UnsignedT>(val));
+                            if (++anHistogram[nVal] > nMaxVal)
                             {
                                 // Sum the density.
                                 // Is it the most common value so far?
                                 iMaxInd = nVal;
-                                nMaxVal = anVals[nVal];
+                                nMaxVal = anHistogram[nVal];
                             }
                         }
                     }
                 }
 
                 if (iMaxInd == -1)
+                {
                     paDstScanline[iDstPixel - nDstXOff] = tNoDataValue;
+                }
                 else
+                {
                     paDstScanline[iDstPixel - nDstXOff] =
-                        static_cast<T>(iMaxInd);
+                        static_cast<T>(static_cast<UnsignedT>(iMaxInd));
+
+                    for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                    {
+                        const T *const paSrc =
+                            paSrcScanline +
+                            static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                nChunkXSize -
+                            nChunkXOff;
+                        for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                        {
+                            anHistogram[static_cast<UnsignedT>(paSrc[iX])] = 0;
+                        }
+                    }
+                }
             }
         }
     }
@@ -3576,6 +3611,13 @@ static CPLErr GDALResampleChunk_ConvolutionT(
         return CE_Failure;
     }
 
+#if defined(USE_SSE2) && !defined(__AVX__) && defined(HAVE_AVX_AT_COMPILE_TIME)
+    // Use the AVX variant of the vertical pass if the CPU supports it.
+    const bool bUseAVX =
+        CPLHaveRuntimeAVX() &&
+        CPLTestBool(CPLGetConfigOption("GDAL_USE_AVX", "YES"));
+#endif
+
     /* ==================================================================== */
     /*      First pass: horizontal filter                                   */
     /* ==================================================================== */
@@ -4046,6 +4088,23 @@ static CPLErr GDALResampleChunk_ConvolutionT(
                     }
                 }
 #else
+#ifdef HAVE_AVX_AT_COMPILE_TIME
+                if (bUseAVX)
+                {
+                    iFilteredPixelOff = GDALResampleConvolutionVerticalLineAVX(
+                        padfHorizontalFiltered + j, nDstXSize, padfWeights,
+                        nSrcLineCount, pafDstScanline, nDstXSize);
+                    j += iFilteredPixelOff;
+                    if (bHasNoData)
+                    {
+                        for (int k = 0; k < iFilteredPixelOff; k++)
+                        {
+                            pafDstScanline[k] =
+                                replaceValIfNodata(pafDstScanline[k]);
+                        }
+                    }
+                }
+#endif
                 for (; iFilteredPixelOff < nDstXSize - 7;
                      iFilteredPixelOff += 8, j += 8)
                 {
@@ -5636,6 +5695,519 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
     return eErr;
 }
 
+/************************************************************************/
+/*                         GDALOvrApplyNBITS()                          */
+/************************************************************************/
+
+template <class T>
+static void GDALOvrClampToNBITS(T *panData, int nNBITS, size_t nCount)
+{
+    const T nMaxVal = static_cast<T>((1U << nNBITS) - 1);
+    for (size_t i = 0; i < nCount; ++i)
+        panData[i] = std::min(panData[i], nMaxVal);
+}
+
+// Alters nCount values of type eDT as drivers such as GTiff do when writing
+// them to a band with the NBITS metadata item set: unsigned integer values are
+// clipped to the NBITS domain, and Float32 values with NBITS=16 are rounded to
+// half-float precision.
+static void GDALOvrApplyNBITS(void *pData, GDALDataType eDT, int nNBITS,
+                              size_t nCount)
+{
+    if (nNBITS <= 0 || nNBITS >= GDALGetDataTypeSizeBits(eDT))
+        return;
+
+    switch (eDT)
+    {
+        case GDT_UInt8:
+            GDALOvrClampToNBITS(static_cast<GByte *>(pData), nNBITS, nCount);
+            break;
+        case GDT_UInt16:
+            GDALOvrClampToNBITS(static_cast<GUInt16 *>(pData), nNBITS, nCount);
+            break;
+        case GDT_UInt32:
+            GDALOvrClampToNBITS(static_cast<GUInt32 *>(pData), nNBITS, nCount);
+            break;
+        case GDT_Float32:
+            if (nNBITS == 16)
+            {
+                GUInt32 *panData = static_cast<GUInt32 *>(pData);
+                // The driver has already warned about clipped values
+                bool bHasWarned = true;
+                for (size_t i = 0; i < nCount; ++i)
+                {
+                    panData[i] =
+                        CPLHalfToFloat(CPLFloatToHalf(panData[i], bHasWarned));
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/************************************************************************/
+/*                GDALRegenerateOverviewsMultiBandFused()               */
+/************************************************************************/
+
+// Generates all overview levels in a single pass over the source bands.
+// Each level is computed from the previous one, as in the cascading mode of
+// GDALRegenerateOverviewsMultiBand(), but from rows kept in memory rather
+// than re-read from the overview bands just written.
+// bHandled is set to false, and nothing is done, if the overview levels do
+// not allow that mode or if it would require too much memory.
+static CPLErr GDALRegenerateOverviewsMultiBandFused(
+    int nBands, GDALRasterBand *const *papoSrcBands, int nOverviews,
+    GDALRasterBand *const *const *papapoOverviewBands,
+    const char *pszResampling, GDALResampleFunction pfnResampleFn,
+    int nKernelRadius, GDALDataType eDataType, GDALDataType eWrkDataType,
+    const std::vector<bool> &abHasNoData,
+    const std::vector<double> &adfNoDataValue, bool bPropagateNoData,
+    CPLJobQueue *poJobQueue, GIntBig nChunkMaxSize, GIntBig nMaxMemory,
+    double dfTotalPixelCount, GDALProgressFunc pfnProgress,
+    void *pProgressData, bool &bHandled)
+{
+    bHandled = false;
+
+    const int nWrkDataTypeSize =
+        std::max(1, GDALGetDataTypeSizeBytes(eWrkDataType));
+    constexpr int PIXEL_MARGIN = 2;
+
+    struct Level
+    {
+        int nSrcWidth = 0;
+        int nSrcHeight = 0;
+        int nDstWidth = 0;
+        int nDstHeight = 0;
+        double dfXRatioDstToSrc = 0;
+        double dfYRatioDstToSrc = 0;
+        int nOvrFactor = 1;
+        int nDstChunkXSize = 0;
+        int nDstChunkYSize = 0;
+        // Data type of the source lines, before conversion to eWrkDataType
+        GDALDataType eSrcDataType = GDT_Unknown;
+
+        // Next destination line to compute
+        int nDstYOff = 0;
+
+        // Source lines [nBufYOff, nBufYOff + nBufYSize), for each band
+        std::vector<std::vector<GByte>> aabySrcLines{};
+        int nBufYOff = 0;
+        int nBufYSize = 0;
+    };
+
+    std::vector<Level> asLevels(nOverviews);
+    double dfMemRequirement = 0;
+    for (int iOverview = 0; iOverview < nOverviews; ++iOverview)
+    {
+        Level &sLevel = asLevels[iOverview];
+        auto poOvrBand = papapoOverviewBands[0][iOverview];
+        sLevel.nDstWidth = poOvrBand->GetXSize();
+        sLevel.nDstHeight = poOvrBand->GetYSize();
+        if (iOverview == 0)
+        {
+            sLevel.nSrcWidth = papoSrcBands[0]->GetXSize();
+            sLevel.nSrcHeight = papoSrcBands[0]->GetYSize();
+            sLevel.eSrcDataType = eDataType;
+        }
+        else
+        {
+            auto poPrevOvrBand = papapoOverviewBands[0][iOverview - 1];
+            sLevel.nSrcWidth = poPrevOvrBand->GetXSize();
+            sLevel.nSrcHeight = poPrevOvrBand->GetYSize();
+            sLevel.eSrcDataType = poPrevOvrBand->GetRasterDataType();
+            // Each level must be computed from the previous one
+            if (sLevel.nSrcWidth <= sLevel.nDstWidth)
+                return CE_None;
+        }
+        sLevel.dfXRatioDstToSrc =
+            static_cast<double>(sLevel.nSrcWidth) / sLevel.nDstWidth;
+        sLevel.dfYRatioDstToSrc =
+            static_cast<double>(sLevel.nSrcHeight) / sLevel.nDstHeight;
+        sLevel.nOvrFactor = std::max(
+            1, std::max(static_cast<int>(0.5 + sLevel.dfXRatioDstToSrc),
+                        static_cast<int>(0.5 + sLevel.dfYRatioDstToSrc)));
+
+        // Same chunk size as in the non-fused mode
+        poOvrBand->GetBlockSize(&sLevel.nDstChunkXSize,
+                                &sLevel.nDstChunkYSize);
+        const int nFullResYChunk = static_cast<int>(std::min<double>(
+            sLevel.nSrcHeight,
+            PIXEL_MARGIN + sLevel.nDstChunkYSize * sLevel.dfYRatioDstToSrc));
+        const int nFullResYChunkQueried = static_cast<int>(std::min<int64_t>(
+            sLevel.nSrcHeight,
+            nFullResYChunk + static_cast<int64_t>(RADIUS_TO_DIAMETER) *
+                                 nKernelRadius * sLevel.nOvrFactor));
+        while (sLevel.nDstChunkXSize < sLevel.nDstWidth)
+        {
+            constexpr int INCREASE_FACTOR = 2;
+
+            const int nFullResXChunk = static_cast<int>(std::min<double>(
+                sLevel.nSrcWidth, PIXEL_MARGIN + INCREASE_FACTOR *
+                                                     sLevel.nDstChunkXSize *
+                                                     sLevel.dfXRatioDstToSrc));
+
+            const int nFullResXChunkQueried =
+                static_cast<int>(std::min<int64_t>(
+                    sLevel.nSrcWidth,
+                    nFullResXChunk + static_cast<int64_t>(RADIUS_TO_DIAMETER) *
+                                         nKernelRadius * sLevel.nOvrFactor));
+
+            if (nBands > nChunkMaxSize / nFullResXChunkQueried /
+                             nFullResYChunkQueried / nWrkDataTypeSize)
+            {
+                break;
+            }
+
+            sLevel.nDstChunkXSize *= INCREASE_FACTOR;
+        }
+        sLevel.nDstChunkXSize =
+            std::min(sLevel.nDstChunkXSize, sLevel.nDstWidth);
+
+        // Source lines kept in memory: the ones needed for a destination
+        // chunk, plus the lines appended at once by the previous level.
+        const int nAppendedLines =
+            iOverview == 0 ? 0 : asLevels[iOverview - 1].nDstChunkYSize;
+        dfMemRequirement += static_cast<double>(sLevel.nSrcWidth) *
+                            (nFullResYChunkQueried + nAppendedLines) * nBands *
+                            nWrkDataTypeSize;
+    }
+    if (dfMemRequirement > static_cast<double>(nMaxMemory))
+    {
+        CPLDebug("GDAL",
+                 "Fused overview generation would require %.0f bytes. "
+                 "Using cascading mode",
+                 dfMemRequirement);
+        return CE_None;
+    }
+    bHandled = true;
+
+    for (auto &sLevel : asLevels)
+        sLevel.aabySrcLines.resize(nBands);
+
+    struct FusedJob
+    {
+        GDALResampleFunction pfnResampleFn = nullptr;
+        GDALOverviewResampleArgs args{};
+        const void *pChunk = nullptr;
+        std::vector<GByte> abyChunk{};
+        CPLErr eErr = CE_Failure;
+        void *pDstBuffer = nullptr;
+        GDALDataType eDstBufferDataType = GDT_Unknown;
+    };
+
+    const auto JobResampleFunc = [](void *pData)
+    {
+        FusedJob *psJob = static_cast<FusedJob *>(pData);
+        psJob->eErr =
+            psJob->pfnResampleFn(psJob->args, psJob->pChunk,
+                                 &(psJob->pDstBuffer),
+                                 &(psJob->eDstBufferDataType));
+    };
+
+    double dfCurPixelCount = 0;
+    std::vector<FusedJob> asJobs;
+
+    // Appends to the source lines of level iLevel
+    const auto AppendSrcLines = [&asLevels, nBands, nWrkDataTypeSize](
+                                    int iLevel, int nLines)
+    {
+        Level &sLevel = asLevels[iLevel];
+        const size_t nLineSize =
+            static_cast<size_t>(sLevel.nSrcWidth) * nWrkDataTypeSize;
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            sLevel.aabySrcLines[iBand].resize(
+                (sLevel.nBufYSize + nLines) * nLineSize);
+        }
+        sLevel.nBufYSize += nLines;
+        return nLineSize;
+    };
+
+    // Computes the next chunk of lines of level iLevel
+    std::function<CPLErr(int)> ComputeNextChunk;
+
+    // Makes sure that the source lines of level iLevel up to nYEnd are
+    // available
+    const auto AcquireSrcLines = [&](int iLevel, int nYEnd)
+    {
+        Level &sLevel = asLevels[iLevel];
+        CPLErr eErr = CE_None;
+        while (eErr == CE_None && sLevel.nBufYOff + sLevel.nBufYSize < nYEnd)
+        {
+            if (iLevel == 0)
+            {
+                const int nYOff = sLevel.nBufYOff + sLevel.nBufYSize;
+                const int nLines = nYEnd - nYOff;
+                const size_t nLineSize = AppendSrcLines(iLevel, nLines);
+                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
+                {
+                    eErr = papoSrcBands[iBand]->RasterIO(
+                        GF_Read, 0, nYOff, sLevel.nSrcWidth, nLines,
+                        sLevel.aabySrcLines[iBand].data() +
+                            (nYOff - sLevel.nBufYOff) * nLineSize,
+                        sLevel.nSrcWidth, nLines, eWrkDataType, 0, 0, nullptr);
+                }
+            }
+            else
+            {
+                eErr = ComputeNextChunk(iLevel - 1);
+            }
+        }
+        return eErr;
+    };
+
+    ComputeNextChunk = [&](int iLevel)
+    {
+        Level &sLevel = asLevels[iLevel];
+        const int nDstYOff = sLevel.nDstYOff;
+        const int nDstYCount =
+            std::min(sLevel.nDstChunkYSize, sLevel.nDstHeight - nDstYOff);
+
+        // Same source window as in the non-fused mode
+        const int nChunkYOff =
+            static_cast<int>(nDstYOff * sLevel.dfYRatioDstToSrc);
+        int nChunkYOff2 = static_cast<int>(
+            ceil((nDstYOff + nDstYCount) * sLevel.dfYRatioDstToSrc));
+        if (nChunkYOff2 > sLevel.nSrcHeight ||
+            nDstYOff + nDstYCount == sLevel.nDstHeight)
+            nChunkYOff2 = sLevel.nSrcHeight;
+        int nChunkYOffQueried = nChunkYOff - nKernelRadius * sLevel.nOvrFactor;
+        int nChunkYSizeQueried =
+            nChunkYOff2 - nChunkYOff +
+            RADIUS_TO_DIAMETER * nKernelRadius * sLevel.nOvrFactor;
+        if (nChunkYOffQueried < 0)
+        {
+            nChunkYSizeQueried += nChunkYOffQueried;
+            nChunkYOffQueried = 0;
+        }
+        if (nChunkYSizeQueried + nChunkYOffQueried > sLevel.nSrcHeight)
+            nChunkYSizeQueried = sLevel.nSrcHeight - nChunkYOffQueried;
+
+        // Discard source lines that will no longer be needed
+        const size_t nSrcLineSize =
+            static_cast<size_t>(sLevel.nSrcWidth) * nWrkDataTypeSize;
+        if (nChunkYOffQueried > sLevel.nBufYOff)
+        {
+            const int nDiscarded = std::min(nChunkYOffQueried - sLevel.nBufYOff,
+                                            sLevel.nBufYSize);
+            for (auto &abySrcLines : sLevel.aabySrcLines)
+            {
+                abySrcLines.erase(abySrcLines.begin(),
+                                  abySrcLines.begin() +
+                                      nDiscarded * nSrcLineSize);
+            }
+            sLevel.nBufYOff += nDiscarded;
+            sLevel.nBufYSize -= nDiscarded;
+        }
+
+        CPLErr eErr =
+            AcquireSrcLines(iLevel, nChunkYOffQueried + nChunkYSizeQueried);
+        if (eErr != CE_None)
+            return eErr;
+
+        // Prepare one job per band and destination chunk column
+        asJobs.clear();
+        asJobs.reserve(static_cast<size_t>(nBands) *
+                       DIV_ROUND_UP(sLevel.nDstWidth, sLevel.nDstChunkXSize));
+        for (int nDstXOff = 0; nDstXOff < sLevel.nDstWidth;
+             nDstXOff += sLevel.nDstChunkXSize)
+        {
+            const int nDstXCount =
+                std::min(sLevel.nDstChunkXSize, sLevel.nDstWidth - nDstXOff);
+            const int nChunkXOff =
+                static_cast<int>(nDstXOff * sLevel.dfXRatioDstToSrc);
+            int nChunkXOff2 = static_cast<int>(
+                ceil((nDstXOff + nDstXCount) * sLevel.dfXRatioDstToSrc));
+            if (nChunkXOff2 > sLevel.nSrcWidth ||
+                nDstXOff + nDstXCount == sLevel.nDstWidth)
+                nChunkXOff2 = sLevel.nSrcWidth;
+            int nChunkXOffQueried =
+                nChunkXOff - nKernelRadius * sLevel.nOvrFactor;
+            int nChunkXSizeQueried =
+                nChunkXOff2 - nChunkXOff +
+                RADIUS_TO_DIAMETER * nKernelRadius * sLevel.nOvrFactor;
+            if (nChunkXOffQueried < 0)
+            {
+                nChunkXSizeQueried += nChunkXOffQueried;
+                nChunkXOffQueried = 0;
+            }
+            if (nChunkXSizeQueried + nChunkXOffQueried > sLevel.nSrcWidth)
+                nChunkXSizeQueried = sLevel.nSrcWidth - nChunkXOffQueried;
+
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                asJobs.emplace_back();
+                FusedJob &sJob = asJobs.back();
+                sJob.pfnResampleFn = pfnResampleFn;
+                auto poDstBand = papapoOverviewBands[iBand][iLevel];
+                sJob.args.eOvrDataType = poDstBand->GetRasterDataType();
+                sJob.args.nOvrXSize = sLevel.nDstWidth;
+                sJob.args.nOvrYSize = sLevel.nDstHeight;
+                const char *pszNBITS =
+                    poDstBand->GetMetadataItem("NBITS", "IMAGE_STRUCTURE");
+                sJob.args.nOvrNBITS = pszNBITS ? atoi(pszNBITS) : 0;
+                sJob.args.dfXRatioDstToSrc = sLevel.dfXRatioDstToSrc;
+                sJob.args.dfYRatioDstToSrc = sLevel.dfYRatioDstToSrc;
+                sJob.args.eWrkDataType = eWrkDataType;
+                sJob.args.nChunkXOff = nChunkXOffQueried;
+                sJob.args.nChunkXSize = nChunkXSizeQueried;
+                sJob.args.nChunkYOff = nChunkYOffQueried;
+                sJob.args.nChunkYSize = nChunkYSizeQueried;
+                sJob.args.nDstXOff = nDstXOff;
+                sJob.args.nDstXOff2 = nDstXOff + nDstXCount;
+                sJob.args.nDstYOff = nDstYOff;
+                sJob.args.nDstYOff2 = nDstYOff + nDstYCount;
+                sJob.args.pszResampling = pszResampling;
+                sJob.args.bHasNoData = abHasNoData[iBand];
+                sJob.args.dfNoDataValue = adfNoDataValue[iBand];
+                sJob.args.eSrcDataType = sLevel.eSrcDataType;
+                sJob.args.bPropagateNoData = bPropagateNoData;
+
+                const GByte *pabySrc =
+                    sLevel.aabySrcLines[iBand].data() +
+                    (nChunkYOffQueried - sLevel.nBufYOff) * nSrcLineSize;
+                if (nChunkXSizeQueried == sLevel.nSrcWidth)
+                {
+                    sJob.pChunk = pabySrc;
+                }
+                else
+                {
+                    const size_t nChunkLineSize =
+                        static_cast<size_t>(nChunkXSizeQueried) *
+                        nWrkDataTypeSize;
+                    try
+                    {
+                        sJob.abyChunk.resize(nChunkLineSize *
+                                             nChunkYSizeQueried);
+                    }
+                    catch (const std::exception &)
+                    {
+                        CPLError(CE_Failure, CPLE_OutOfMemory,
+                                 "Out of memory allocating temporary buffer");
+                        return CE_Failure;
+                    }
+                    for (int iLine = 0; iLine < nChunkYSizeQueried; ++iLine)
+                    {
+                        memcpy(sJob.abyChunk.data() + iLine * nChunkLineSize,
+                               pabySrc + iLine * nSrcLineSize +
+                                   static_cast<size_t>(nChunkXOffQueried) *
+                                       nWrkDataTypeSize,
+                               nChunkLineSize);
+                    }
+                    sJob.pChunk = sJob.abyChunk.data();
+                }
+            }
+        }
+
+        if (poJobQueue)
+        {
+            for (auto &sJob : asJobs)
+                poJobQueue->SubmitJob(JobResampleFunc, &sJob);
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            for (auto &sJob : asJobs)
+                JobResampleFunc(&sJob);
+        }
+
+        // Write the destination chunks, and append them to the source lines
+        // of the next level.
+        const bool bHasNextLevel = iLevel + 1 < nOverviews;
+        size_t nNextLineSize = 0;
+        if (bHasNextLevel)
+            nNextLineSize = AppendSrcLines(iLevel + 1, nDstYCount);
+        for (const auto &sJob : asJobs)
+        {
+            if (eErr == CE_None)
+                eErr = sJob.eErr;
+            if (eErr != CE_None)
+                continue;
+            const int iBand = static_cast<int>(&sJob - asJobs.data()) % nBands;
+            const int nDstXCount = sJob.args.nDstXOff2 - sJob.args.nDstXOff;
+            eErr = papapoOverviewBands[iBand][iLevel]->RasterIO(
+                GF_Write, sJob.args.nDstXOff, nDstYOff, nDstXCount, nDstYCount,
+                sJob.pDstBuffer, nDstXCount, nDstYCount,
+                sJob.eDstBufferDataType, 0, 0, nullptr);
+            if (eErr == CE_None && bHasNextLevel)
+            {
+                // Go through the data type and the NBITS domain of the
+                // overview band, so that the next level gets the same values
+                // as if it had read them.
+                Level &sNextLevel = asLevels[iLevel + 1];
+                const GDALDataType eOvrDataType = sJob.args.eOvrDataType;
+                const int nDstDTSize =
+                    GDALGetDataTypeSizeBytes(sJob.eDstBufferDataType);
+                const int nDTSize = GDALGetDataTypeSizeBytes(eOvrDataType);
+                std::vector<GByte> abyTmp(static_cast<size_t>(nDstXCount) *
+                                          nDTSize);
+                for (int iLine = 0; iLine < nDstYCount; ++iLine)
+                {
+                    GDALCopyWords64(static_cast<const GByte *>(
+                                        sJob.pDstBuffer) +
+                                        static_cast<size_t>(iLine) *
+                                            nDstXCount * nDstDTSize,
+                                    sJob.eDstBufferDataType, nDstDTSize,
+                                    abyTmp.data(), eOvrDataType, nDTSize,
+                                    nDstXCount);
+                    GDALOvrApplyNBITS(abyTmp.data(), eOvrDataType,
+                                      sJob.args.nOvrNBITS, nDstXCount);
+                    GDALCopyWords64(
+                        abyTmp.data(), eOvrDataType, nDTSize,
+                        sNextLevel.aabySrcLines[iBand].data() +
+                            (nDstYOff + iLine - sNextLevel.nBufYOff) *
+                                nNextLineSize +
+                            static_cast<size_t>(sJob.args.nDstXOff) *
+                                nWrkDataTypeSize,
+                        eWrkDataType, nWrkDataTypeSize, nDstXCount);
+                }
+            }
+        }
+        for (auto &sJob : asJobs)
+            VSIFree(sJob.pDstBuffer);
+        asJobs.clear();
+
+        sLevel.nDstYOff += nDstYCount;
+
+        dfCurPixelCount += static_cast<double>(sLevel.nDstWidth) * nDstYCount;
+        if (eErr == CE_None &&
+            !pfnProgress(std::min(1.0, dfCurPixelCount / dfTotalPixelCount),
+                         nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+        return eErr;
+    };
+
+    CPLDebug("GDAL", "Generating %d overview levels in a single pass",
+             nOverviews);
+
+    CPLErr eErr = CE_None;
+    Level &sLastLevel = asLevels.back();
+    while (eErr == CE_None && sLastLevel.nDstYOff < sLastLevel.nDstHeight)
+    {
+        eErr = ComputeNextChunk(nOverviews - 1);
+    }
+
+    // Flush the data to overviews.
+    for (int iOverview = 0; iOverview < nOverviews; ++iOverview)
+    {
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            if (papapoOverviewBands[iBand][iOverview]->FlushCache(false) !=
+                CE_None)
+                eErr = CE_Failure;
+        }
+    }
+
+    if (eErr == CE_None)
+        pfnProgress(1.0, nullptr, pProgressData);
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                  GDALRegenerateOverviewsMultiBand()                  */
 /************************************************************************/
@@ -5674,6 +6246,10 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
  * to "ALL_CPUS" or a integer value to specify the number of threads to use for
  * overview computation.
  *
+ * Starting with GDAL 3.14, the GDAL_OVR_FUSED_PYRAMID configuration option can
+ * be set to YES to compute all overview levels in a single pass over the
+ * source bands.
+ *
  * @param nBands the number of bands, size of papoSrcBands and size of
  *               first dimension of papapoOverviewBands
  * @param papoSrcBands the list of source bands to downsample
@@ -5877,6 +6453,21 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         return 100 * 1024 * 1024;
     }();
 
+    if (nOverviews > 1 && !bUseNoDataMask && nSrcXOff == 0 && nSrcYOff == 0 &&
+        nSrcXSize == nToplevelSrcWidth && nSrcYSize == nToplevelSrcHeight &&
+        CPLTestBool(CPLGetConfigOption("GDAL_OVR_FUSED_PYRAMID", "NO")))
+    {
+        bool bHandled = false;
+        const CPLErr eErr = GDALRegenerateOverviewsMultiBandFused(
+            nBands, papoSrcBands, nOverviews, papapoOverviewBands,
+            pszResampling, pfnResampleFn, nKernelRadius, eDataType,
+            eWrkDataType, abHasNoData, adfNoDataValue, bPropagateNoData,
+            poJobQueue.get(), nChunkMaxSize, nChunkMaxSizeForTempFile,
+            dfTotalPixelCount, pfnProgress, pProgressData, bHandled);
+        if (bHandled)
+            return eErr;
+    }
+
     // Second pass to do the real job.
     double dfCurPixelCount = 0;
     CPLErr eErr = CE_None;
@@ -0,0 +1,84 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX-optimized functions used by overview computation
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "overview_avx.h"
+
+#ifdef __AVX__
+
+#include <immintrin.h>
+
+/************************************************************************/
+/*               GDALResampleConvolutionVerticalLineAVX()               */
+/************************************************************************/
+
+// Vertical pass of the convolution, on 16 columns at a time, for builds where
+// AVX is not enabled at compile time but available at runtime.
+// The operations are done in the same order as the SSE2 code path of
+// overview.cpp, so that results are bit-identical.
+// Only raw intrinsics are used here, and no inline functions shared with
+// other translation units, so that the linker cannot pick AVX-compiled
+// copies of them for code paths that run on CPUs without AVX.
+// Returns the number of processed columns, which is a multiple of 16.
+
+int GDALResampleConvolutionVerticalLineAVX(const double *padfSrc,
+                                           size_t nStride,
+                                           const double *padfWeights,
+                                           int nSrcLineCount, float *pafDest,
+                                           int nDestCount)
+{
+    int iCol = 0;
+    for (; iCol < nDestCount - 15; iCol += 16)
+    {
+        const double *pChunk = padfSrc + iCol;
+        int i = 0;
+        size_t j = 0;
+        __m256d v_acc0 = _mm256_setzero_pd();
+        __m256d v_acc1 = _mm256_setzero_pd();
+        __m256d v_acc2 = _mm256_setzero_pd();
+        __m256d v_acc3 = _mm256_setzero_pd();
+        for (; i < nSrcLineCount - 3; i += 4, j += 4 * nStride)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                const __m256d w = _mm256_set1_pd(padfWeights[i + k]);
+                const double *pLine = pChunk + j + k * nStride;
+                v_acc0 = _mm256_add_pd(
+                    v_acc0, _mm256_mul_pd(_mm256_loadu_pd(pLine + 0), w));
+                v_acc1 = _mm256_add_pd(
+                    v_acc1, _mm256_mul_pd(_mm256_loadu_pd(pLine + 4), w));
+                v_acc2 = _mm256_add_pd(
+                    v_acc2, _mm256_mul_pd(_mm256_loadu_pd(pLine + 8), w));
+                v_acc3 = _mm256_add_pd(
+                    v_acc3, _mm256_mul_pd(_mm256_loadu_pd(pLine + 12), w));
+            }
+        }
+        for (; i < nSrcLineCount; ++i, j += nStride)
+        {
+            const __m256d w = _mm256_set1_pd(padfWeights[i]);
+            const double *pLine = pChunk + j;
+            v_acc0 = _mm256_add_pd(
+                v_acc0, _mm256_mul_pd(_mm256_loadu_pd(pLine + 0), w));
+            v_acc1 = _mm256_add_pd(
+                v_acc1, _mm256_mul_pd(_mm256_loadu_pd(pLine + 4), w));
+            v_acc2 = _mm256_add_pd(
+                v_acc2, _mm256_mul_pd(_mm256_loadu_pd(pLine + 8), w));
+            v_acc3 = _mm256_add_pd(
+                v_acc3, _mm256_mul_pd(_mm256_loadu_pd(pLine + 12), w));
+        }
+        _mm_storeu_ps(pafDest + iCol, _mm256_cvtpd_ps(v_acc0));
+        _mm_storeu_ps(pafDest + iCol + 4, _mm256_cvtpd_ps(v_acc1));
+        _mm_storeu_ps(pafDest + iCol + 8, _mm256_cvtpd_ps(v_acc2));
+        _mm_storeu_ps(pafDest + iCol + 12, _mm256_cvtpd_ps(v_acc3));
+    }
+    return iCol;
+}
+
+#endif  // __AVX__
@@ -0,0 +1,29 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX-optimized functions used by overview computation
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OVERVIEW_AVX_H
+#define OVERVIEW_AVX_H
+
+#include "cpl_port.h"
+
+#include <cstddef>
+
+//! @cond Doxygen_Suppress
+
+int GDALResampleConvolutionVerticalLineAVX(const double *padfSrc,
+                                           size_t nStride,
+                                           const double *padfWeights,
+                                           int nSrcLineCount, float *pafDest,
+                                           int nDestCount);
+
+//! @endcond
+
+#endif
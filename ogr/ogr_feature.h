@@ -2129,6 +2129,11 @@ class CPL_DLL OGRFeatureQuery
     {
         return pSWQExpr;
     }
+
+    const swq_evaluation_context &GetContext() const
+    {
+        return *m_psContext;
+    }
 };
 
 //! @endcond
@@ -320,6 +320,7 @@ const char CPL_UNSTABLE_API *SWQFieldTypeToString(swq_field_type field_type);
 #define SWQM_SUMMARY_RECORD 1
 #define SWQM_RECORDSET 2
 #define SWQM_DISTINCT_LIST 3
+#define SWQM_GROUP_BY 4
 
 typedef enum
 {
@@ -406,6 +407,14 @@ typedef struct
     int ascending_flag;
 } swq_order_def;
 
+typedef struct
+{
+    char *table_name;
+    char *field_name;
+    int table_index;
+    int field_index;
+} swq_group_def;
+
 typedef struct
 {
     int secondary_table;
@@ -471,6 +480,10 @@ class CPL_UNSTABLE_API swq_select
 
     swq_expr_node *where_expr = nullptr;
 
+    void PushGroupBy(const char *pszTableName, const char *pszFieldName);
+    int group_specs = 0;
+    swq_group_def *group_defs = nullptr;
+
     void PushOrderBy(const char *pszTableName, const char *pszFieldName,
                      int bAscending);
     int order_specs = 0;
@@ -498,6 +511,7 @@ class CPL_UNSTABLE_API swq_select
 
   private:
     bool IsFieldExcluded(int src_index, const char *table, const char *field);
+    CPLErr CheckGroupBy(swq_field_list *field_list);
 
     // map of EXCLUDE columns keyed according to the index of the
     // asterisk with which it should be associated. key of -1 is
@@ -527,6 +541,13 @@ swq_expr_node *swq_create_and_or_or(swq_op op, swq_expr_node *left,
                                     swq_expr_node *right);
 int swq_test_like(const char *input, const char *pattern, char chEscape,
                   bool insensitive, bool bUTF8Strings);
+void swq_summary_init(swq_summary &summary);
+const char *swq_summary_accumulate(swq_summary &summary,
+                                   const swq_col_def *def,
+                                   const char *pszValue,
+                                   const double *pdfValue);
+void swq_summary_merge(swq_summary &summary, const swq_summary &other,
+                       const swq_col_def *def);
 #endif
 
 #endif /* #ifndef DOXYGEN_SKIP */
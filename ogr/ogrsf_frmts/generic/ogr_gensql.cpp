@@ -19,10 +19,16 @@
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -46,6 +52,375 @@ class OGRGenSQLGeomFieldDefn final : public OGRGeomFieldDefn
 
 OGRGenSQLGeomFieldDefn::~OGRGenSQLGeomFieldDefn() = default;
 
+/************************************************************************/
+/*                       OGRGenSQLGetMaxMemory()                        */
+/************************************************************************/
+
+// Parses the value of a memory budget configuration option
+
+static size_t OGRGenSQLGetMaxMemory(const char *pszMaxMemory)
+{
+    GIntBig nMaxMemory = 0;
+    if (CPLParseMemorySize(pszMaxMemory, &nMaxMemory, nullptr) != CE_None)
+    {
+        nMaxMemory = 100 * 1024 * 1024;
+    }
+    return static_cast<size_t>(std::min<GIntBig>(
+        nMaxMemory, std::numeric_limits<size_t>::max() / 2));
+}
+
+/************************************************************************/
+/*                 OGRGenSQLResultsLayer::JoinHashTable                 */
+/************************************************************************/
+
+// Features of the secondary layer of a join whose expression is an equality
+// between a field of the primary layer and a field of the secondary layer,
+// indexed by the value of the secondary field. The table is built by a
+// single scan of the secondary layer, which replaces the per primary feature
+// attribute filter on it. It is built at the first lookup. Only the first
+// feature of each key is retained, as only the first match is used. The
+// serialized features are stored in memory until OGR_SQL_HASH_JOIN_MAX_MEMORY
+// is reached, and in a temporary file afterwards. The keys are always kept in
+// memory.
+
+struct OGRGenSQLResultsLayer::JoinHashTable
+{
+    OGRLayer *const m_poLayer;
+    const int m_iPrimaryField;
+    const int m_iSecondaryField;
+    // OFTInteger64, OFTReal or OFTString
+    const OGRFieldType m_eKeyType;
+
+    JoinHashTable(OGRLayer *poLayer, int iPrimaryField, int iSecondaryField,
+                  OGRFieldType eKeyType)
+        : m_poLayer(poLayer), m_iPrimaryField(iPrimaryField),
+          m_iSecondaryField(iSecondaryField), m_eKeyType(eKeyType)
+    {
+    }
+
+    ~JoinHashTable();
+
+    bool CanLookup(const OGRFeature *poSrcFeat);
+    std::unique_ptr<OGRFeature> Lookup(const OGRFeature *poSrcFeat);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(JoinHashTable)
+
+    enum class State
+    {
+        PENDING,
+        BUILT,
+        FAILED,
+    };
+
+    State m_eState = State::PENDING;
+
+    std::unordered_map<GIntBig, size_t> m_oMapInteger{};
+    std::unordered_map<double, size_t> m_oMapReal{};
+    std::unordered_map<std::string, size_t> m_oMapString{};
+
+    struct Location
+    {
+        vsi_l_offset nOffset = 0;
+        size_t nFeatureSize = 0;
+        bool bInFile = false;
+    };
+
+    std::vector<Location> m_asLocations{};
+    std::vector<GByte> m_abyMemory{};
+    size_t m_nMaxMemory = 0;
+    std::string m_osTempFilename{};
+    VSILFILE *m_fpTemp = nullptr;
+    vsi_l_offset m_nTempFileSize = 0;
+    std::vector<GByte> m_abyBuffer{};
+
+    static std::string GetStringKey(const char *pszValue);
+    bool Build();
+    bool Store(const OGRFeature *poFeature);
+    const Location *Find(const OGRFeature *poSrcFeat) const;
+};
+
+/************************************************************************/
+/*                           ~JoinHashTable()                           */
+/************************************************************************/
+
+OGRGenSQLResultsLayer::JoinHashTable::~JoinHashTable()
+{
+    if (m_fpTemp)
+    {
+        VSIFCloseL(m_fpTemp);
+        VSIUnlink(m_osTempFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                            GetStringKey()                            */
+/************************************************************************/
+
+// String equality in OGR SQL is case insensitive.
+
+std::string
+OGRGenSQLResultsLayer::JoinHashTable::GetStringKey(const char *pszValue)
+{
+    std::string osKey(pszValue);
+    for (char &ch : osKey)
+    {
+        if (ch >= 'a' && ch <= 'z')
+            ch = static_cast<char>(ch - 'a' + 'A');
+    }
+    return osKey;
+}
+
+/************************************************************************/
+/*                             CanLookup()                              */
+/************************************************************************/
+
+// Returns whether the join of poSrcFeat can be resolved with Lookup(),
+// building the table at the first call. Otherwise the attribute filter on the
+// secondary layer must be used.
+
+bool OGRGenSQLResultsLayer::JoinHashTable::CanLookup(
+    const OGRFeature *poSrcFeat)
+{
+    if (m_eState == State::PENDING)
+        m_eState = Build() ? State::BUILT : State::FAILED;
+    if (m_eState != State::BUILT)
+        return false;
+
+    if (!poSrcFeat->IsFieldSetAndNotNull(m_iPrimaryField))
+        return true;
+    if (m_eKeyType == OFTReal)
+    {
+        // NaN never compares equal, but is not a valid key either
+        return !std::isnan(poSrcFeat->GetFieldAsDouble(m_iPrimaryField));
+    }
+    if (m_eKeyType == OFTString)
+    {
+        // Strings that look like timestamps are compared with special rules
+        // regarding time zones.
+        const char *pszValue = poSrcFeat->GetFieldAsString(m_iPrimaryField);
+        const size_t nLen = strlen(pszValue);
+        return nLen <= 3 || (pszValue[nLen - 3] != ':' &&
+                             strcmp(pszValue + nLen - 3, "+00") != 0);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::JoinHashTable::Build()
+{
+    m_nMaxMemory = OGRGenSQLGetMaxMemory(
+        CPLGetConfigOption("OGR_SQL_HASH_JOIN_MAX_MEMORY", "10%"));
+
+    CPLDebug("GenSQL", "Building hash table of join layer '%s'",
+             m_poLayer->GetName());
+
+    m_poLayer->SetAttributeFilter(nullptr);
+    m_poLayer->ResetReading();
+    bool bRet = true;
+    while (bRet)
+    {
+        std::unique_ptr<OGRFeature> poFeature(m_poLayer->GetNextFeature());
+        if (!poFeature)
+            break;
+        if (!poFeature->IsFieldSetAndNotNull(m_iSecondaryField))
+            continue;
+
+        const size_t nIdx = m_asLocations.size();
+        bool bInserted = false;
+        if (m_eKeyType == OFTInteger64)
+        {
+            bInserted =
+                m_oMapInteger
+                    .emplace(poFeature->GetFieldAsInteger64(m_iSecondaryField),
+                             nIdx)
+                    .second;
+        }
+        else if (m_eKeyType == OFTReal)
+        {
+            const double dfValue =
+                poFeature->GetFieldAsDouble(m_iSecondaryField);
+            if (std::isnan(dfValue))
+                continue;
+            // Normalize -0 to 0
+            bInserted =
+                m_oMapReal.emplace(dfValue == 0 ? 0.0 : dfValue, nIdx).second;
+        }
+        else
+        {
+            bInserted =
+                m_oMapString
+                    .emplace(GetStringKey(poFeature->GetFieldAsString(
+                                 m_iSecondaryField)),
+                             nIdx)
+                    .second;
+        }
+        if (bInserted)
+            bRet = Store(poFeature.get());
+    }
+    m_poLayer->ResetReading();
+
+    if (!bRet)
+    {
+        m_oMapInteger.clear();
+        m_oMapReal.clear();
+        m_oMapString.clear();
+        m_asLocations.clear();
+        m_abyMemory.clear();
+        CPLDebug("GenSQL",
+                 "Building hash table of join layer '%s' failed. "
+                 "Using attribute filters instead",
+                 m_poLayer->GetName());
+        return false;
+    }
+
+    CPLDebug("GenSQL",
+             "Hash table of join layer '%s' built: %u keys, " CPL_FRMT_GUIB
+             " bytes in memory, " CPL_FRMT_GUIB " bytes in temporary file",
+             m_poLayer->GetName(), static_cast<unsigned>(m_asLocations.size()),
+             static_cast<GUIntBig>(m_abyMemory.size()),
+             static_cast<GUIntBig>(m_nTempFileSize));
+    return true;
+}
+
+/************************************************************************/
+/*                               Store()                                */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::JoinHashTable::Store(const OGRFeature *poFeature)
+{
+    if (!poFeature->SerializeToBinary(m_abyBuffer))
+        return false;
+
+    Location sLoc;
+    sLoc.nFeatureSize = m_abyBuffer.size();
+
+    if (m_fpTemp == nullptr &&
+        m_abyBuffer.size() <= m_nMaxMemory - m_abyMemory.size())
+    {
+        sLoc.nOffset = m_abyMemory.size();
+        m_abyMemory.insert(m_abyMemory.end(), m_abyBuffer.begin(),
+                           m_abyBuffer.end());
+    }
+    else
+    {
+        if (m_fpTemp == nullptr)
+        {
+            m_osTempFilename = CPLGenerateTempFilenameSafe("ogr_sql_join");
+            m_fpTemp = VSIFOpenL(m_osTempFilename.c_str(), "wb+");
+            if (m_fpTemp == nullptr)
+            {
+                CPLError(CE_Warning, CPLE_FileIO,
+                         "Cannot create temporary file %s",
+                         m_osTempFilename.c_str());
+                return false;
+            }
+            // Unlink immediately so that the file is cleaned up if the
+            // process is killed (at least on Linux)
+            VSIUnlink(m_osTempFilename.c_str());
+        }
+        sLoc.bInFile = true;
+        sLoc.nOffset = m_nTempFileSize;
+        if (VSIFSeekL(m_fpTemp, m_nTempFileSize, SEEK_SET) != 0 ||
+            VSIFWriteL(m_abyBuffer.data(), 1, m_abyBuffer.size(), m_fpTemp) !=
+                m_abyBuffer.size())
+        {
+            CPLError(CE_Warning, CPLE_FileIO,
+                     "Cannot write into temporary file %s",
+                     m_osTempFilename.c_str());
+            return false;
+        }
+        m_nTempFileSize += m_abyBuffer.size();
+    }
+    m_asLocations.push_back(sLoc);
+    return true;
+}
+
+/************************************************************************/
+/*                                Find()                                */
+/************************************************************************/
+
+const OGRGenSQLResultsLayer::JoinHashTable::Location *
+OGRGenSQLResultsLayer::JoinHashTable::Find(const OGRFeature *poSrcFeat) const
+{
+    size_t nIdx = 0;
+    if (m_eKeyType == OFTInteger64)
+    {
+        const auto oIter = m_oMapInteger.find(
+            poSrcFeat->GetFieldAsInteger64(m_iPrimaryField));
+        if (oIter == m_oMapInteger.end())
+            return nullptr;
+        nIdx = oIter->second;
+    }
+    else if (m_eKeyType == OFTReal)
+    {
+        const double dfValue = poSrcFeat->GetFieldAsDouble(m_iPrimaryField);
+        const auto oIter = m_oMapReal.find(dfValue == 0 ? 0.0 : dfValue);
+        if (oIter == m_oMapReal.end())
+            return nullptr;
+        nIdx = oIter->second;
+    }
+    else
+    {
+        const auto oIter = m_oMapString.find(
+            GetStringKey(poSrcFeat->GetFieldAsString(m_iPrimaryField)));
+        if (oIter == m_oMapString.end())
+            return nullptr;
+        nIdx = oIter->second;
+    }
+    return &m_asLocations[nIdx];
+}
+
+/************************************************************************/
+/*                               Lookup()                               */
+/************************************************************************/
+
+// Returns the first feature of the secondary layer matching poSrcFeat, or
+// nullptr. Must only be called if CanLookup() returned true.
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLResultsLayer::JoinHashTable::Lookup(const OGRFeature *poSrcFeat)
+{
+    if (!poSrcFeat->IsFieldSetAndNotNull(m_iPrimaryField))
+        return nullptr;
+    const Location *psLoc = Find(poSrcFeat);
+    if (psLoc == nullptr)
+        return nullptr;
+
+    const size_t nSize = psLoc->nFeatureSize;
+    const GByte *pabyData = nullptr;
+    if (psLoc->bInFile)
+    {
+        m_abyBuffer.resize(nSize);
+        if (VSIFSeekL(m_fpTemp, psLoc->nOffset, SEEK_SET) != 0 ||
+            VSIFReadL(m_abyBuffer.data(), 1, nSize, m_fpTemp) != nSize)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read from temporary file %s",
+                     m_osTempFilename.c_str());
+            return nullptr;
+        }
+        pabyData = m_abyBuffer.data();
+    }
+    else
+    {
+        pabyData = m_abyMemory.data() + static_cast<size_t>(psLoc->nOffset);
+    }
+
+    auto poFeature = std::make_unique<OGRFeature>(m_poLayer->GetLayerDefn());
+    if (!poFeature->DeserializeFromBinary(pabyData, psLoc->nFeatureSize))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot deserialize feature of join layer '%s'",
+                 m_poLayer->GetName());
+        return nullptr;
+    }
+    return poFeature;
+}
+
 /************************************************************************/
 /*                OGRGenSQLResultsLayerHasSpecialField()                */
 /************************************************************************/
@@ -418,6 +793,41 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
             m_poDefn->AddFieldDefn(&oFDefn);
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Special fields are not supported by GROUP BY, except for        */
+    /*      counting geometries.                                            */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        const int nSrcFieldCount = poSrcDefn->GetFieldCount();
+        for (int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++)
+        {
+            const swq_group_def *psGroupDef = psSelectInfo->group_defs + iGroup;
+            if (psGroupDef->field_index >= nSrcFieldCount)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Special field %s cannot be used in GROUP BY",
+                         psGroupDef->field_name);
+                return;
+            }
+        }
+        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+        {
+            const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+            if (psColDef->col_func != SWQCF_NONE &&
+                psColDef->field_index >= nSrcFieldCount &&
+                !(psColDef->col_func == SWQCF_COUNT &&
+                  IS_GEOM_FIELD_INDEX(poSrcDefn, psColDef->field_index)))
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Special field %s cannot be used in an aggregate "
+                         "function together with GROUP BY",
+                         psColDef->field_name);
+                return;
+            }
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Add implicit geometry field.                                    */
     /* -------------------------------------------------------------------- */
@@ -481,6 +891,8 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
 
     FindAndSetIgnoredFields();
 
+    InitJoinHashTables();
+
     if (!m_bForwardWhereToSourceLayer)
         OGRLayer::SetAttributeFilter(m_osInitialWHERE.c_str());
 }
@@ -653,7 +1065,8 @@ OGRErr OGRGenSQLResultsLayer::SetNextByIndex(GIntBig nIndex)
         return OGRERR_NON_EXISTING_FEATURE;
     }
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-        psSelectInfo->query_mode == SWQM_DISTINCT_LIST || !m_anFIDIndex.empty())
+        psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+        psSelectInfo->query_mode == SWQM_GROUP_BY || !m_anFIDIndex.empty())
     {
         m_nNextIndexFID = nIndex + psSelectInfo->offset;
         return OGRERR_NONE;
@@ -712,6 +1125,13 @@ GIntBig OGRGenSQLResultsLayer::GetFeatureCount(int bForce)
 
         nRet = psSelectInfo->column_summary[0].count;
     }
+    else if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        if (!PrepareGroupBy())
+            return 0;
+
+        nRet = static_cast<GIntBig>(m_apoGroupFeatures.size());
+    }
     else if (psSelectInfo->query_mode != SWQM_RECORDSET)
         return 1;
     else if (m_poAttrQuery == nullptr && !MustEvaluateSpatialFilterOnGenSQL())
@@ -744,6 +1164,7 @@ int OGRGenSQLResultsLayer::TestCapability(const char *pszCap) const
     {
         if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
             psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+            psSelectInfo->query_mode == SWQM_GROUP_BY ||
             !m_anFIDIndex.empty())
             return TRUE;
         else
@@ -857,6 +1278,117 @@ int OGRGenSQLResultsLayer::ContainGeomSpecialField(
     return FALSE;
 }
 
+/************************************************************************/
+/*                      OGRGenSQLSetSummaryField()                      */
+/************************************************************************/
+
+// Sets the value of an aggregate column from its summary
+
+static void OGRGenSQLSetSummaryField(OGRFeature *poFeature, int iField,
+                                     const swq_col_def *psColDef,
+                                     const swq_summary &oSummary)
+{
+    switch (psColDef->col_func)
+    {
+        case SWQCF_NONE:
+        case SWQCF_CUSTOM:
+            break;
+
+        case SWQCF_AVG:
+        {
+            if (oSummary.count > 0)
+            {
+                const double dfAvg = oSummary.sum() / oSummary.count;
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP)
+                {
+                    struct tm brokendowntime;
+                    CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
+                                        &brokendowntime);
+                    poFeature->SetField(
+                        iField, brokendowntime.tm_year + 1900,
+                        brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
+                        brokendowntime.tm_hour, brokendowntime.tm_min,
+                        static_cast<float>(brokendowntime.tm_sec +
+                                           fmod(dfAvg, 1)),
+                        0);
+                }
+                else
+                {
+                    poFeature->SetField(iField, dfAvg);
+                }
+            }
+            break;
+        }
+
+        case SWQCF_MIN:
+        {
+            if (oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP ||
+                    psColDef->field_type == SWQ_STRING)
+                    poFeature->SetField(iField, oSummary.osMin.c_str());
+                else
+                    poFeature->SetField(iField, oSummary.min);
+            }
+            break;
+        }
+
+        case SWQCF_MAX:
+        {
+            if (oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP ||
+                    psColDef->field_type == SWQ_STRING)
+                    poFeature->SetField(iField, oSummary.osMax.c_str());
+                else
+                    poFeature->SetField(iField, oSummary.max);
+            }
+            break;
+        }
+
+        case SWQCF_COUNT:
+        {
+            poFeature->SetField(iField, oSummary.count);
+            break;
+        }
+
+        case SWQCF_SUM:
+        {
+            if (oSummary.count > 0)
+                poFeature->SetField(iField, oSummary.sum());
+            break;
+        }
+
+        case SWQCF_STDDEV_POP:
+        {
+            if (oSummary.count > 0)
+            {
+                const double dfVariance =
+                    oSummary.sq_dist_from_mean_acc / oSummary.count;
+                poFeature->SetField(iField, sqrt(dfVariance));
+            }
+            break;
+        }
+
+        case SWQCF_STDDEV_SAMP:
+        {
+            if (oSummary.count > 1)
+            {
+                const double dfSampleVariance =
+                    oSummary.sq_dist_from_mean_acc / (oSummary.count - 1);
+                poFeature->SetField(iField, sqrt(dfSampleVariance));
+            }
+            break;
+        }
+    }
+}
+
 /************************************************************************/
 /*                           PrepareSummary()                           */
 /************************************************************************/
@@ -1104,123 +1636,892 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
                 const swq_summary &oSummary =
                     psSelectInfo->column_summary[iField];
 
-                switch (psColDef->col_func)
-                {
-                    case SWQCF_NONE:
-                    case SWQCF_CUSTOM:
-                        break;
+                OGRGenSQLSetSummaryField(m_poSummaryFeature.get(), iField,
+                                         psColDef, oSummary);
+            }
+            else if (psColDef->col_func == SWQCF_COUNT)
+                m_poSummaryFeature->SetField(iField, 0);
+        }
+    }
 
-                    case SWQCF_AVG:
-                    {
-                        if (oSummary.count > 0)
-                        {
-                            const double dfAvg =
-                                oSummary.sum() / oSummary.count;
-                            if (psColDef->field_type == SWQ_DATE ||
-                                psColDef->field_type == SWQ_TIME ||
-                                psColDef->field_type == SWQ_TIMESTAMP)
-                            {
-                                struct tm brokendowntime;
-                                CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
-                                                    &brokendowntime);
-                                m_poSummaryFeature->SetField(
-                                    iField, brokendowntime.tm_year + 1900,
-                                    brokendowntime.tm_mon + 1,
-                                    brokendowntime.tm_mday,
-                                    brokendowntime.tm_hour,
-                                    brokendowntime.tm_min,
-                                    static_cast<float>(brokendowntime.tm_sec +
-                                                       fmod(dfAvg, 1)),
-                                    0);
-                            }
-                            else
-                            {
-                                m_poSummaryFeature->SetField(iField, dfAvg);
-                            }
-                        }
-                        break;
-                    }
+    return TRUE;
+}
 
-                    case SWQCF_MIN:
-                    {
-                        if (oSummary.count > 0)
-                        {
-                            if (psColDef->field_type == SWQ_DATE ||
-                                psColDef->field_type == SWQ_TIME ||
-                                psColDef->field_type == SWQ_TIMESTAMP ||
-                                psColDef->field_type == SWQ_STRING)
-                                m_poSummaryFeature->SetField(
-                                    iField, oSummary.osMin.c_str());
-                            else
-                                m_poSummaryFeature->SetField(iField,
-                                                             oSummary.min);
-                        }
-                        break;
-                    }
+/************************************************************************/
+/*                        OGRGenSQLGroupByTable                         */
+/************************************************************************/
 
-                    case SWQCF_MAX:
-                    {
-                        if (oSummary.count > 0)
-                        {
-                            if (psColDef->field_type == SWQ_DATE ||
-                                psColDef->field_type == SWQ_TIME ||
-                                psColDef->field_type == SWQ_TIMESTAMP ||
-                                psColDef->field_type == SWQ_STRING)
-                                m_poSummaryFeature->SetField(
-                                    iField, oSummary.osMax.c_str());
-                            else
-                                m_poSummaryFeature->SetField(iField,
-                                                             oSummary.max);
-                        }
-                        break;
-                    }
+namespace
+{
 
-                    case SWQCF_COUNT:
-                    {
-                        m_poSummaryFeature->SetField(iField, oSummary.count);
-                        break;
-                    }
+// Hash table of the groups of a GROUP BY query, with the aggregates of each
+// group. The key of a group is the concatenation of the binary values of its
+// GROUP BY fields. When aggregating Arrow batches in parallel, each thread
+// fills its own table, and the tables are merged at the end.
+
+class OGRGenSQLGroupByTable
+{
+  public:
+    // Type of the values of a GROUP BY field in the group keys
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    struct Group
+    {
+        // Index of the first source row of the group
+        GIntBig nFirstRow = 0;
+        std::vector<swq_summary> aoSummaries{};
+    };
+
+    explicit OGRGenSQLGroupByTable(const swq_select *psSelectInfo)
+        : m_psSelectInfo(psSelectInfo)
+    {
+    }
+
+    static void AppendNullKey(std::string &osKey)
+    {
+        osKey += '\0';
+    }
+
+    static void AppendIntegerKey(std::string &osKey, GIntBig nValue)
+    {
+        osKey += '\1';
+        osKey.append(reinterpret_cast<const char *>(&nValue), sizeof(nValue));
+    }
+
+    static void AppendRealKey(std::string &osKey, double dfValue)
+    {
+        // So that -0.0 and 0.0, or all NaN values, are in the same group
+        if (dfValue == 0)
+            dfValue = 0;
+        else if (std::isnan(dfValue))
+            dfValue = std::numeric_limits<double>::quiet_NaN();
+        osKey += '\1';
+        osKey.append(reinterpret_cast<const char *>(&dfValue),
+                     sizeof(dfValue));
+    }
+
+    static void AppendStringKey(std::string &osKey, const char *pszValue,
+                                size_t nLen)
+    {
+        osKey += '\1';
+        osKey.append(reinterpret_cast<const char *>(&nLen), sizeof(nLen));
+        osKey.append(pszValue, nLen);
+    }
+
+    Group &GetGroup(const std::string &osKey, GIntBig nRow);
+
+    const char *Accumulate(Group &oGroup, int iColumn, const char *pszValue,
+                           const double *pdfValue);
+
+    void Merge(OGRGenSQLGroupByTable &oOther);
+
+    std::unordered_map<std::string, Group> &GetGroups()
+    {
+        return m_oMapGroups;
+    }
+
+  private:
+    const swq_select *m_psSelectInfo;
+    std::unordered_map<std::string, Group> m_oMapGroups{};
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLGroupByTable)
+};
+
+/************************************************************************/
+/*                              GetGroup()                              */
+/************************************************************************/
+
+OGRGenSQLGroupByTable::Group &
+OGRGenSQLGroupByTable::GetGroup(const std::string &osKey, GIntBig nRow)
+{
+    auto oIter = m_oMapGroups.find(osKey);
+    if (oIter != m_oMapGroups.end())
+        return oIter->second;
+
+    Group &oGroup = m_oMapGroups[osKey];
+    oGroup.nFirstRow = nRow;
+    oGroup.aoSummaries.resize(m_psSelectInfo->column_defs.size());
+    for (auto &oSummary : oGroup.aoSummaries)
+        swq_summary_init(oSummary);
+    return oGroup;
+}
+
+/************************************************************************/
+/*                             Accumulate()                             */
+/************************************************************************/
+
+// Accumulates a non-null value of the field of an aggregate column, or
+// a row for COUNT(*).
+
+const char *OGRGenSQLGroupByTable::Accumulate(Group &oGroup, int iColumn,
+                                              const char *pszValue,
+                                              const double *pdfValue)
+{
+    const swq_col_def *psColDef = &m_psSelectInfo->column_defs[iColumn];
+    swq_summary &oSummary = oGroup.aoSummaries[iColumn];
+    if (psColDef->distinct_flag)
+    {
+        if (oSummary.oSetDistinctValues.insert(pszValue).second)
+            oSummary.count++;
+        return nullptr;
+    }
+    return swq_summary_accumulate(oSummary, psColDef, pszValue, pdfValue);
+}
+
+/************************************************************************/
+/*                               Merge()                                */
+/************************************************************************/
+
+void OGRGenSQLGroupByTable::Merge(OGRGenSQLGroupByTable &oOther)
+{
+    for (auto &[osKey, oOtherGroup] : oOther.m_oMapGroups)
+    {
+        auto oIter = m_oMapGroups.find(osKey);
+        if (oIter == m_oMapGroups.end())
+        {
+            m_oMapGroups.emplace(osKey, std::move(oOtherGroup));
+            continue;
+        }
+        Group &oGroup = oIter->second;
+        oGroup.nFirstRow = std::min(oGroup.nFirstRow, oOtherGroup.nFirstRow);
+        for (size_t i = 0; i < oGroup.aoSummaries.size(); ++i)
+        {
+            swq_summary_merge(oGroup.aoSummaries[i],
+                              oOtherGroup.aoSummaries[i],
+                              &m_psSelectInfo->column_defs[i]);
+        }
+    }
+    oOther.m_oMapGroups.clear();
+}
+
+/************************************************************************/
+/*                      OGRGenSQLArrowColumnReader                      */
+/************************************************************************/
+
+// Reads the values of a column of the Arrow batches of the source layer.
+// Only the types that map to OFTInteger, OFTInteger64, OFTReal and
+// OFTString fields are handled.
+
+class OGRGenSQLArrowColumnReader
+{
+  public:
+    static bool IsSupported(const struct ArrowSchema *psSchema,
+                            OGRFieldType eType)
+    {
+        if (psSchema->dictionary != nullptr || psSchema->format[0] == '\0' ||
+            psSchema->format[1] != '\0')
+            return false;
+        switch (psSchema->format[0])
+        {
+            case 'b':
+            case 'c':
+            case 's':
+            case 'i':
+            case 'l':
+                return eType == OFTInteger || eType == OFTInteger64;
+            case 'f':
+            case 'g':
+                return eType == OFTReal;
+            case 'u':
+            case 'U':
+                return eType == OFTString;
+            default:
+                break;
+        }
+        return false;
+    }
+
+    OGRGenSQLArrowColumnReader(const struct ArrowArray *psArray, char chFormat)
+        : m_psArray(psArray), m_chFormat(chFormat)
+    {
+    }
+
+    bool IsNull(size_t iRow) const
+    {
+        const GByte *pabyValidity =
+            static_cast<const GByte *>(m_psArray->buffers[0]);
+        if (m_psArray->null_count == 0 || pabyValidity == nullptr)
+            return false;
+        iRow += static_cast<size_t>(m_psArray->offset);
+        return (pabyValidity[iRow / 8] & (1 << (iRow % 8))) == 0;
+    }
+
+    bool IsString() const
+    {
+        return m_chFormat == 'u' || m_chFormat == 'U';
+    }
+
+    bool IsReal() const
+    {
+        return m_chFormat == 'f' || m_chFormat == 'g';
+    }
+
+    GIntBig GetInteger(size_t iRow) const
+    {
+        iRow += static_cast<size_t>(m_psArray->offset);
+        const void *pValues = m_psArray->buffers[1];
+        switch (m_chFormat)
+        {
+            case 'b':
+                return (static_cast<const GByte *>(pValues)[iRow / 8] &
+                        (1 << (iRow % 8))) != 0;
+            case 'c':
+                return static_cast<const int8_t *>(pValues)[iRow];
+            case 's':
+                return static_cast<const int16_t *>(pValues)[iRow];
+            case 'i':
+                return static_cast<const int32_t *>(pValues)[iRow];
+            default:
+                break;
+        }
+        return static_cast<const int64_t *>(pValues)[iRow];
+    }
+
+    double GetReal(size_t iRow) const
+    {
+        iRow += static_cast<size_t>(m_psArray->offset);
+        if (m_chFormat == 'f')
+            return static_cast<const float *>(m_psArray->buffers[1])[iRow];
+        return static_cast<const double *>(m_psArray->buffers[1])[iRow];
+    }
+
+    const char *GetString(size_t iRow, size_t &nLen) const
+    {
+        iRow += static_cast<size_t>(m_psArray->offset);
+        const char *pszData = static_cast<const char *>(m_psArray->buffers[2]);
+        if (m_chFormat == 'u')
+        {
+            const auto panOffsets =
+                static_cast<const uint32_t *>(m_psArray->buffers[1]);
+            nLen = panOffsets[iRow + 1] - panOffsets[iRow];
+            return pszData + panOffsets[iRow];
+        }
+        const auto panOffsets =
+            static_cast<const uint64_t *>(m_psArray->buffers[1]);
+        nLen = static_cast<size_t>(panOffsets[iRow + 1] - panOffsets[iRow]);
+        return pszData + static_cast<size_t>(panOffsets[iRow]);
+    }
+
+  private:
+    const struct ArrowArray *m_psArray;
+    const char m_chFormat;
+};
+
+/************************************************************************/
+/*                   OGRGenSQLAggregateArrowStream()                    */
+/************************************************************************/
+
+// Aggregates the Arrow batches of the source layer into oTable. Returns
+// false, with an empty osError, if the source layer has no fast Arrow stream
+// or one of the fields cannot be read from it, in which case nothing has
+// been read.
+
+static bool OGRGenSQLAggregateArrowStream(OGRLayer *poSrcLayer,
+                                          const swq_select *psSelectInfo,
+                                          OGRGenSQLGroupByTable &oTable,
+                                          std::string &osError)
+{
+    OGRFeatureDefn *poSrcDefn = poSrcLayer->GetLayerDefn();
+    const int nSrcFieldCount = poSrcDefn->GetFieldCount();
+
+    if (!poSrcLayer->TestCapability(OLCFastGetArrowStream))
+        return false;
+
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        // COUNT(geometry) is only handled on features. The values of
+        // COUNT(DISTINCT real_field) are formatted as with features.
+        if (psColDef->col_func != SWQCF_NONE &&
+            (psColDef->field_index >= nSrcFieldCount ||
+             (psColDef->distinct_flag && psColDef->field_index >= 0 &&
+              poSrcDefn->GetFieldDefn(psColDef->field_index)->GetType() ==
+                  OFTReal)))
+        {
+            return false;
+        }
+    }
+
+    OGRArrowArrayStream oStream;
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("INCLUDE_FID", "NO");
+    if (!poSrcLayer->GetArrowStream(oStream.get(), aosOptions.List()))
+        return false;
+
+    struct ArrowSchema sSchema;
+    if (oStream.get_schema(&sSchema) != 0)
+        return false;
+
+    // Index of the Arrow column of each source field
+    std::map<int, int> oMapFieldToArrowColumn;
+    std::vector<char> achFormats;
+    bool bSupported = true;
+    const auto GetArrowColumn = [&](int iSrcField)
+    {
+        auto oIter = oMapFieldToArrowColumn.find(iSrcField);
+        if (oIter != oMapFieldToArrowColumn.end())
+            return oIter->second;
+        const OGRFieldDefn *poFieldDefn = poSrcDefn->GetFieldDefn(iSrcField);
+        for (int i = 0; i < static_cast<int>(sSchema.n_children); ++i)
+        {
+            const struct ArrowSchema *psChild = sSchema.children[i];
+            if (strcmp(psChild->name, poFieldDefn->GetNameRef()) == 0)
+            {
+                if (!OGRGenSQLArrowColumnReader::IsSupported(
+                        psChild, poFieldDefn->GetType()))
+                    break;
+                oMapFieldToArrowColumn[iSrcField] = i;
+                return i;
+            }
+        }
+        bSupported = false;
+        return -1;
+    };
+
+    std::vector<int> anGroupColumns;
+    for (int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++)
+    {
+        anGroupColumns.push_back(
+            GetArrowColumn(psSelectInfo->group_defs[iGroup].field_index));
+    }
+    // Arrow column of each aggregate column (-1 for COUNT(*))
+    std::vector<int> anAggregateColumns;
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        anAggregateColumns.push_back(
+            psColDef->col_func != SWQCF_NONE && psColDef->field_index >= 0
+                ? GetArrowColumn(psColDef->field_index)
+                : -1);
+    }
+    for (int i = 0; i < static_cast<int>(sSchema.n_children); ++i)
+        achFormats.push_back(sSchema.children[i]->format[0]);
+    sSchema.release(&sSchema);
+    if (!bSupported)
+        return false;
+
+    const auto AggregateBatch =
+        [psSelectInfo, &anGroupColumns, &anAggregateColumns,
+         &achFormats](OGRGenSQLGroupByTable &oBatchTable,
+                      const struct ArrowArray *psArray, GIntBig nFirstRow)
+    {
+        const auto GetReader = [psArray, &achFormats](int iColumn)
+        {
+            return OGRGenSQLArrowColumnReader(psArray->children[iColumn],
+                                              achFormats[iColumn]);
+        };
+        std::vector<OGRGenSQLArrowColumnReader> aoGroupReaders;
+        for (int iColumn : anGroupColumns)
+            aoGroupReaders.push_back(GetReader(iColumn));
+        std::vector<OGRGenSQLArrowColumnReader> aoAggregateReaders;
+        for (int iColumn : anAggregateColumns)
+        {
+            aoAggregateReaders.push_back(
+                iColumn >= 0 ? GetReader(iColumn)
+                             : OGRGenSQLArrowColumnReader(nullptr, '\0'));
+        }
+
+        std::string osKey;
+        std::string osValue;
+        const size_t nOffset = static_cast<size_t>(psArray->offset);
+        const size_t nLength = static_cast<size_t>(psArray->length);
+        for (size_t iRow = nOffset; iRow < nOffset + nLength; ++iRow)
+        {
+            osKey.clear();
+            for (const auto &oReader : aoGroupReaders)
+            {
+                if (oReader.IsNull(iRow))
+                {
+                    OGRGenSQLGroupByTable::AppendNullKey(osKey);
+                }
+                else if (oReader.IsString())
+                {
+                    size_t nLen = 0;
+                    const char *pszVal = oReader.GetString(iRow, nLen);
+                    OGRGenSQLGroupByTable::AppendStringKey(osKey, pszVal,
+                                                           nLen);
+                }
+                else if (oReader.IsReal())
+                {
+                    OGRGenSQLGroupByTable::AppendRealKey(
+                        osKey, oReader.GetReal(iRow));
+                }
+                else
+                {
+                    OGRGenSQLGroupByTable::AppendIntegerKey(
+                        osKey, oReader.GetInteger(iRow));
+                }
+            }
+
+            auto &oGroup = oBatchTable.GetGroup(
+                osKey, nFirstRow + static_cast<GIntBig>(iRow - nOffset));
+            for (int iField = 0; iField < psSelectInfo->result_columns();
+                 iField++)
+            {
+                const swq_col_def *psColDef =
+                    &psSelectInfo->column_defs[iField];
+                const auto &oReader = aoAggregateReaders[iField];
+                const char *pszError = nullptr;
+                if (psColDef->col_func == SWQCF_NONE)
+                    continue;
+                if (psColDef->field_index < 0)
+                {
+                    // COUNT(*)
+                    pszError =
+                        oBatchTable.Accumulate(oGroup, iField, "", nullptr);
+                }
+                else if (oReader.IsNull(iRow))
+                {
+                    continue;
+                }
+                else if (oReader.IsString())
+                {
+                    size_t nLen = 0;
+                    const char *pszVal = oReader.GetString(iRow, nLen);
+                    osValue.assign(pszVal, nLen);
+                    pszError = oBatchTable.Accumulate(
+                        oGroup, iField, osValue.c_str(), nullptr);
+                }
+                else if (psColDef->distinct_flag)
+                {
+                    pszError = oBatchTable.Accumulate(
+                        oGroup, iField,
+                        CPLSPrintf(CPL_FRMT_GIB, oReader.GetInteger(iRow)),
+                        nullptr);
+                }
+                else
+                {
+                    const double dfValue =
+                        oReader.IsReal()
+                            ? oReader.GetReal(iRow)
+                            : static_cast<double>(oReader.GetInteger(iRow));
+                    pszError = oBatchTable.Accumulate(oGroup, iField, nullptr,
+                                                      &dfValue);
+                }
+                if (pszError)
+                    return pszError;
+            }
+        }
+        return static_cast<const char *>(nullptr);
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Each batch is aggregated by a job of the thread pool into one   */
+    /*      of the tables not in use by other jobs.                         */
+    /* -------------------------------------------------------------------- */
+    const int nThreads =
+        GDALGetNumThreads(GDAL_DEFAULT_MAX_THREAD_COUNT, false);
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+
+    std::vector<std::unique_ptr<OGRGenSQLGroupByTable>> apoTables;
+    std::vector<OGRGenSQLGroupByTable *> apoFreeTables{&oTable};
+    if (poQueue)
+    {
+        for (int i = 1; i < nThreads; ++i)
+        {
+            apoTables.push_back(
+                std::make_unique<OGRGenSQLGroupByTable>(psSelectInfo));
+            apoFreeTables.push_back(apoTables.back().get());
+        }
+    }
+    std::mutex oMutex;
+
+    CPLDebug("GenSQL",
+             "GROUP BY: aggregating Arrow batches of layer '%s' with %d "
+             "thread(s)",
+             poSrcLayer->GetName(), poQueue ? nThreads : 1);
 
-                    case SWQCF_SUM:
+    GIntBig nRows = 0;
+    while (true)
+    {
+        auto psArray = std::make_shared<struct ArrowArray>();
+        memset(psArray.get(), 0, sizeof(*psArray));
+        if (oStream.get_next(psArray.get()) != 0)
+        {
+            osError = "GROUP BY: get_next() failed";
+            break;
+        }
+        if (psArray->release == nullptr)
+            break;
+        if (psArray->n_children != static_cast<int64_t>(achFormats.size()))
+        {
+            psArray->release(psArray.get());
+            osError = CPLSPrintf("GROUP BY: Arrow batch has " CPL_FRMT_GIB
+                                 " columns, whereas %d were expected",
+                                 static_cast<GIntBig>(psArray->n_children),
+                                 static_cast<int>(achFormats.size()));
+            break;
+        }
+        if (psArray->length == 0)
+        {
+            psArray->release(psArray.get());
+            continue;
+        }
+
+        const GIntBig nFirstRow = nRows;
+        nRows += psArray->length;
+        const auto Job = [psArray, nFirstRow, &AggregateBatch, &apoFreeTables,
+                          &oMutex, &osError]()
+        {
+            OGRGenSQLGroupByTable *poTable;
+            {
+                std::lock_guard<std::mutex> oLock(oMutex);
+                poTable = apoFreeTables.back();
+                apoFreeTables.pop_back();
+            }
+            const char *pszError;
+            try
+            {
+                pszError = AggregateBatch(*poTable, psArray.get(), nFirstRow);
+            }
+            catch (const std::bad_alloc &)
+            {
+                pszError = "GROUP BY: out of memory";
+            }
+            psArray->release(psArray.get());
+            std::lock_guard<std::mutex> oLock(oMutex);
+            apoFreeTables.push_back(poTable);
+            if (pszError && osError.empty())
+                osError = pszError;
+        };
+
+        if (poQueue)
+        {
+            // Never more jobs than tables
+            poQueue->WaitCompletion(nThreads - 1);
+            if (!poQueue->SubmitJob(Job))
+                Job();
+        }
+        else
+        {
+            Job();
+        }
+
+        std::lock_guard<std::mutex> oLock(oMutex);
+        if (!osError.empty())
+            break;
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    if (osError.empty())
+    {
+        for (auto &poOtherTable : apoTables)
+            oTable.Merge(*poOtherTable);
+    }
+
+    return true;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                           PrepareGroupBy()                           */
+/************************************************************************/
+
+// Computes the groups of a GROUP BY query, and their aggregates, with a
+// hash table. When the source layer has a fast Arrow stream, the batches are
+// aggregated in parallel, each thread in its own table. Otherwise the source
+// features are read one by one.
+
+bool OGRGenSQLResultsLayer::PrepareGroupBy()
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+
+    if (m_bGroupByDone)
+        return true;
+    m_bGroupByDone = true;
+
+    OGRFeatureDefn *poSrcDefn = m_poSrcLayer->GetLayerDefn();
+
+    // Type of the GROUP BY fields in the group keys
+    std::vector<OGRGenSQLGroupByTable::KeyType> aeKeyTypes;
+    for (int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++)
+    {
+        const swq_group_def *psGroupDef = psSelectInfo->group_defs + iGroup;
+        const OGRFieldType eType =
+            poSrcDefn->GetFieldDefn(psGroupDef->field_index)->GetType();
+        if (eType == OFTInteger || eType == OFTInteger64)
+            aeKeyTypes.push_back(OGRGenSQLGroupByTable::KeyType::INTEGER);
+        else if (eType == OFTReal)
+            aeKeyTypes.push_back(OGRGenSQLGroupByTable::KeyType::REAL);
+        else
+            aeKeyTypes.push_back(OGRGenSQLGroupByTable::KeyType::STRING);
+    }
+
+    ApplyFiltersToSource();
+
+    OGRGenSQLGroupByTable oTable(psSelectInfo);
+    std::string osError;
+    if (!OGRGenSQLAggregateArrowStream(m_poSrcLayer, psSelectInfo, oTable,
+                                       osError) &&
+        osError.empty())
+    {
+        /* ---------------------------------------------------------------- */
+        /*      Read the source features one by one.                        */
+        /* ---------------------------------------------------------------- */
+        GIntBig nRow = 0;
+        std::string osKey;
+        for (auto &&poSrcFeature : *m_poSrcLayer)
+        {
+            osKey.clear();
+            for (int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++)
+            {
+                const int iSrcField =
+                    psSelectInfo->group_defs[iGroup].field_index;
+                if (!poSrcFeature->IsFieldSetAndNotNull(iSrcField))
+                {
+                    OGRGenSQLGroupByTable::AppendNullKey(osKey);
+                    continue;
+                }
+                switch (aeKeyTypes[iGroup])
+                {
+                    case OGRGenSQLGroupByTable::KeyType::INTEGER:
+                        OGRGenSQLGroupByTable::AppendIntegerKey(
+                            osKey,
+                            poSrcFeature->GetFieldAsInteger64(iSrcField));
+                        break;
+                    case OGRGenSQLGroupByTable::KeyType::REAL:
+                        OGRGenSQLGroupByTable::AppendRealKey(
+                            osKey, poSrcFeature->GetFieldAsDouble(iSrcField));
+                        break;
+                    case OGRGenSQLGroupByTable::KeyType::STRING:
                     {
-                        if (oSummary.count > 0)
-                            m_poSummaryFeature->SetField(iField,
-                                                         oSummary.sum());
+                        const char *pszVal =
+                            poSrcFeature->GetFieldAsString(iSrcField);
+                        OGRGenSQLGroupByTable::AppendStringKey(
+                            osKey, pszVal, strlen(pszVal));
                         break;
                     }
+                }
+            }
 
-                    case SWQCF_STDDEV_POP:
+            auto &oGroup = oTable.GetGroup(osKey, nRow++);
+            for (int iField = 0; osError.empty() &&
+                                 iField < psSelectInfo->result_columns();
+                 iField++)
+            {
+                const swq_col_def *psColDef =
+                    &psSelectInfo->column_defs[iField];
+                const char *pszError = nullptr;
+                if (psColDef->col_func == SWQCF_NONE)
+                    continue;
+                if (psColDef->field_index < 0)
+                {
+                    // COUNT(*)
+                    pszError = oTable.Accumulate(oGroup, iField, "", nullptr);
+                }
+                else if (IS_GEOM_FIELD_INDEX(poSrcDefn, psColDef->field_index))
+                {
+                    const int iSrcGeomField =
+                        ALL_FIELD_INDEX_TO_GEOM_FIELD_INDEX(
+                            poSrcDefn, psColDef->field_index);
+                    if (poSrcFeature->GetGeomFieldRef(iSrcGeomField))
+                        pszError =
+                            oTable.Accumulate(oGroup, iField, "", nullptr);
+                }
+                else if (poSrcFeature->IsFieldSetAndNotNull(
+                             psColDef->field_index))
+                {
+                    if (!psColDef->distinct_flag &&
+                        (psColDef->field_type == SWQ_BOOLEAN ||
+                         psColDef->field_type == SWQ_INTEGER ||
+                         psColDef->field_type == SWQ_INTEGER64 ||
+                         psColDef->field_type == SWQ_FLOAT))
                     {
-                        if (oSummary.count > 0)
-                        {
-                            const double dfVariance =
-                                oSummary.sq_dist_from_mean_acc / oSummary.count;
-                            m_poSummaryFeature->SetField(iField,
-                                                         sqrt(dfVariance));
-                        }
-                        break;
+                        const double dfValue = poSrcFeature->GetFieldAsDouble(
+                            psColDef->field_index);
+                        pszError = oTable.Accumulate(oGroup, iField, nullptr,
+                                                     &dfValue);
                     }
-
-                    case SWQCF_STDDEV_SAMP:
+                    else
                     {
-                        if (oSummary.count > 1)
-                        {
-                            const double dfSampleVariance =
-                                oSummary.sq_dist_from_mean_acc /
-                                (oSummary.count - 1);
-                            m_poSummaryFeature->SetField(
-                                iField, sqrt(dfSampleVariance));
-                        }
-                        break;
+                        pszError = oTable.Accumulate(
+                            oGroup, iField,
+                            poSrcFeature->GetFieldAsString(
+                                psColDef->field_index),
+                            nullptr);
                     }
                 }
+                if (pszError)
+                    osError = pszError;
             }
-            else if (psColDef->col_func == SWQCF_COUNT)
-                m_poSummaryFeature->SetField(iField, 0);
+            if (!osError.empty())
+                break;
         }
     }
 
-    return TRUE;
+    ClearFilters();
+
+    if (!osError.empty())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", osError.c_str());
+        return false;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Decode the values of the GROUP BY fields of each group.         */
+    /* -------------------------------------------------------------------- */
+    struct KeyValue
+    {
+        bool bNull = true;
+        GIntBig nValue = 0;
+        double dfValue = 0;
+        std::string osValue{};
+    };
+
+    struct GroupResult
+    {
+        const OGRGenSQLGroupByTable::Group *poGroup = nullptr;
+        std::vector<KeyValue> asValues{};
+    };
+
+    std::vector<GroupResult> asGroups;
+    asGroups.reserve(oTable.GetGroups().size());
+    for (const auto &[osKey, oGroup] : oTable.GetGroups())
+    {
+        asGroups.emplace_back();
+        GroupResult &sResult = asGroups.back();
+        sResult.poGroup = &oGroup;
+        sResult.asValues.resize(aeKeyTypes.size());
+        const char *pabyKey = osKey.data();
+        for (size_t iGroup = 0; iGroup < aeKeyTypes.size(); ++iGroup)
+        {
+            KeyValue &sValue = sResult.asValues[iGroup];
+            sValue.bNull = *pabyKey == '\0';
+            ++pabyKey;
+            if (sValue.bNull)
+                continue;
+            switch (aeKeyTypes[iGroup])
+            {
+                case OGRGenSQLGroupByTable::KeyType::INTEGER:
+                    memcpy(&sValue.nValue, pabyKey, sizeof(sValue.nValue));
+                    pabyKey += sizeof(sValue.nValue);
+                    break;
+                case OGRGenSQLGroupByTable::KeyType::REAL:
+                    memcpy(&sValue.dfValue, pabyKey, sizeof(sValue.dfValue));
+                    pabyKey += sizeof(sValue.dfValue);
+                    break;
+                case OGRGenSQLGroupByTable::KeyType::STRING:
+                {
+                    size_t nLen = 0;
+                    memcpy(&nLen, pabyKey, sizeof(nLen));
+                    pabyKey += sizeof(nLen);
+                    sValue.osValue.assign(pabyKey, nLen);
+                    pabyKey += nLen;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Sort the groups by the ORDER BY fields, or by order of first    */
+    /*      appearance in the source layer otherwise.                       */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anOrderGroupIdx;
+    for (int iOrder = 0; iOrder < psSelectInfo->order_specs; iOrder++)
+    {
+        for (int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++)
+        {
+            if (psSelectInfo->group_defs[iGroup].field_index ==
+                psSelectInfo->order_defs[iOrder].field_index)
+            {
+                anOrderGroupIdx.push_back(iGroup);
+                break;
+            }
+        }
+    }
+    CPLAssert(static_cast<int>(anOrderGroupIdx.size()) ==
+              psSelectInfo->order_specs);
+
+    std::sort(asGroups.begin(), asGroups.end(),
+              [psSelectInfo, &anOrderGroupIdx,
+               &aeKeyTypes](const GroupResult &a, const GroupResult &b)
+              {
+                  for (size_t iOrder = 0; iOrder < anOrderGroupIdx.size();
+                       ++iOrder)
+                  {
+                      const int iGroup = anOrderGroupIdx[iOrder];
+                      const KeyValue &sA = a.asValues[iGroup];
+                      const KeyValue &sB = b.asValues[iGroup];
+                      int nResult = 0;
+                      if (sA.bNull || sB.bNull)
+                          nResult = (sA.bNull ? 0 : 1) - (sB.bNull ? 0 : 1);
+                      else if (aeKeyTypes[iGroup] ==
+                               OGRGenSQLGroupByTable::KeyType::INTEGER)
+                          nResult = (sA.nValue > sB.nValue) -
+                                    (sA.nValue < sB.nValue);
+                      else if (aeKeyTypes[iGroup] ==
+                               OGRGenSQLGroupByTable::KeyType::REAL)
+                      {
+                          // NaN is sorted after all other values, to keep a
+                          // strict weak ordering.
+                          const bool bANaN = std::isnan(sA.dfValue);
+                          const bool bBNaN = std::isnan(sB.dfValue);
+                          if (bANaN || bBNaN)
+                              nResult = (bANaN ? 1 : 0) - (bBNaN ? 1 : 0);
+                          else
+                              nResult = (sA.dfValue > sB.dfValue) -
+                                        (sA.dfValue < sB.dfValue);
+                      }
+                      else
+                          nResult = strcmp(sA.osValue.c_str(),
+                                           sB.osValue.c_str());
+                      if (nResult != 0)
+                          return psSelectInfo->order_defs[iOrder]
+                                         .ascending_flag
+                                     ? nResult < 0
+                                     : nResult > 0;
+                  }
+                  return a.poGroup->nFirstRow < b.poGroup->nFirstRow;
+              });
+
+    /* -------------------------------------------------------------------- */
+    /*      Build the result features.                                      */
+    /* -------------------------------------------------------------------- */
+    m_apoGroupFeatures.reserve(asGroups.size());
+    for (const GroupResult &sResult : asGroups)
+    {
+        auto poFeature = std::make_unique<OGRFeature>(m_poDefn);
+        poFeature->SetFID(static_cast<GIntBig>(m_apoGroupFeatures.size()));
+        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+        {
+            const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+            if (psColDef->col_func != SWQCF_NONE)
+            {
+                OGRGenSQLSetSummaryField(poFeature.get(), iField, psColDef,
+                                         sResult.poGroup->aoSummaries[iField]);
+                continue;
+            }
+
+            int iGroup = 0;
+            while (psSelectInfo->group_defs[iGroup].field_index !=
+                   psColDef->field_index)
+                iGroup++;
+            const KeyValue &sValue = sResult.asValues[iGroup];
+            if (sValue.bNull)
+                poFeature->SetFieldNull(iField);
+            else if (aeKeyTypes[iGroup] ==
+                     OGRGenSQLGroupByTable::KeyType::INTEGER)
+                poFeature->SetField(iField, sValue.nValue);
+            else if (aeKeyTypes[iGroup] ==
+                     OGRGenSQLGroupByTable::KeyType::REAL)
+                poFeature->SetField(iField, sValue.dfValue);
+            else
+                poFeature->SetField(iField, sValue.osValue.c_str());
+        }
+        m_apoGroupFeatures.push_back(std::move(poFeature));
+    }
+
+    return true;
 }
 
 /************************************************************************/
@@ -1491,6 +2792,118 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                         InitJoinHashTables()                         */
+/************************************************************************/
+
+// Creates the (not yet built) hash tables of the joins whose expression is
+// an equality between a regular field of the primary layer and a regular
+// field of the secondary layer, with compatible types, when the attribute
+// filter on the secondary layer is evaluated by OGR SQL. Drivers that
+// evaluate it natively may have other comparison rules (for example
+// case-sensitive string comparisons), which the hash table could not follow.
+
+void OGRGenSQLResultsLayer::InitJoinHashTables()
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    if (psSelectInfo->join_count == 0 ||
+        !CPLTestBool(CPLGetConfigOption("OGR_SQL_HASH_JOIN", "YES")))
+    {
+        return;
+    }
+
+    // Reading the whole secondary layers is not worth it for queries
+    // returning very few records.
+    constexpr GIntBig MIN_RECORDS_FOR_HASH_JOIN = 10;
+    if (psSelectInfo->query_mode == SWQM_RECORDSET &&
+        psSelectInfo->order_specs == 0 && psSelectInfo->limit >= 0 &&
+        psSelectInfo->limit < MIN_RECORDS_FOR_HASH_JOIN)
+    {
+        return;
+    }
+    const GIntBig nPrimaryCount = m_poSrcLayer->GetFeatureCount(FALSE);
+    if (nPrimaryCount >= 0 && nPrimaryCount < MIN_RECORDS_FOR_HASH_JOIN)
+        return;
+
+    const auto IsInteger = [](OGRFieldType eType)
+    { return eType == OFTInteger || eType == OFTInteger64; };
+
+    m_apoJoinHashTables.resize(psSelectInfo->join_count);
+    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+    {
+        const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+        const swq_expr_node *poExpr = psJoinInfo->poExpr;
+        if (poExpr->eNodeType != SNT_OPERATION ||
+            poExpr->nOperation != SWQ_EQ || poExpr->nSubExprCount != 2 ||
+            poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+            poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+        {
+            continue;
+        }
+        const swq_expr_node *poPrimary = poExpr->papoSubExpr[0];
+        const swq_expr_node *poSecondary = poExpr->papoSubExpr[1];
+        if (poPrimary->table_index != 0)
+            std::swap(poPrimary, poSecondary);
+        if (poPrimary->table_index != 0 ||
+            poSecondary->table_index != psJoinInfo->secondary_table)
+        {
+            continue;
+        }
+
+        OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+        // Reading the whole secondary layer would interfere with the
+        // iteration of the primary one.
+        if (poJoinLayer == m_poSrcLayer)
+            continue;
+
+        const OGRFeatureDefn *poSrcDefn = m_poSrcLayer->GetLayerDefn();
+        const OGRFeatureDefn *poJoinDefn = poJoinLayer->GetLayerDefn();
+        if (poPrimary->field_index < 0 ||
+            poPrimary->field_index >= poSrcDefn->GetFieldCount() ||
+            poSecondary->field_index < 0 ||
+            poSecondary->field_index >= poJoinDefn->GetFieldCount())
+        {
+            continue;
+        }
+
+        const OGRFieldType ePrimaryType =
+            poSrcDefn->GetFieldDefn(poPrimary->field_index)->GetType();
+        const OGRFieldType eSecondaryType =
+            poJoinDefn->GetFieldDefn(poSecondary->field_index)->GetType();
+        OGRFieldType eKeyType;
+        if (IsInteger(ePrimaryType) && IsInteger(eSecondaryType))
+            eKeyType = OFTInteger64;
+        else if (ePrimaryType == OFTReal && eSecondaryType == OFTReal)
+            eKeyType = OFTReal;
+        else if (ePrimaryType == OFTString && eSecondaryType == OFTString)
+            eKeyType = OFTString;
+        else
+            continue;
+
+        // OGRLayer::SetAttributeFilter() compiles the filter into
+        // m_poAttrQuery, while drivers evaluating it natively do not.
+        const std::string osFilter = CPLSPrintf(
+            "\"%s\" IS NULL",
+            poJoinDefn->GetFieldDefn(poSecondary->field_index)->GetNameRef());
+        const bool bFilterEvaluatedByOGRSQL =
+            poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE &&
+            poJoinLayer->m_poAttrQuery != nullptr;
+        poJoinLayer->SetAttributeFilter(nullptr);
+        if (!bFilterEvaluatedByOGRSQL)
+        {
+            CPLDebug("GenSQL",
+                     "Attribute filters of join layer '%s' are not evaluated "
+                     "by OGR SQL. Not using a hash table",
+                     poJoinLayer->GetName());
+            continue;
+        }
+
+        m_apoJoinHashTables[iJoin] = std::make_unique<JoinHashTable>(
+            poJoinLayer, poPrimary->field_index, poSecondary->field_index,
+            eKeyType);
+    }
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1522,6 +2935,15 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        JoinHashTable *poHashTable = m_apoJoinHashTables.empty()
+                                         ? nullptr
+                                         : m_apoJoinHashTables[iJoin].get();
+        if (poHashTable && poHashTable->CanLookup(poSrcFeat))
+        {
+            apoFeatures.push_back(poHashTable->Lookup(poSrcFeat));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
         const std::string osFilter =
@@ -1891,7 +3313,8 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
     /*      Handle summary sets.                                            */
     /* -------------------------------------------------------------------- */
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-        psSelectInfo->query_mode == SWQM_DISTINCT_LIST)
+        psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+        psSelectInfo->query_mode == SWQM_GROUP_BY)
     {
         m_nIteratedFeatures++;
         return GetFeature(m_nNextIndexFID++);
@@ -2036,6 +3459,18 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature(GIntBig nFID)
         return m_poSummaryFeature->Clone();
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Handle request for group record.                                */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        if (!PrepareGroupBy() || nFID < 0 ||
+            nFID >= static_cast<GIntBig>(m_apoGroupFeatures.size()))
+            return nullptr;
+
+        return m_apoGroupFeatures[static_cast<size_t>(nFID)]->Clone();
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Handle request for random record.                               */
     /* -------------------------------------------------------------------- */
@@ -2198,6 +3633,271 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
     }
 }
 
+/************************************************************************/
+/*                         OGRGenSQLSortedRuns                          */
+/************************************************************************/
+
+// Temporary file of sorted runs of ORDER BY keys, for the external sort done
+// by CreateOrderByIndex() when the keys do not fit in memory. Each row is the
+// FID followed by the OGRField of each key. The strings of string keys are
+// written after their (flagged) OGRField. The file is unlinked as soon as it
+// is created.
+
+namespace
+{
+class OGRGenSQLSortedRuns
+{
+  public:
+    explicit OGRGenSQLSortedRuns(std::vector<bool> &&abIsStringKey)
+        : m_abIsStringKey(std::move(abIsStringKey)),
+          m_osFilename(CPLGenerateTempFilenameSafe("ogr_sql_order_by")),
+          m_fp(VSIFOpenL(m_osFilename.c_str(), "wb+"))
+    {
+        if (m_fp == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot create temporary file %s", m_osFilename.c_str());
+        }
+        else
+        {
+            // Unlink immediately so that the file is cleaned up if the
+            // process is killed (at least on Linux)
+            VSIUnlink(m_osFilename.c_str());
+        }
+    }
+
+    ~OGRGenSQLSortedRuns()
+    {
+        if (m_fp)
+            VSIFCloseL(m_fp);
+    }
+
+    bool IsValid() const
+    {
+        return m_fp != nullptr;
+    }
+
+    size_t GetRunCount() const
+    {
+        return m_aoRuns.size();
+    }
+
+    bool WriteRun(const OGRField *pasIndexFields, const GIntBig *panFIDs,
+                  const GIntBig *panIndex, size_t nEntries);
+
+    void StartReading(size_t nMaxMemory);
+    bool ReadRow(size_t iRun, OGRField *pasFields, GIntBig &nFID);
+
+    bool HasError() const
+    {
+        return m_bError;
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLSortedRuns)
+
+    const std::vector<bool> m_abIsStringKey;
+    const std::string m_osFilename;
+    VSILFILE *m_fp = nullptr;
+    vsi_l_offset m_nFileSize = 0;
+    std::string m_osWriteBuffer{};
+
+    struct Run
+    {
+        vsi_l_offset nOffset = 0;
+        vsi_l_offset nEnd = 0;
+        std::vector<GByte> abyBuffer{};
+        size_t nBufferPos = 0;
+        size_t nBufferSize = 0;
+    };
+
+    std::vector<Run> m_aoRuns{};
+    size_t m_nReadBufferSize = 0;
+    bool m_bError = false;
+
+    bool FlushWriteBuffer();
+    bool Read(Run &sRun, void *pDst, size_t nSize);
+};
+}  // namespace
+
+/************************************************************************/
+/*                              WriteRun()                              */
+/************************************************************************/
+
+// Writes the rows of pasIndexFields / panFIDs in the order of panIndex.
+
+bool OGRGenSQLSortedRuns::WriteRun(const OGRField *pasIndexFields,
+                                   const GIntBig *panFIDs,
+                                   const GIntBig *panIndex, size_t nEntries)
+{
+    constexpr size_t WRITE_BUFFER_SIZE = 1024 * 1024;
+    const size_t nOrderItems = m_abIsStringKey.size();
+
+    Run sRun;
+    sRun.nOffset = m_nFileSize;
+    for (size_t i = 0; i < nEntries; ++i)
+    {
+        const size_t iRow = static_cast<size_t>(panIndex[i]);
+        m_osWriteBuffer.append(reinterpret_cast<const char *>(&panFIDs[iRow]),
+                               sizeof(GIntBig));
+        const OGRField *pasRow = pasIndexFields + iRow * nOrderItems;
+        for (size_t iKey = 0; iKey < nOrderItems; ++iKey)
+        {
+            const OGRField *psField = pasRow + iKey;
+            if (m_abIsStringKey[iKey])
+            {
+                const bool bHasString = !OGR_RawField_IsUnset(psField) &&
+                                        !OGR_RawField_IsNull(psField);
+                m_osWriteBuffer += bHasString ? '\1' : '\0';
+                if (bHasString)
+                {
+                    const size_t nLen = strlen(psField->String);
+                    m_osWriteBuffer.append(
+                        reinterpret_cast<const char *>(&nLen), sizeof(nLen));
+                    m_osWriteBuffer.append(psField->String, nLen);
+                    continue;
+                }
+            }
+            m_osWriteBuffer.append(reinterpret_cast<const char *>(psField),
+                                   sizeof(OGRField));
+        }
+        if (m_osWriteBuffer.size() >= WRITE_BUFFER_SIZE && !FlushWriteBuffer())
+            return false;
+    }
+    if (!FlushWriteBuffer())
+        return false;
+    sRun.nEnd = m_nFileSize;
+    m_aoRuns.push_back(std::move(sRun));
+    return true;
+}
+
+/************************************************************************/
+/*                          FlushWriteBuffer()                          */
+/************************************************************************/
+
+bool OGRGenSQLSortedRuns::FlushWriteBuffer()
+{
+    if (VSIFWriteL(m_osWriteBuffer.data(), 1, m_osWriteBuffer.size(), m_fp) !=
+        m_osWriteBuffer.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot write into temporary file %s", m_osFilename.c_str());
+        return false;
+    }
+    m_nFileSize += m_osWriteBuffer.size();
+    m_osWriteBuffer.clear();
+    return true;
+}
+
+/************************************************************************/
+/*                            StartReading()                            */
+/************************************************************************/
+
+void OGRGenSQLSortedRuns::StartReading(size_t nMaxMemory)
+{
+    constexpr size_t MIN_READ_BUFFER_SIZE = 4096;
+    constexpr size_t MAX_READ_BUFFER_SIZE = 1024 * 1024;
+    m_nReadBufferSize = std::clamp(nMaxMemory / std::max<size_t>(
+                                                    1, m_aoRuns.size()),
+                                   MIN_READ_BUFFER_SIZE, MAX_READ_BUFFER_SIZE);
+    std::string().swap(m_osWriteBuffer);
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+bool OGRGenSQLSortedRuns::Read(Run &sRun, void *pDst, size_t nSize)
+{
+    GByte *pabyDst = static_cast<GByte *>(pDst);
+    while (nSize > 0)
+    {
+        if (sRun.nBufferPos == sRun.nBufferSize)
+        {
+            const size_t nToRead = static_cast<size_t>(std::min<vsi_l_offset>(
+                m_nReadBufferSize, sRun.nEnd - sRun.nOffset));
+            if (nToRead == 0)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Unexpected end of run in temporary file %s",
+                         m_osFilename.c_str());
+                m_bError = true;
+                return false;
+            }
+            sRun.abyBuffer.resize(m_nReadBufferSize);
+            if (VSIFSeekL(m_fp, sRun.nOffset, SEEK_SET) != 0 ||
+                VSIFReadL(sRun.abyBuffer.data(), 1, nToRead, m_fp) != nToRead)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Cannot read from temporary file %s",
+                         m_osFilename.c_str());
+                m_bError = true;
+                return false;
+            }
+            sRun.nOffset += nToRead;
+            sRun.nBufferPos = 0;
+            sRun.nBufferSize = nToRead;
+        }
+        const size_t nChunk =
+            std::min(nSize, sRun.nBufferSize - sRun.nBufferPos);
+        memcpy(pabyDst, sRun.abyBuffer.data() + sRun.nBufferPos, nChunk);
+        sRun.nBufferPos += nChunk;
+        pabyDst += nChunk;
+        nSize -= nChunk;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                              ReadRow()                               */
+/************************************************************************/
+
+// Reads the next row of a run into a zero-initialized row. Strings are
+// allocated with CPLMalloc(), as by OGRGenSQLResultsLayer::ReadIndexFields(),
+// and must be freed even if false is returned, which happens at the end of
+// the run or in case of error (see HasError()).
+
+bool OGRGenSQLSortedRuns::ReadRow(size_t iRun, OGRField *pasFields,
+                                  GIntBig &nFID)
+{
+    Run &sRun = m_aoRuns[iRun];
+    if (sRun.nBufferPos == sRun.nBufferSize && sRun.nOffset == sRun.nEnd)
+    {
+        std::vector<GByte>().swap(sRun.abyBuffer);
+        return false;
+    }
+    if (!Read(sRun, &nFID, sizeof(nFID)))
+        return false;
+    const size_t nOrderItems = m_abIsStringKey.size();
+    for (size_t iKey = 0; iKey < nOrderItems; ++iKey)
+    {
+        OGRField *psField = pasFields + iKey;
+        if (m_abIsStringKey[iKey])
+        {
+            char chHasString = 0;
+            if (!Read(sRun, &chHasString, 1))
+                return false;
+            if (chHasString)
+            {
+                size_t nLen = 0;
+                if (!Read(sRun, &nLen, sizeof(nLen)))
+                    return false;
+                // Allocated before being read, so that it is freed with the
+                // other fields of the row in case of error.
+                psField->String = static_cast<char *>(CPLCalloc(1, nLen + 1));
+                if (!Read(sRun, psField->String, nLen))
+                    return false;
+                continue;
+            }
+        }
+        OGRField sField;
+        if (!Read(sRun, &sField, sizeof(OGRField)))
+            return false;
+        *psField = sField;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                         CreateOrderByIndex()                         */
 /*                                                                      */
@@ -2207,12 +3907,17 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*                                                                      */
 /*      This is accomplished by making one pass through all the         */
 /*      eligible source features, and capturing the order by fields     */
-/*      of all records in memory.  A quick sort is then applied to      */
+/*      of all records in memory.  A merge sort is then applied to      */
 /*      this in memory copy of the order-by fields to create the        */
 /*      required index.                                                 */
 /*                                                                      */
-/*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      When the key values exceed OGR_SQL_ORDER_BY_MAX_MEMORY, they    */
+/*      are sorted by slices (in parallel if GDAL_NUM_THREADS allows    */
+/*      it) written as runs into a temporary file, which are merged     */
+/*      afterwards.  Only the resulting FID index is kept in memory.    */
+/*                                                                      */
+/*      With a LIMIT clause, only the OFFSET + LIMIT first records      */
+/*      are kept in memory, in a heap.                                  */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -2272,16 +3977,6 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         return;
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Allocate set of key values, and the output index.               */
-    /* -------------------------------------------------------------------- */
-    size_t nFeaturesAlloc = 100;
-    size_t nIndexSize = 0;
-    std::vector<OGRField> asIndexFields(nOrderItems * nFeaturesAlloc);
-    memset(asIndexFields.data(), 0,
-           sizeof(OGRField) * nOrderItems * nFeaturesAlloc);
-    std::vector<GIntBig> anFIDList;
-
     // Frees nIndexSize rows of asIndexFields
     struct IndexFieldsFreer
     {
@@ -2306,8 +4001,234 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         IndexFieldsFreer &operator=(const IndexFieldsFreer &) = delete;
     };
 
+    const size_t nMaxMemory = OGRGenSQLGetMaxMemory(
+        CPLGetConfigOption("OGR_SQL_ORDER_BY_MAX_MEMORY", "10%"));
+    // Memory used per record, excluding strings: key values, FID, and
+    // sort index and merge buffer.
+    const size_t nRecordSize =
+        sizeof(OGRField) * nOrderItems + 3 * sizeof(GIntBig);
+
+    /* -------------------------------------------------------------------- */
+    /*      Optimize ORDER BY ... LIMIT N [OFFSET M] case, by only keeping  */
+    /*      the N + M first records in a heap.                              */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->limit >= 0 && psSelectInfo->offset >= 0 &&
+        psSelectInfo->offset <=
+            std::numeric_limits<GIntBig>::max() - psSelectInfo->limit &&
+        static_cast<GUIntBig>(psSelectInfo->offset + psSelectInfo->limit) <
+            nMaxMemory / 2 / nRecordSize)
+    {
+        const size_t nK =
+            static_cast<size_t>(psSelectInfo->offset + psSelectInfo->limit);
+        if (nK == 0)
+            return;
+
+        // Records [0, nK - 1] are the heap entries. Record nK receives the
+        // current feature.
+        std::vector<OGRField> asIndexFields(nOrderItems * (nK + 1));
+        memset(asIndexFields.data(), 0,
+               sizeof(OGRField) * nOrderItems * (nK + 1));
+        std::vector<GIntBig> anFIDList(nK + 1);
+        // Read order of the records, to keep equal records in that order
+        std::vector<GIntBig> anReadOrder(nK + 1);
+        std::vector<size_t> anHeap;
+        anHeap.reserve(nK);
+        size_t nRecords = 0;
+        IndexFieldsFreer oIndexFieldsFreer(*this, asIndexFields, nRecords);
+
+        const auto IsBefore = [this, &asIndexFields, &anReadOrder,
+                               nOrderItems](size_t i, size_t j)
+        {
+            const int nRes = Compare(asIndexFields.data() + i * nOrderItems,
+                                     asIndexFields.data() + j * nOrderItems);
+            return nRes < 0 || (nRes == 0 && anReadOrder[i] < anReadOrder[j]);
+        };
+
+        OGRField *pasCurrentFields = asIndexFields.data() + nK * nOrderItems;
+        GIntBig nReadOrder = 0;
+        for (auto &&poSrcFeat : *m_poSrcLayer)
+        {
+            const size_t iRecord = std::min(nRecords, nK);
+            ReadIndexFields(poSrcFeat.get(), nOrderItems,
+                            asIndexFields.data() + iRecord * nOrderItems);
+            anFIDList[iRecord] = poSrcFeat->GetFID();
+            anReadOrder[iRecord] = nReadOrder++;
+
+            if (nRecords < nK)
+            {
+                ++nRecords;
+                anHeap.push_back(iRecord);
+                std::push_heap(anHeap.begin(), anHeap.end(), IsBefore);
+                continue;
+            }
+
+            if (IsBefore(nK, anHeap.front()))
+            {
+                // Replace the greatest record of the heap by the current one
+                std::pop_heap(anHeap.begin(), anHeap.end(), IsBefore);
+                const size_t iReplaced = anHeap.back();
+                OGRField *pasReplacedFields =
+                    asIndexFields.data() + iReplaced * nOrderItems;
+                FreeIndexFields(pasReplacedFields, 1);
+                memcpy(pasReplacedFields, pasCurrentFields,
+                       sizeof(OGRField) * nOrderItems);
+                anFIDList[iReplaced] = anFIDList[nK];
+                anReadOrder[iReplaced] = anReadOrder[nK];
+                std::push_heap(anHeap.begin(), anHeap.end(), IsBefore);
+            }
+            else
+            {
+                FreeIndexFields(pasCurrentFields, 1);
+            }
+            memset(pasCurrentFields, 0, sizeof(OGRField) * nOrderItems);
+        }
+
+        std::sort_heap(anHeap.begin(), anHeap.end(), IsBefore);
+
+        // If the first records read are the first ones in order, let
+        // GetNextFeature() read the source layer sequentially (see below).
+        bool bAlreadySorted = true;
+        for (size_t i = 0; bAlreadySorted && i < anHeap.size(); i++)
+            bAlreadySorted = anReadOrder[anHeap[i]] == static_cast<GIntBig>(i);
+        if (!bAlreadySorted)
+        {
+            m_anFIDIndex.reserve(anHeap.size());
+            for (const size_t iRecord : anHeap)
+                m_anFIDIndex.push_back(anFIDList[iRecord]);
+        }
+
+        ResetReading();
+        return;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Allocate set of key values, and the output index.               */
+    /* -------------------------------------------------------------------- */
+    size_t nFeaturesAlloc = 100;
+    size_t nIndexSize = 0;
+    std::vector<OGRField> asIndexFields(nOrderItems * nFeaturesAlloc);
+    memset(asIndexFields.data(), 0,
+           sizeof(OGRField) * nOrderItems * nFeaturesAlloc);
+    std::vector<GIntBig> anFIDList;
+
     IndexFieldsFreer oIndexFieldsFreer(*this, asIndexFields, nIndexSize);
 
+    /* -------------------------------------------------------------------- */
+    /*      State of the external sort.                                     */
+    /* -------------------------------------------------------------------- */
+    std::vector<bool> abIsStringKey;
+    for (int iKey = 0; iKey < nOrderItems; iKey++)
+    {
+        const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+        if (psKeyDef->field_index >= m_iFIDFieldIndex)
+        {
+            abIsStringKey.push_back(
+                SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex] ==
+                SWQ_STRING);
+        }
+        else
+        {
+            abIsStringKey.push_back(m_poSrcLayer->GetLayerDefn()
+                                        ->GetFieldDefn(psKeyDef->field_index)
+                                        ->GetType() == OFTString);
+        }
+    }
+    const bool bHasStringKey =
+        std::find(abIsStringKey.begin(), abIsStringKey.end(), true) !=
+        abIsStringKey.end();
+
+    std::unique_ptr<OGRGenSQLSortedRuns> poRuns;
+    std::vector<bool> abRunAlreadySorted;
+    size_t nMemory = 0;
+    size_t nSpilledRecords = 0;
+    std::vector<GIntBig> anSortIndex;
+    std::vector<GIntBig> anMerged;
+
+    // Sorts the nIndexSize records read so far and writes them as runs,
+    // each thread sorting a slice of them.
+    const auto WriteRuns = [&]()
+    {
+        if (!poRuns)
+        {
+            poRuns = std::make_unique<OGRGenSQLSortedRuns>(
+                std::vector<bool>(abIsStringKey));
+            if (!poRuns->IsValid())
+                return false;
+        }
+
+        try
+        {
+            anSortIndex.resize(nIndexSize);
+            anMerged.resize(nIndexSize);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "CreateOrderByIndex(): out of memory");
+            return false;
+        }
+        for (size_t i = 0; i < nIndexSize; i++)
+            anSortIndex[i] = static_cast<GIntBig>(i);
+
+        constexpr size_t MIN_RECORDS_PER_THREAD = 10000;
+        const int nThreads =
+            GDALGetNumThreads(GDAL_DEFAULT_MAX_THREAD_COUNT, false);
+        const size_t nSlices = std::clamp<size_t>(
+            nIndexSize / MIN_RECORDS_PER_THREAD, 1, nThreads);
+        const auto GetSliceStart = [nSlices, nIndexSize](size_t iSlice)
+        {
+            return static_cast<size_t>(static_cast<uint64_t>(iSlice) *
+                                       nIndexSize / nSlices);
+        };
+
+        CPLWorkerThreadPool *poPool =
+            nSlices > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+        for (size_t iSlice = 0; iSlice < nSlices; ++iSlice)
+        {
+            const size_t nStart = GetSliceStart(iSlice);
+            const size_t nEntries = GetSliceStart(iSlice + 1) - nStart;
+            // Each slice uses its own part of the merge buffer
+            const auto Sort = [this, &asIndexFields, &anSortIndex, &anMerged,
+                               nStart, nEntries]()
+            {
+                SortIndexSection(asIndexFields.data(), anSortIndex.data(),
+                                 anMerged.data() + nStart, nStart, nEntries);
+            };
+            if (!poQueue || !poQueue->SubmitJob(Sort))
+                Sort();
+        }
+        if (poQueue)
+            poQueue->WaitCompletion();
+
+        for (size_t iSlice = 0; iSlice < nSlices; ++iSlice)
+        {
+            const size_t nStart = GetSliceStart(iSlice);
+            const size_t nEntries = GetSliceStart(iSlice + 1) - nStart;
+            bool bAlreadySorted = true;
+            for (size_t i = nStart; bAlreadySorted && i < nStart + nEntries;
+                 i++)
+            {
+                bAlreadySorted = anSortIndex[i] == static_cast<GIntBig>(i);
+            }
+            abRunAlreadySorted.push_back(bAlreadySorted);
+            if (!poRuns->WriteRun(asIndexFields.data(), anFIDList.data(),
+                                  anSortIndex.data() + nStart, nEntries))
+            {
+                return false;
+            }
+        }
+
+        FreeIndexFields(asIndexFields.data(), nIndexSize);
+        memset(asIndexFields.data(), 0,
+               sizeof(OGRField) * nOrderItems * nIndexSize);
+        nSpilledRecords += nIndexSize;
+        nIndexSize = 0;
+        anFIDList.clear();
+        nMemory = 0;
+        return true;
+    };
+
     /* -------------------------------------------------------------------- */
     /*      Read in all the key values.                                     */
     /* -------------------------------------------------------------------- */
@@ -2353,16 +4274,136 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
             nFeaturesAlloc = nNewFeaturesAlloc;
         }
 
-        ReadIndexFields(poSrcFeat.get(), nOrderItems,
-                        asIndexFields.data() + nIndexSize * nOrderItems);
+        OGRField *pasFields = asIndexFields.data() + nIndexSize * nOrderItems;
+        ReadIndexFields(poSrcFeat.get(), nOrderItems, pasFields);
 
         anFIDList.push_back(poSrcFeat->GetFID());
 
         nIndexSize++;
+
+        nMemory += nRecordSize;
+        if (bHasStringKey)
+        {
+            for (int iKey = 0; iKey < nOrderItems; iKey++)
+            {
+                const OGRField *psField = pasFields + iKey;
+                if (abIsStringKey[iKey] && !OGR_RawField_IsUnset(psField) &&
+                    !OGR_RawField_IsNull(psField))
+                {
+                    // Approximate overhead of the heap allocation
+                    constexpr size_t ALLOC_OVERHEAD = 16;
+                    nMemory += strlen(psField->String) + 1 + ALLOC_OVERHEAD;
+                }
+            }
+        }
+        if (nMemory > nMaxMemory && !WriteRuns())
+            return;
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %zu features", nIndexSize);
 
+    /* -------------------------------------------------------------------- */
+    /*      Merge the runs of the external sort.                            */
+    /* -------------------------------------------------------------------- */
+    if (poRuns)
+    {
+        if (nIndexSize > 0 && !WriteRuns())
+            return;
+
+        // Release the memory of the key values
+        std::vector<OGRField>().swap(asIndexFields);
+        std::vector<GIntBig>().swap(anFIDList);
+        std::vector<GIntBig>().swap(anSortIndex);
+        std::vector<GIntBig>().swap(anMerged);
+
+        const size_t nRuns = poRuns->GetRunCount();
+        CPLDebug("GenSQL",
+                 "CreateOrderByIndex(): merging %u runs of " CPL_FRMT_GUIB
+                 " features",
+                 static_cast<unsigned>(nRuns),
+                 static_cast<GUIntBig>(nSpilledRecords));
+
+        try
+        {
+            m_anFIDIndex.reserve(nSpilledRecords);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "CreateOrderByIndex(): out of memory");
+            return;
+        }
+
+        poRuns->StartReading(nMaxMemory);
+
+        // Current record of each run
+        std::vector<OGRField> asRunFields(nOrderItems * nRuns);
+        memset(asRunFields.data(), 0, sizeof(OGRField) * nOrderItems * nRuns);
+        std::vector<GIntBig> anRunFID(nRuns);
+        size_t nRunFieldsSize = nRuns;
+        IndexFieldsFreer oRunFieldsFreer(*this, asRunFields, nRunFieldsSize);
+
+        const auto ReadNextRecord = [this, &poRuns, &asRunFields, &anRunFID,
+                                     nOrderItems](size_t iRun)
+        {
+            OGRField *pasFields = asRunFields.data() + iRun * nOrderItems;
+            FreeIndexFields(pasFields, 1);
+            memset(pasFields, 0, sizeof(OGRField) * nOrderItems);
+            return poRuns->ReadRow(iRun, pasFields, anRunFID[iRun]);
+        };
+
+        // Equal records are taken from the runs in their order, so that the
+        // sort remains stable.
+        const auto IsAfter = [this, &asRunFields, nOrderItems](size_t i,
+                                                               size_t j)
+        {
+            const int nRes = Compare(asRunFields.data() + i * nOrderItems,
+                                     asRunFields.data() + j * nOrderItems);
+            return nRes > 0 || (nRes == 0 && i > j);
+        };
+
+        std::vector<size_t> anHeap;
+        for (size_t iRun = 0; iRun < nRuns; iRun++)
+        {
+            if (ReadNextRecord(iRun))
+                anHeap.push_back(iRun);
+        }
+        std::make_heap(anHeap.begin(), anHeap.end(), IsAfter);
+
+        bool bAlreadySorted =
+            std::find(abRunAlreadySorted.begin(), abRunAlreadySorted.end(),
+                      false) == abRunAlreadySorted.end();
+        size_t iLastRun = 0;
+        while (!anHeap.empty())
+        {
+            std::pop_heap(anHeap.begin(), anHeap.end(), IsAfter);
+            const size_t iRun = anHeap.back();
+            m_anFIDIndex.push_back(anRunFID[iRun]);
+            if (iRun < iLastRun)
+                bAlreadySorted = false;
+            iLastRun = iRun;
+            if (ReadNextRecord(iRun))
+                std::push_heap(anHeap.begin(), anHeap.end(), IsAfter);
+            else
+                anHeap.pop_back();
+        }
+
+        if (poRuns->HasError() || m_anFIDIndex.size() != nSpilledRecords)
+        {
+            m_anFIDIndex.clear();
+            return;
+        }
+
+        /* See below */
+        if (bAlreadySorted)
+        {
+            m_anFIDIndex.clear();
+        }
+
+        ResetReading();
+        return;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Initialize m_anFIDIndex                                         */
     /* -------------------------------------------------------------------- */
@@ -2392,7 +4433,8 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     }
 
     // Note: this merge sort is slightly faster than std::sort()
-    SortIndexSection(asIndexFields.data(), panMerged, 0, nIndexSize);
+    SortIndexSection(asIndexFields.data(), m_anFIDIndex.data(), panMerged, 0,
+                     nIndexSize);
     VSIFree(panMerged);
 
     /* -------------------------------------------------------------------- */
@@ -2426,6 +4468,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
+                                             GIntBig *panIndex,
                                              GIntBig *panMerged, size_t nStart,
                                              size_t nEntries)
 
@@ -2441,8 +4484,10 @@ void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
     size_t nSecondGroup = nEntries - nFirstGroup;
     size_t nSecondStart = nStart + nFirstGroup;
 
-    SortIndexSection(pasIndexFields, panMerged, nFirstStart, nFirstGroup);
-    SortIndexSection(pasIndexFields, panMerged, nSecondStart, nSecondGroup);
+    SortIndexSection(pasIndexFields, panIndex, panMerged, nFirstStart,
+                     nFirstGroup);
+    SortIndexSection(pasIndexFields, panIndex, panMerged, nSecondStart,
+                     nSecondGroup);
 
     for (size_t iMerge = 0; iMerge < nEntries; ++iMerge)
     {
@@ -2454,25 +4499,25 @@ void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
             nResult = -1;
         else
             nResult = Compare(
-                pasIndexFields + m_anFIDIndex[nFirstStart] * nOrderItems,
-                pasIndexFields + m_anFIDIndex[nSecondStart] * nOrderItems);
+                pasIndexFields + panIndex[nFirstStart] * nOrderItems,
+                pasIndexFields + panIndex[nSecondStart] * nOrderItems);
 
         if (nResult > 0)
         {
-            panMerged[iMerge] = m_anFIDIndex[nSecondStart];
+            panMerged[iMerge] = panIndex[nSecondStart];
             nSecondStart++;
             nSecondGroup--;
         }
         else
         {
-            panMerged[iMerge] = m_anFIDIndex[nFirstStart];
+            panMerged[iMerge] = panIndex[nFirstStart];
             nFirstStart++;
             nFirstGroup--;
         }
     }
 
     /* Copy the merge list back into the main index */
-    memcpy(m_anFIDIndex.data() + nStart, panMerged, sizeof(GIntBig) * nEntries);
+    memcpy(panIndex + nStart, panMerged, sizeof(GIntBig) * nEntries);
 }
 
 /************************************************************************/
@@ -2673,6 +4718,9 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
     for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
     {
         swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        // COUNT(*) does not reference any field
+        if (psColDef->col_func == SWQCF_COUNT && psColDef->field_index < 0)
+            continue;
         AddFieldDefnToSet(psColDef->table_index, psColDef->field_index, hSet);
         if (psColDef->expr)
             ExploreExprForIgnoredFields(psColDef->expr, hSet);
@@ -2681,6 +4729,13 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
     if (psSelectInfo->where_expr)
         ExploreExprForIgnoredFields(psSelectInfo->where_expr, hSet);
 
+    for (int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++)
+    {
+        swq_group_def *psGroupDef = psSelectInfo->group_defs + iGroup;
+        AddFieldDefnToSet(psGroupDef->table_index, psGroupDef->field_index,
+                          hSet);
+    }
+
     for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
     {
         swq_join_def *psJoinDef = psSelectInfo->join_defs + iJoin;
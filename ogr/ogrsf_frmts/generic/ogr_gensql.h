@@ -19,6 +19,7 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -74,14 +75,25 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // Result of a GROUP BY query, with one feature per group
+    std::vector<std::unique_ptr<OGRFeature>> m_apoGroupFeatures{};
+    bool m_bGroupByDone = false;
+
+    // Hash tables of the joined layers, for equality joins (nullptr for
+    // other joins)
+    struct JoinHashTable;
+    std::vector<std::unique_ptr<JoinHashTable>> m_apoJoinHashTables{};
+
     bool PrepareSummary() const;
+    bool PrepareGroupBy();
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
+    void InitJoinHashTables();
     void CreateOrderByIndex();
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
-    void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panMerged,
-                          size_t nStart, size_t nEntries);
+    void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panIndex,
+                          GIntBig *panMerged, size_t nStart, size_t nEntries);
     void FreeIndexFields(OGRField *pasIndexFields, size_t l_nIndexSize);
     int Compare(const OGRField *pasFirst, const OGRField *pasSecond);
 
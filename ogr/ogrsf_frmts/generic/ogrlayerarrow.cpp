@@ -23,12 +23,16 @@
 
 #include "cpl_float.h"
 #include "cpl_json.h"
+#include "cpl_safemaths.hpp"
 #include "cpl_time.h"
 
 #include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <climits>
+#include <cmath>
 #include <limits>
+#include <map>
 #include <utility>
 #include <set>
 #include <string_view>
@@ -5178,6 +5182,1168 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                       OGRArrowVectorizedFilter                       */
+/************************************************************************/
+
+namespace
+{
+
+// Evaluates an attribute filter over all the rows of an ArrowArray at once,
+// one expression node at a time, instead of materializing an OGRFeature per
+// row. The semantics of SWQGeneralEvaluator(), notably regarding null values
+// and type promotions, are replicated. Expressions using operations, field
+// types or Arrow formats not handled here are rejected by Compile(), and must
+// be evaluated row by row.
+
+class OGRArrowVectorizedFilter
+{
+  public:
+    OGRArrowVectorizedFilter(const OGRFeatureDefn *poFeatureDefn,
+                             const struct ArrowSchema *schema,
+                             const struct ArrowArray *array,
+                             const swq_evaluation_context &sContext)
+        : m_poFeatureDefn(poFeatureDefn), m_psSchema(schema),
+          m_psArray(array), m_sContext(sContext),
+          m_nLength(static_cast<size_t>(array->length))
+    {
+    }
+
+    void SetFieldArrowPath(int iOGRFieldIndex,
+                           const std::vector<int> &anArrowPath)
+    {
+        m_oMapFieldIndexToArrowPath[iOGRFieldIndex] = anArrowPath;
+    }
+
+    void SetBaseSequentialFID(GIntBig nBaseSeqFID)
+    {
+        m_nBaseSeqFID = nBaseSeqFID;
+    }
+
+    void SetFIDArrowPath(const std::vector<int> &anArrowPath)
+    {
+        m_anArrowPathToFIDColumn = anArrowPath;
+    }
+
+    bool Compile(const swq_expr_node *poExpr);
+    size_t Evaluate(std::vector<bool> &abyValidityFromFilters);
+
+  private:
+    enum class ValueType
+    {
+        INTEGER,
+        FLOAT,
+        STRING
+    };
+
+    // Values of an expression node, for all rows, or a single value for
+    // constants.
+    struct Values
+    {
+        ValueType eType = ValueType::INTEGER;
+        bool bConstant = false;
+        std::vector<int64_t> anValues{};
+        std::vector<double> adfValues{};
+        std::string osStrings{};
+        std::vector<size_t> anStringOffsets{};
+        // Empty if there is no null value
+        std::vector<GByte> abyIsNull{};
+
+        size_t Idx(size_t i) const
+        {
+            return bConstant ? 0 : i;
+        }
+
+        bool IsNull(size_t i) const
+        {
+            return !abyIsNull.empty() && abyIsNull[Idx(i)];
+        }
+
+        int64_t GetInteger(size_t i) const
+        {
+            return anValues[Idx(i)];
+        }
+
+        double GetFloat(size_t i) const
+        {
+            return eType == ValueType::FLOAT
+                       ? adfValues[Idx(i)]
+                       : static_cast<double>(anValues[Idx(i)]);
+        }
+
+        const char *GetString(size_t i) const
+        {
+            return osStrings.c_str() + anStringOffsets[Idx(i)];
+        }
+    };
+
+    struct ColumnRef
+    {
+        bool bSequentialFID = false;
+        const struct ArrowSchema *psSchema = nullptr;
+        // Arrays from the top-level column to the leaf one, whose validity
+        // must be checked.
+        std::vector<const struct ArrowArray *> apsArrays{};
+    };
+
+    const OGRFeatureDefn *const m_poFeatureDefn;
+    const struct ArrowSchema *const m_psSchema;
+    const struct ArrowArray *const m_psArray;
+    const swq_evaluation_context &m_sContext;
+    const size_t m_nLength;
+    std::map<int, std::vector<int>> m_oMapFieldIndexToArrowPath{};
+    GIntBig m_nBaseSeqFID = -1;
+    std::vector<int> m_anArrowPathToFIDColumn{};
+    const swq_expr_node *m_poExpr = nullptr;
+    const std::vector<bool> *m_pabySelected = nullptr;
+
+    bool ResolveColumn(const swq_expr_node *poNode, ColumnRef &sRef) const;
+    bool CompileNode(const swq_expr_node *poNode, int nRecLevel,
+                     ValueType &eType) const;
+    Values EvaluateNode(const swq_expr_node *poNode) const;
+    Values EvaluateColumn(const swq_expr_node *poNode) const;
+    Values EvaluateOperation(const swq_expr_node *poNode) const;
+    void EvaluateFloatOperation(const swq_expr_node *poNode,
+                                const std::vector<Values> &aoArgs,
+                                Values &oRet) const;
+    void EvaluateIntegerOperation(const swq_expr_node *poNode,
+                                  const std::vector<Values> &aoArgs,
+                                  Values &oRet) const;
+    void EvaluateStringOperation(const swq_expr_node *poNode,
+                                 const std::vector<Values> &aoArgs,
+                                 Values &oRet) const;
+    void ReportIntegerOverflow(size_t iRow, Values &oRet) const;
+
+    template <class IsEqual>
+    void EvaluateIn(const std::vector<Values> &aoArgs, Values &oRet,
+                    IsEqual isEqual) const;
+};
+
+/************************************************************************/
+/*                           ResolveColumn()                            */
+/************************************************************************/
+
+bool OGRArrowVectorizedFilter::ResolveColumn(const swq_expr_node *poNode,
+                                             ColumnRef &sRef) const
+{
+    const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+    const int iField = poNode->field_index;
+    const std::vector<int> *panArrowPath = nullptr;
+    if (iField == nFieldCount + SPF_FID ||
+        iField == nFieldCount + SPECIAL_FIELD_COUNT +
+                      m_poFeatureDefn->GetGeomFieldCount())
+    {
+        if (poNode->field_type != SWQ_INTEGER64)
+            return false;
+        if (m_nBaseSeqFID >= 0)
+        {
+            sRef.bSequentialFID = true;
+            return true;
+        }
+        // Only a top-level FID column is handled
+        if (m_anArrowPathToFIDColumn.size() != 1)
+            return false;
+        panArrowPath = &m_anArrowPathToFIDColumn;
+    }
+    else if (iField >= 0 && iField < nFieldCount)
+    {
+        const auto oIter = m_oMapFieldIndexToArrowPath.find(iField);
+        if (oIter == m_oMapFieldIndexToArrowPath.end())
+            return false;
+        panArrowPath = &(oIter->second);
+    }
+    else
+    {
+        return false;
+    }
+
+    const struct ArrowSchema *psSchemaField = m_psSchema;
+    const struct ArrowArray *psArray = m_psArray;
+    for (const int iChild : *panArrowPath)
+    {
+        psSchemaField = psSchemaField->children[iChild];
+        psArray = psArray->children[iChild];
+        sRef.apsArrays.push_back(psArray);
+    }
+    sRef.psSchema = psSchemaField;
+    if (psSchemaField->dictionary)
+        return false;
+
+    // Only accept Arrow formats for which the values fetched from the
+    // OGRFeature, through GetFieldAsXXXX(), would be the Arrow values.
+    const char *format = psSchemaField->format;
+    const bool bIsInt32OrSmaller =
+        IsBoolean(format) || IsInt8(format) || IsUInt8(format) ||
+        IsInt16(format) || IsUInt16(format) || IsInt32(format);
+    if (iField >= nFieldCount)
+        return IsInt32(format) || IsInt64(format);
+    const OGRFieldType eOGRType =
+        m_poFeatureDefn->GetFieldDefn(iField)->GetType();
+    switch (poNode->field_type)
+    {
+        case SWQ_INTEGER:
+        case SWQ_BOOLEAN:
+            return eOGRType == OFTInteger && bIsInt32OrSmaller;
+
+        case SWQ_INTEGER64:
+            return eOGRType == OFTInteger64 &&
+                   (bIsInt32OrSmaller || IsUInt32(format) || IsInt64(format));
+
+        case SWQ_FLOAT:
+            return eOGRType == OFTReal &&
+                   (IsFloat32(format) || IsFloat64(format));
+
+        case SWQ_STRING:
+            return eOGRType == OFTString &&
+                   (IsString(format) || IsLargeString(format) ||
+                    IsStringView(format));
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                            CompileNode()                             */
+/************************************************************************/
+
+bool OGRArrowVectorizedFilter::CompileNode(const swq_expr_node *poNode,
+                                           int nRecLevel,
+                                           ValueType &eType) const
+{
+    // Same limit as in swq_expr_node::Evaluate()
+    if (nRecLevel == 32)
+        return false;
+
+    const auto GetValueType = [](swq_field_type eFieldType, ValueType &eOut)
+    {
+        if (SWQ_IS_INTEGER(eFieldType) || eFieldType == SWQ_BOOLEAN)
+            eOut = ValueType::INTEGER;
+        else if (eFieldType == SWQ_FLOAT)
+            eOut = ValueType::FLOAT;
+        else if (eFieldType == SWQ_STRING)
+            eOut = ValueType::STRING;
+        else
+            return false;
+        return true;
+    };
+
+    if (poNode->eNodeType == SNT_CONSTANT)
+    {
+        return GetValueType(poNode->field_type, eType);
+    }
+
+    if (poNode->eNodeType == SNT_COLUMN)
+    {
+        ColumnRef sRef;
+        return ResolveColumn(poNode, sRef) &&
+               GetValueType(poNode->field_type, eType);
+    }
+
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    const int nArgs = poNode->nSubExprCount;
+    std::vector<ValueType> aeArgTypes(nArgs);
+    for (int i = 0; i < nArgs; ++i)
+    {
+        if (!CompileNode(poNode->papoSubExpr[i], nRecLevel + 1, aeArgTypes[i]))
+            return false;
+    }
+    if (nArgs == 0 || !GetValueType(poNode->field_type, eType) ||
+        eType == ValueType::STRING)
+    {
+        return false;
+    }
+
+    const auto AllOfType = [&aeArgTypes](int iStart, ValueType eArgType)
+    {
+        return std::all_of(aeArgTypes.begin() + iStart, aeArgTypes.end(),
+                           [eArgType](ValueType e) { return e == eArgType; });
+    };
+    const auto IsNumeric = [](ValueType e)
+    { return e == ValueType::INTEGER || e == ValueType::FLOAT; };
+
+    // Mimics the dispatching of SWQGeneralEvaluator(), based on the type of
+    // the first 2 arguments.
+    const bool bFloatPath =
+        aeArgTypes[0] == ValueType::FLOAT ||
+        (nArgs > 1 && aeArgTypes[1] == ValueType::FLOAT);
+    const bool bIntegerPath =
+        !bFloatPath && aeArgTypes[0] == ValueType::INTEGER;
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_ISNULL:
+            return nArgs == 1;
+
+        case SWQ_AND:
+        case SWQ_OR:
+            return nArgs == 2 && AllOfType(0, ValueType::INTEGER);
+
+        case SWQ_NOT:
+            return nArgs == 1 && aeArgTypes[0] == ValueType::INTEGER;
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_GT:
+        case SWQ_LT:
+        case SWQ_GE:
+        case SWQ_LE:
+            if (nArgs != 2)
+                return false;
+            if (bFloatPath)
+                return IsNumeric(aeArgTypes[0]) && IsNumeric(aeArgTypes[1]);
+            return AllOfType(0, aeArgTypes[0]);
+
+        case SWQ_IN:
+        case SWQ_BETWEEN:
+            if (nArgs < 2 || (poNode->nOperation == SWQ_BETWEEN && nArgs != 3))
+                return false;
+            // Only the first 2 arguments are promoted to floating point
+            if (bFloatPath)
+                return IsNumeric(aeArgTypes[0]) && IsNumeric(aeArgTypes[1]) &&
+                       AllOfType(2, ValueType::FLOAT);
+            return AllOfType(0, aeArgTypes[0]);
+
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+            return (nArgs == 2 ||
+                    (nArgs == 3 &&
+                     poNode->papoSubExpr[2]->eNodeType == SNT_CONSTANT)) &&
+                   AllOfType(0, ValueType::STRING);
+
+        case SWQ_ADD:
+        case SWQ_SUBTRACT:
+        case SWQ_MULTIPLY:
+        case SWQ_DIVIDE:
+        case SWQ_MODULUS:
+            if (nArgs != 2)
+                return false;
+            if (bFloatPath)
+                return IsNumeric(aeArgTypes[0]) && IsNumeric(aeArgTypes[1]) &&
+                       eType == ValueType::FLOAT;
+            return bIntegerPath && aeArgTypes[1] == ValueType::INTEGER &&
+                   eType == ValueType::INTEGER;
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                              Compile()                               */
+/************************************************************************/
+
+bool OGRArrowVectorizedFilter::Compile(const swq_expr_node *poExpr)
+{
+    ValueType eType = ValueType::INTEGER;
+    if (!CompileNode(poExpr, 0, eType))
+        return false;
+    m_poExpr = poExpr;
+    return true;
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+// Assumes that Compile() has been called and returned true.
+
+size_t
+OGRArrowVectorizedFilter::Evaluate(std::vector<bool> &abyValidityFromFilters)
+{
+    CPLAssert(m_poExpr);
+    CPLAssert(abyValidityFromFilters.size() == m_nLength);
+    m_pabySelected = &abyValidityFromFilters;
+    const Values oResult = EvaluateNode(m_poExpr);
+    m_pabySelected = nullptr;
+
+    // Same as OGRFeatureQuery::Evaluate()
+    size_t nCountIntersecting = 0;
+    for (size_t i = 0; i < m_nLength; ++i)
+    {
+        if (!abyValidityFromFilters[i])
+            continue;
+        if (oResult.eType == ValueType::INTEGER &&
+            static_cast<int>(oResult.GetInteger(i)) != 0)
+        {
+            nCountIntersecting++;
+        }
+        else
+        {
+            abyValidityFromFilters[i] = false;
+        }
+    }
+    return nCountIntersecting;
+}
+
+/************************************************************************/
+/*                            EvaluateNode()                            */
+/************************************************************************/
+
+OGRArrowVectorizedFilter::Values
+OGRArrowVectorizedFilter::EvaluateNode(const swq_expr_node *poNode) const
+{
+    if (poNode->eNodeType == SNT_COLUMN)
+        return EvaluateColumn(poNode);
+    if (poNode->eNodeType == SNT_OPERATION)
+        return EvaluateOperation(poNode);
+
+    Values oRet;
+    oRet.bConstant = true;
+    if (poNode->field_type == SWQ_FLOAT)
+    {
+        oRet.eType = ValueType::FLOAT;
+        oRet.adfValues.push_back(poNode->float_value);
+    }
+    else if (poNode->field_type == SWQ_STRING)
+    {
+        oRet.eType = ValueType::STRING;
+        oRet.osStrings = poNode->string_value ? poNode->string_value : "";
+        oRet.anStringOffsets.push_back(0);
+    }
+    else
+    {
+        oRet.anValues.push_back(poNode->int_value);
+    }
+    if (poNode->is_null)
+        oRet.abyIsNull.push_back(true);
+    return oRet;
+}
+
+/************************************************************************/
+/*                           EvaluateColumn()                           */
+/************************************************************************/
+
+template <class T>
+static void FillIntegerValues(const struct ArrowArray *psArray, size_t nLength,
+                              std::vector<int64_t> &anValues)
+{
+    const T *panSrc = static_cast<const T *>(psArray->buffers[1]) +
+                      static_cast<size_t>(psArray->offset);
+    for (size_t i = 0; i < nLength; ++i)
+        anValues[i] = static_cast<int64_t>(panSrc[i]);
+}
+
+template <class OffsetType>
+static std::string_view GetStringValue(const struct ArrowArray *psArray,
+                                       size_t iRow)
+{
+    const OffsetType *panOffsets =
+        static_cast<const OffsetType *>(psArray->buffers[1]) +
+        static_cast<size_t>(psArray->offset);
+    const char *pachData = static_cast<const char *>(psArray->buffers[2]);
+    return std::string_view(
+        pachData + static_cast<size_t>(panOffsets[iRow]),
+        static_cast<size_t>(panOffsets[iRow + 1] - panOffsets[iRow]));
+}
+
+OGRArrowVectorizedFilter::Values
+OGRArrowVectorizedFilter::EvaluateColumn(const swq_expr_node *poNode) const
+{
+    Values oRet;
+    ColumnRef sRef;
+    CPL_IGNORE_RET_VAL(ResolveColumn(poNode, sRef));
+    const size_t nLength = m_nLength;
+
+    if (sRef.bSequentialFID)
+    {
+        oRet.anValues.resize(nLength);
+        for (size_t i = 0; i < nLength; ++i)
+            oRet.anValues[i] = static_cast<int64_t>(m_nBaseSeqFID) +
+                               static_cast<int64_t>(i);
+        return oRet;
+    }
+
+    // A value is null if it is null in the column, or in any of its parent
+    // structures.
+    for (const auto *psArray : sRef.apsArrays)
+    {
+        const uint8_t *pabyValidity =
+            psArray->null_count == 0
+                ? nullptr
+                : static_cast<const uint8_t *>(psArray->buffers[0]);
+        if (!pabyValidity)
+            continue;
+        oRet.abyIsNull.resize(nLength, false);
+        const size_t nOffset = static_cast<size_t>(psArray->offset);
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            if (!TestBit(pabyValidity, i + nOffset))
+                oRet.abyIsNull[i] = true;
+        }
+    }
+
+    const struct ArrowArray *psArray = sRef.apsArrays.back();
+    const char *format = sRef.psSchema->format;
+    if (IsFloat32(format) || IsFloat64(format))
+    {
+        oRet.eType = ValueType::FLOAT;
+        oRet.adfValues.resize(nLength);
+        const size_t nOffset = static_cast<size_t>(psArray->offset);
+        if (IsFloat32(format))
+        {
+            const float *pafSrc =
+                static_cast<const float *>(psArray->buffers[1]) + nOffset;
+            for (size_t i = 0; i < nLength; ++i)
+                oRet.adfValues[i] = static_cast<double>(pafSrc[i]);
+        }
+        else
+        {
+            const double *padfSrc =
+                static_cast<const double *>(psArray->buffers[1]) + nOffset;
+            std::copy(padfSrc, padfSrc + nLength, oRet.adfValues.begin());
+        }
+        if (!oRet.abyIsNull.empty())
+        {
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                if (oRet.abyIsNull[i])
+                    oRet.adfValues[i] = 0;
+            }
+        }
+    }
+    else if (IsString(format) || IsLargeString(format) || IsStringView(format))
+    {
+        // Strings are stored nul-terminated, and truncated at their first
+        // nul character, as OGRFeature::GetFieldAsString() would do.
+        oRet.eType = ValueType::STRING;
+        oRet.anStringOffsets.resize(nLength);
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            oRet.anStringOffsets[i] = oRet.osStrings.size();
+            if (oRet.IsNull(i))
+            {
+                oRet.osStrings += '\0';
+                continue;
+            }
+            std::string_view sv = IsString(format)
+                                      ? GetStringValue<uint32_t>(psArray, i)
+                                  : IsLargeString(format)
+                                      ? GetStringValue<uint64_t>(psArray, i)
+                                      : GetStringView(psArray, i);
+            const auto nPos = sv.find('\0');
+            if (nPos != std::string_view::npos)
+                sv = sv.substr(0, nPos);
+            oRet.osStrings.append(sv);
+            oRet.osStrings += '\0';
+        }
+    }
+    else
+    {
+        oRet.anValues.resize(nLength);
+        if (IsBoolean(format))
+        {
+            const uint8_t *pabyValues =
+                static_cast<const uint8_t *>(psArray->buffers[1]);
+            const size_t nOffset = static_cast<size_t>(psArray->offset);
+            for (size_t i = 0; i < nLength; ++i)
+                oRet.anValues[i] = TestBit(pabyValues, i + nOffset) ? 1 : 0;
+        }
+        else if (IsInt8(format))
+            FillIntegerValues<int8_t>(psArray, nLength, oRet.anValues);
+        else if (IsUInt8(format))
+            FillIntegerValues<uint8_t>(psArray, nLength, oRet.anValues);
+        else if (IsInt16(format))
+            FillIntegerValues<int16_t>(psArray, nLength, oRet.anValues);
+        else if (IsUInt16(format))
+            FillIntegerValues<uint16_t>(psArray, nLength, oRet.anValues);
+        else if (IsInt32(format))
+            FillIntegerValues<int32_t>(psArray, nLength, oRet.anValues);
+        else if (IsUInt32(format))
+            FillIntegerValues<uint32_t>(psArray, nLength, oRet.anValues);
+        else
+            FillIntegerValues<int64_t>(psArray, nLength, oRet.anValues);
+        if (!oRet.abyIsNull.empty())
+        {
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                if (oRet.abyIsNull[i])
+                    oRet.anValues[i] = 0;
+            }
+        }
+    }
+    return oRet;
+}
+
+/************************************************************************/
+/*                         EvaluateOperation()                          */
+/************************************************************************/
+
+OGRArrowVectorizedFilter::Values
+OGRArrowVectorizedFilter::EvaluateOperation(const swq_expr_node *poNode) const
+{
+    std::vector<Values> aoArgs;
+    aoArgs.reserve(poNode->nSubExprCount);
+    for (int i = 0; i < poNode->nSubExprCount; ++i)
+        aoArgs.push_back(EvaluateNode(poNode->papoSubExpr[i]));
+
+    const size_t nLength = m_nLength;
+    Values oRet;
+    oRet.abyIsNull.resize(nLength, false);
+    if (poNode->field_type == SWQ_FLOAT)
+    {
+        oRet.eType = ValueType::FLOAT;
+        oRet.adfValues.resize(nLength, 0.0);
+    }
+    else
+    {
+        oRet.anValues.resize(nLength, 0);
+    }
+
+    const Values &oArg0 = aoArgs[0];
+    switch (poNode->nOperation)
+    {
+        case SWQ_ISNULL:
+            for (size_t i = 0; i < nLength; ++i)
+                oRet.anValues[i] = oArg0.IsNull(i);
+            return oRet;
+
+        case SWQ_AND:
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                oRet.anValues[i] =
+                    oArg0.GetInteger(i) && aoArgs[1].GetInteger(i);
+                oRet.abyIsNull[i] = oArg0.IsNull(i) && aoArgs[1].IsNull(i);
+            }
+            return oRet;
+
+        case SWQ_OR:
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                oRet.anValues[i] =
+                    oArg0.GetInteger(i) || aoArgs[1].GetInteger(i);
+                oRet.abyIsNull[i] = oArg0.IsNull(i) || aoArgs[1].IsNull(i);
+            }
+            return oRet;
+
+        case SWQ_NOT:
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                oRet.anValues[i] = !oArg0.GetInteger(i) && !oArg0.IsNull(i);
+                oRet.abyIsNull[i] = oArg0.IsNull(i);
+            }
+            return oRet;
+
+        case SWQ_IN:
+            break;
+
+        default:
+        {
+            // A null argument makes the result null
+            for (const auto &oArg : aoArgs)
+            {
+                if (oArg.abyIsNull.empty())
+                    continue;
+                for (size_t i = 0; i < nLength; ++i)
+                {
+                    if (oArg.IsNull(i))
+                        oRet.abyIsNull[i] = true;
+                }
+            }
+            break;
+        }
+    }
+
+    if (oArg0.eType == ValueType::FLOAT ||
+        aoArgs[1].eType == ValueType::FLOAT)
+    {
+        EvaluateFloatOperation(poNode, aoArgs, oRet);
+    }
+    else if (oArg0.eType == ValueType::INTEGER)
+    {
+        EvaluateIntegerOperation(poNode, aoArgs, oRet);
+    }
+    else
+    {
+        EvaluateStringOperation(poNode, aoArgs, oRet);
+    }
+    return oRet;
+}
+
+/************************************************************************/
+/*                             EvaluateIn()                             */
+/************************************************************************/
+
+template <class IsEqual>
+void OGRArrowVectorizedFilter::EvaluateIn(const std::vector<Values> &aoArgs,
+                                          Values &oRet, IsEqual isEqual) const
+{
+    const int nArgs = static_cast<int>(aoArgs.size());
+    for (size_t i = 0; i < m_nLength; ++i)
+    {
+        if (aoArgs[0].IsNull(i))
+        {
+            oRet.abyIsNull[i] = true;
+            continue;
+        }
+        bool bNullFound = false;
+        for (int j = 1; j < nArgs; ++j)
+        {
+            if (aoArgs[j].IsNull(i))
+            {
+                bNullFound = true;
+            }
+            else if (isEqual(i, j))
+            {
+                oRet.anValues[i] = 1;
+                break;
+            }
+        }
+        if (bNullFound && !oRet.anValues[i])
+            oRet.abyIsNull[i] = true;
+    }
+}
+
+/************************************************************************/
+/*                       EvaluateFloatOperation()                       */
+/************************************************************************/
+
+void OGRArrowVectorizedFilter::EvaluateFloatOperation(
+    const swq_expr_node *poNode, const std::vector<Values> &aoArgs,
+    Values &oRet) const
+{
+    const size_t nLength = m_nLength;
+    const Values &oArg0 = aoArgs[0];
+    const Values &oArg1 = aoArgs[1];
+    const auto ForEachNotNull = [&oRet, nLength](auto &&func)
+    {
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            if (!oRet.abyIsNull[i])
+                func(i);
+        }
+    };
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_EQ:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetFloat(i) ==
+                                                oArg1.GetFloat(i); });
+            break;
+
+        case SWQ_NE:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetFloat(i) !=
+                                                oArg1.GetFloat(i); });
+            break;
+
+        case SWQ_GT:
+            ForEachNotNull([&](size_t i) {
+                oRet.anValues[i] = oArg0.GetFloat(i) > oArg1.GetFloat(i);
+            });
+            break;
+
+        case SWQ_LT:
+            ForEachNotNull([&](size_t i) {
+                oRet.anValues[i] = oArg0.GetFloat(i) < oArg1.GetFloat(i);
+            });
+            break;
+
+        case SWQ_GE:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetFloat(i) >=
+                                                oArg1.GetFloat(i); });
+            break;
+
+        case SWQ_LE:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetFloat(i) <=
+                                                oArg1.GetFloat(i); });
+            break;
+
+        case SWQ_IN:
+            EvaluateIn(aoArgs, oRet,
+                       [&aoArgs](size_t i, int j) {
+                           return aoArgs[0].GetFloat(i) ==
+                                  aoArgs[j].GetFloat(i);
+                       });
+            break;
+
+        case SWQ_BETWEEN:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    const double dfVal = oArg0.GetFloat(i);
+                    oRet.anValues[i] = dfVal >= oArg1.GetFloat(i) &&
+                                       dfVal <= aoArgs[2].GetFloat(i);
+                });
+            break;
+
+        case SWQ_ADD:
+            ForEachNotNull([&](size_t i) {
+                oRet.adfValues[i] = oArg0.GetFloat(i) + oArg1.GetFloat(i);
+            });
+            break;
+
+        case SWQ_SUBTRACT:
+            ForEachNotNull([&](size_t i) {
+                oRet.adfValues[i] = oArg0.GetFloat(i) - oArg1.GetFloat(i);
+            });
+            break;
+
+        case SWQ_MULTIPLY:
+            ForEachNotNull([&](size_t i) {
+                oRet.adfValues[i] = oArg0.GetFloat(i) * oArg1.GetFloat(i);
+            });
+            break;
+
+        case SWQ_DIVIDE:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    const double dfDenom = oArg1.GetFloat(i);
+                    oRet.adfValues[i] = dfDenom == 0
+                                            ? INT_MAX
+                                            : oArg0.GetFloat(i) / dfDenom;
+                });
+            break;
+
+        case SWQ_MODULUS:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    const double dfDenom = oArg1.GetFloat(i);
+                    oRet.adfValues[i] = dfDenom == 0
+                                            ? INT_MAX
+                                            : fmod(oArg0.GetFloat(i), dfDenom);
+                });
+            break;
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                       ReportIntegerOverflow()                        */
+/************************************************************************/
+
+void OGRArrowVectorizedFilter::ReportIntegerOverflow(size_t iRow,
+                                                     Values &oRet) const
+{
+    // Rows discarded by other filters would not have been evaluated
+    if ((*m_pabySelected)[iRow])
+        CPLError(CE_Failure, CPLE_AppDefined, "Int overflow");
+    oRet.abyIsNull[iRow] = true;
+}
+
+/************************************************************************/
+/*                      EvaluateIntegerOperation()                      */
+/************************************************************************/
+
+void OGRArrowVectorizedFilter::EvaluateIntegerOperation(
+    const swq_expr_node *poNode, const std::vector<Values> &aoArgs,
+    Values &oRet) const
+{
+    const size_t nLength = m_nLength;
+    const Values &oArg0 = aoArgs[0];
+    const Values &oArg1 = aoArgs[1];
+    const auto ForEachNotNull = [&oRet, nLength](auto &&func)
+    {
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            if (!oRet.abyIsNull[i])
+                func(i);
+        }
+    };
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_EQ:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetInteger(i) ==
+                                                oArg1.GetInteger(i); });
+            break;
+
+        case SWQ_NE:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetInteger(i) !=
+                                                oArg1.GetInteger(i); });
+            break;
+
+        case SWQ_GT:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetInteger(i) >
+                                                oArg1.GetInteger(i); });
+            break;
+
+        case SWQ_LT:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetInteger(i) <
+                                                oArg1.GetInteger(i); });
+            break;
+
+        case SWQ_GE:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetInteger(i) >=
+                                                oArg1.GetInteger(i); });
+            break;
+
+        case SWQ_LE:
+            ForEachNotNull([&](size_t i)
+                           { oRet.anValues[i] = oArg0.GetInteger(i) <=
+                                                oArg1.GetInteger(i); });
+            break;
+
+        case SWQ_IN:
+            EvaluateIn(aoArgs, oRet,
+                       [&aoArgs](size_t i, int j) {
+                           return aoArgs[0].GetInteger(i) ==
+                                  aoArgs[j].GetInteger(i);
+                       });
+            break;
+
+        case SWQ_BETWEEN:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    const int64_t nVal = oArg0.GetInteger(i);
+                    oRet.anValues[i] = nVal >= oArg1.GetInteger(i) &&
+                                       nVal <= aoArgs[2].GetInteger(i);
+                });
+            break;
+
+        case SWQ_ADD:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    try
+                    {
+                        oRet.anValues[i] = (CPLSM(oArg0.GetInteger(i)) +
+                                            CPLSM(oArg1.GetInteger(i)))
+                                               .v();
+                    }
+                    catch (const std::exception &)
+                    {
+                        ReportIntegerOverflow(i, oRet);
+                    }
+                });
+            break;
+
+        case SWQ_SUBTRACT:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    try
+                    {
+                        oRet.anValues[i] = (CPLSM(oArg0.GetInteger(i)) -
+                                            CPLSM(oArg1.GetInteger(i)))
+                                               .v();
+                    }
+                    catch (const std::exception &)
+                    {
+                        ReportIntegerOverflow(i, oRet);
+                    }
+                });
+            break;
+
+        case SWQ_MULTIPLY:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    try
+                    {
+                        oRet.anValues[i] = (CPLSM(oArg0.GetInteger(i)) *
+                                            CPLSM(oArg1.GetInteger(i)))
+                                               .v();
+                    }
+                    catch (const std::exception &)
+                    {
+                        ReportIntegerOverflow(i, oRet);
+                    }
+                });
+            break;
+
+        case SWQ_DIVIDE:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    const int64_t nDenom = oArg1.GetInteger(i);
+                    if (nDenom == 0)
+                    {
+                        oRet.anValues[i] = INT_MAX;
+                        return;
+                    }
+                    try
+                    {
+                        oRet.anValues[i] =
+                            (CPLSM(oArg0.GetInteger(i)) / CPLSM(nDenom)).v();
+                    }
+                    catch (const std::exception &)
+                    {
+                        ReportIntegerOverflow(i, oRet);
+                    }
+                });
+            break;
+
+        case SWQ_MODULUS:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    const int64_t nDenom = oArg1.GetInteger(i);
+                    // x % -1 is always 0, but may trap for the minimum value
+                    oRet.anValues[i] = nDenom == 0    ? INT_MAX
+                                       : nDenom == -1 ? 0
+                                                      : oArg0.GetInteger(i) %
+                                                            nDenom;
+                });
+            break;
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                         OGRArrowStringEqual()                        */
+/************************************************************************/
+
+// Same as the string SWQ_EQ operation of SWQGeneralEvaluator()
+static bool OGRArrowStringEqual(const char *pszA, const char *pszB)
+{
+    // When comparing timestamps, the +00 at the end might be discarded if
+    // the other member has no explicit timezone.
+    const size_t nLenA = strlen(pszA);
+    const size_t nLenB = strlen(pszB);
+    if (nLenA > 3 && nLenB > 3)
+    {
+        if (strcmp(pszA + nLenA - 3, "+00") == 0 && pszB[nLenB - 3] == ':')
+            return EQUALN(pszA, pszB, nLenB);
+        if (pszA[nLenA - 3] == ':' && strcmp(pszB + nLenB - 3, "+00") == 0)
+            return EQUALN(pszA, pszB, nLenA);
+    }
+    return EQUAL(pszA, pszB);
+}
+
+/************************************************************************/
+/*                      EvaluateStringOperation()                       */
+/************************************************************************/
+
+void OGRArrowVectorizedFilter::EvaluateStringOperation(
+    const swq_expr_node *poNode, const std::vector<Values> &aoArgs,
+    Values &oRet) const
+{
+    const size_t nLength = m_nLength;
+    const Values &oArg0 = aoArgs[0];
+    const Values &oArg1 = aoArgs[1];
+    const auto ForEachNotNull = [&oRet, nLength](auto &&func)
+    {
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            if (!oRet.abyIsNull[i])
+                func(i);
+        }
+    };
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_EQ:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    oRet.anValues[i] = OGRArrowStringEqual(oArg0.GetString(i),
+                                                           oArg1.GetString(i));
+                });
+            break;
+
+        case SWQ_NE:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    oRet.anValues[i] = STRCASECMP(oArg0.GetString(i),
+                                                  oArg1.GetString(i)) != 0;
+                });
+            break;
+
+        case SWQ_GT:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    oRet.anValues[i] = STRCASECMP(oArg0.GetString(i),
+                                                  oArg1.GetString(i)) > 0;
+                });
+            break;
+
+        case SWQ_LT:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    oRet.anValues[i] = STRCASECMP(oArg0.GetString(i),
+                                                  oArg1.GetString(i)) < 0;
+                });
+            break;
+
+        case SWQ_GE:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    oRet.anValues[i] = STRCASECMP(oArg0.GetString(i),
+                                                  oArg1.GetString(i)) >= 0;
+                });
+            break;
+
+        case SWQ_LE:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    oRet.anValues[i] = STRCASECMP(oArg0.GetString(i),
+                                                  oArg1.GetString(i)) <= 0;
+                });
+            break;
+
+        case SWQ_IN:
+            EvaluateIn(aoArgs, oRet,
+                       [&aoArgs](size_t i, int j) {
+                           return EQUAL(aoArgs[0].GetString(i),
+                                        aoArgs[j].GetString(i));
+                       });
+            break;
+
+        case SWQ_BETWEEN:
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    const char *pszVal = oArg0.GetString(i);
+                    oRet.anValues[i] =
+                        STRCASECMP(pszVal, oArg1.GetString(i)) >= 0 &&
+                        STRCASECMP(pszVal, aoArgs[2].GetString(i)) <= 0;
+                });
+            break;
+
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+        {
+            const char chEscape =
+                aoArgs.size() == 3 ? aoArgs[2].GetString(0)[0] : '\0';
+            const bool bInsensitive =
+                poNode->nOperation == SWQ_ILIKE ||
+                CPLTestBool(
+                    CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+            ForEachNotNull(
+                [&](size_t i)
+                {
+                    oRet.anValues[i] = swq_test_like(
+                        oArg0.GetString(i), oArg1.GetString(i), chEscape,
+                        bInsensitive, m_sContext.bUTF8Strings);
+                });
+            break;
+        }
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                   FillValidityArrayFromAttrQuery()                   */
 /************************************************************************/
@@ -5290,6 +6456,24 @@ static size_t FillValidityArrayFromAttrQuery(
         }
     }
 
+    if (CPLTestBool(CPLGetConfigOption("OGR_ARROW_VECTORIZED_FILTER", "YES")))
+    {
+        OGRArrowVectorizedFilter oFilter(poFeatureDefn, schema, array,
+                                         poAttrQuery->GetContext());
+        for (const auto &sInfo : aoUsedFieldsInfo)
+            oFilter.SetFieldArrowPath(sInfo.iOGRFieldIndex, sInfo.anArrowPath);
+        if (bNeedsFID)
+        {
+            oFilter.SetBaseSequentialFID(nBaseSeqFID);
+            oFilter.SetFIDArrowPath(anArrowPathToFIDColumn);
+        }
+        if (oFilter.Compile(
+                static_cast<swq_expr_node *>(poAttrQuery->GetSWQExpr())))
+        {
+            return oFilter.Evaluate(abyValidityFromFilters);
+        }
+    }
+
     for (size_t iRow = 0; iRow < nLength; ++iRow)
     {
         if (!abyValidityFromFilters[iRow])
@@ -19,12 +19,19 @@
 #include "gdal_shapelib_symbol_rename.h"
 #endif
 
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "ogrsf_frmts.h"
 #include "shapefil.h"
 #include "shp_vsi.h"
 #include "ogrlayerpool.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
 #include <set>
+#include <string>
+#include <thread>
 #include <vector>
 
 /* Was limited to 255 until OGR 1.10, but 254 seems to be a more */
@@ -42,6 +49,8 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               bool &bHasWarnedWrongWindingOrder);
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
                               bool &bHasWarnedWrongWindingOrder);
+void SHPSetOGRGeometryDimension(OGRGeometry *poGeometry,
+                                OGRwkbGeometryType eLayerGeomType);
 OGRFeatureDefnRefCountedPtr
 SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP, DBFHandle hDBF,
                       VSILFILE *fpSHPXML, const char *pszSHPEncoding,
@@ -95,6 +104,7 @@ class OGRShapeGeomFieldDefn final : public OGRGeomFieldDefn
 /************************************************************************/
 
 class OGRShapeDataSource;
+class OGRArrowArrayHelper;
 
 class OGRShapeLayer final : public OGRAbstractProxiedLayer
 {
@@ -190,6 +200,44 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void CloseUnderlyingLayer() override;
 
+    // Used by GetNextArrowArray() to decode ranges of records in worker
+    // threads, with their own .shp and .dbf handles.
+    struct ArrowArrayPrefetchTask
+    {
+        std::thread m_oThread{};
+        std::condition_variable m_oCV{};
+        std::mutex m_oMutex{};
+        bool m_bArrayReady = false;
+        bool m_bFetchRows = false;
+        bool m_bStop = false;
+        bool m_bError = false;
+        bool m_bMemoryLimitReached = false;
+        bool m_bHasWarnedWrongWindingOrder = false;
+        CPLErrorAccumulator m_oErrorAccumulator{};
+        SHPHandle m_hSHP = nullptr;
+        DBFHandle m_hDBF = nullptr;
+        uint32_t m_nMemLimit = 0;
+        int m_iStartShapeId = 0;
+        int m_iNextShapeId = 0;
+        std::unique_ptr<struct ArrowArray> m_psArrowArray{};
+        std::unique_ptr<OGRArrowArrayHelper> m_poHelper{};
+
+        ArrowArrayPrefetchTask() = default;
+        ~ArrowArrayPrefetchTask();
+
+        CPL_DISALLOW_COPY_ASSIGN(ArrowArrayPrefetchTask)
+    };
+
+    std::queue<std::unique_ptr<ArrowArrayPrefetchTask>>
+        m_oQueueArrowArrayPrefetchTasks{};
+
+    bool CanUseArrowArrayPrefetchTasks() const;
+    void StartArrowArrayPrefetchTasks();
+    bool PrepareArrowArrayPrefetchTask(ArrowArrayPrefetchTask *poTask);
+    bool FillArrowArray(ArrowArrayPrefetchTask *poTask) const;
+    int GetNextArrowArrayAsynchronous(struct ArrowArray *out_array);
+    void CancelAsyncNextArrowArray();
+
     // WARNING: Each of the below public methods should start with a call to
     // TouchLayer() and test its return value, so as to make sure that
     // the layer is properly re-opened if necessary.
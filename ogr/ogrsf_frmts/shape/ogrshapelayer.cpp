@@ -32,6 +32,7 @@
 #include "cpl_time.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "gdal_thread_pool.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
@@ -231,6 +232,8 @@ OGRShapeLayer::OGRShapeLayer(OGRShapeDataSource *poDSIn,
 OGRShapeLayer::~OGRShapeLayer()
 
 {
+    CancelAsyncNextArrowArray();
+
     if (m_eNeedRepack == YES && m_bAutoRepack)
         Repack();
 
@@ -767,6 +770,8 @@ bool OGRShapeLayer::ScanIndices()
 void OGRShapeLayer::ResetReading()
 
 {
+    CancelAsyncNextArrowArray();
+
     if (!TouchLayer())
         return;
 
@@ -819,6 +824,7 @@ void OGRShapeLayer::ClearSpatialFIDs()
 OGRErr OGRShapeLayer::ISetSpatialFilter(int iGeomField,
                                         const OGRGeometry *poGeomIn)
 {
+    CancelAsyncNextArrowArray();
     ClearMatchingFIDs();
 
     if (poGeomIn == nullptr)
@@ -850,6 +856,7 @@ OGRErr OGRShapeLayer::ISetSpatialFilter(int iGeomField,
 
 OGRErr OGRShapeLayer::SetAttributeFilter(const char *pszAttributeFilter)
 {
+    CancelAsyncNextArrowArray();
     ClearMatchingFIDs();
 
     return OGRLayer::SetAttributeFilter(pszAttributeFilter);
@@ -865,6 +872,8 @@ OGRErr OGRShapeLayer::SetAttributeFilter(const char *pszAttributeFilter)
 OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 
 {
+    CancelAsyncNextArrowArray();
+
     if (!TouchLayer())
         return OGRERR_FAILURE;
 
@@ -3886,8 +3895,10 @@ GDALDataset *OGRShapeLayer::GetDataset()
 /*                         GetNextArrowArray()                          */
 /************************************************************************/
 
-// Specialized implementation restricted to situations where only retrieving
-// of FID values is asked (without filters)
+// Specialized implementations restricted to situations where no filter is
+// set: either only retrieving of FID values is asked, or attributes and
+// geometries are decoded by worker threads (see
+// GetNextArrowArrayAsynchronous()).
 // In other cases, fall back to generic implementation.
 int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                      struct ArrowArray *out_array)
@@ -3904,6 +3915,16 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
 
+    if (m_oQueueArrowArrayPrefetchTasks.empty() &&
+        CanUseArrowArrayPrefetchTasks())
+    {
+        StartArrowArrayPrefetchTasks();
+    }
+    if (!m_oQueueArrowArrayPrefetchTasks.empty())
+    {
+        return GetNextArrowArrayAsynchronous(out_array);
+    }
+
     // If any field is not ignored, use generic implementation
     const int nFieldCount = m_poFeatureDefn->GetFieldCount();
     for (int i = 0; i < nFieldCount; ++i)
@@ -3961,6 +3982,572 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     return 0;
 }
 
+/************************************************************************/
+/*                         GetArrowNumThreads()                         */
+/************************************************************************/
+
+static int GetArrowNumThreads()
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("SHAPE_NUM_THREADS", nullptr);
+    if (pszNumThreads == nullptr)
+        return std::min(4, CPLGetNumCPUs());
+
+    bool bOK = false;
+    const int nThreads =
+        GDALGetNumThreads(pszNumThreads, CPLGetNumCPUs(),
+                          /* bDefaultAllCPUs = */ false, nullptr, &bOK);
+    if (!bOK || (!EQUAL(pszNumThreads, "ALL_CPUS") && atoi(pszNumThreads) < 0))
+    {
+        CPLError(CE_Warning, CPLE_IllegalArg,
+                 "Invalid value for SHAPE_NUM_THREADS: %s. Using 1 thread",
+                 pszNumThreads);
+        return 1;
+    }
+    return nThreads;
+}
+
+/************************************************************************/
+/*                   CanUseArrowArrayPrefetchTasks()                    */
+/************************************************************************/
+
+// Whether the remaining records can be decoded by worker threads in
+// GetNextArrowArrayAsynchronous(). Only attribute types that
+// FillArrowArray() knows how to decode are accepted.
+bool OGRShapeLayer::CanUseArrowArrayPrefetchTasks() const
+{
+    if (m_bUpdateAccess || m_hDBF == nullptr ||
+        m_hDBF->nRecords < m_nTotalShapeCount ||
+        (m_hSHP != nullptr && m_hSHP->nRecords < m_nTotalShapeCount))
+    {
+        return false;
+    }
+
+    // Do not interfere with features already fetched by the generic
+    // implementation.
+    if (m_poSharedArrowArrayStreamPrivateData &&
+        !m_poSharedArrowArrayStreamPrivateData->m_oFeatureQueue.empty())
+    {
+        return false;
+    }
+
+    // Only worth it if there are at least 2 batches to read
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        m_aosArrowArrayStreamOptions);
+    if (m_iNextShapeId < 0 ||
+        m_nTotalShapeCount - m_iNextShapeId <= nMaxBatchSize)
+    {
+        return false;
+    }
+
+    bool bHasDataToDecode =
+        m_hSHP != nullptr && m_poFeatureDefn->GetGeomFieldCount() > 0 &&
+        !m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored();
+    const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        const OGRFieldDefn *poFieldDefn = m_poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        const auto eSubType = poFieldDefn->GetSubType();
+        switch (poFieldDefn->GetType())
+        {
+            case OFTInteger:
+                if (eSubType != OFSTNone && eSubType != OFSTBoolean)
+                    return false;
+                break;
+            case OFTReal:
+                if (eSubType != OFSTNone)
+                    return false;
+                break;
+            case OFTString:
+            case OFTInteger64:
+            case OFTDate:
+                break;
+            default:
+                return false;
+        }
+        bHasDataToDecode = true;
+    }
+
+    return bHasDataToDecode && GetArrowNumThreads() >= 2;
+}
+
+/************************************************************************/
+/*                      ~ArrowArrayPrefetchTask()                       */
+/************************************************************************/
+
+OGRShapeLayer::ArrowArrayPrefetchTask::~ArrowArrayPrefetchTask()
+{
+    {
+        std::lock_guard oLock(m_oMutex);
+        m_bStop = true;
+        m_oCV.notify_one();
+    }
+    if (m_oThread.joinable())
+        m_oThread.join();
+
+    if (m_psArrowArray && m_psArrowArray->release)
+        m_psArrowArray->release(m_psArrowArray.get());
+
+    if (m_hDBF != nullptr)
+        DBFClose(m_hDBF);
+    if (m_hSHP != nullptr)
+        SHPClose(m_hSHP);
+}
+
+/************************************************************************/
+/*                   PrepareArrowArrayPrefetchTask()                    */
+/************************************************************************/
+
+// Allocate, in the calling thread, the ArrowArray that the worker thread of
+// the task will fill.
+bool OGRShapeLayer::PrepareArrowArrayPrefetchTask(
+    ArrowArrayPrefetchTask *poTask)
+{
+    if (poTask->m_psArrowArray->release)
+        poTask->m_psArrowArray->release(poTask->m_psArrowArray.get());
+    poTask->m_poHelper = std::make_unique<OGRArrowArrayHelper>(
+        m_poDS, m_poFeatureDefn.get(), m_aosArrowArrayStreamOptions,
+        poTask->m_psArrowArray.get());
+    poTask->m_iNextShapeId = poTask->m_iStartShapeId;
+    poTask->m_bError = false;
+    poTask->m_bMemoryLimitReached = false;
+    return poTask->m_psArrowArray->release != nullptr;
+}
+
+/************************************************************************/
+/*                    StartArrowArrayPrefetchTasks()                    */
+/************************************************************************/
+
+// Start up to SHAPE_NUM_THREADS worker threads, each one decoding a range of
+// m_nMaxBatchSize records, starting at m_iNextShapeId.
+void OGRShapeLayer::StartArrowArrayPrefetchTasks()
+{
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        m_aosArrowArrayStreamOptions);
+    const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
+        (static_cast<GIntBig>(m_nTotalShapeCount) - m_iNextShapeId +
+         nMaxBatchSize - 1) /
+            nMaxBatchSize,
+        GetArrowNumThreads()));
+    CPLDebug("Shape", "Using %d threads", nMaxTasks);
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+
+    for (int iTask = 0; iTask < nMaxTasks; ++iTask)
+    {
+        auto task = std::make_unique<ArrowArrayPrefetchTask>();
+        task->m_iStartShapeId = static_cast<int>(
+            m_iNextShapeId + static_cast<GIntBig>(iTask) * nMaxBatchSize);
+        task->m_nMemLimit = nMemLimit;
+        task->m_bHasWarnedWrongWindingOrder = m_bHasWarnedWrongWindingOrder;
+        if (m_hSHP != nullptr)
+        {
+            task->m_hSHP = m_poDS->DS_SHPOpen(m_osFullName.c_str(), "r");
+            if (task->m_hSHP == nullptr)
+                break;
+        }
+        task->m_hDBF = m_poDS->DS_DBFOpen(m_osFullName.c_str(), "r");
+        if (task->m_hDBF == nullptr)
+            break;
+        task->m_psArrowArray = std::make_unique<struct ArrowArray>();
+        memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+        if (!PrepareArrowArrayPrefetchTask(task.get()))
+            break;
+
+        auto taskPtr = task.get();
+        auto taskRunner = [this, taskPtr]()
+        {
+            std::unique_lock oLock(taskPtr->m_oMutex);
+            do
+            {
+                taskPtr->m_bFetchRows = false;
+                {
+                    auto oContext = taskPtr->m_oErrorAccumulator
+                                        .InstallForCurrentScope();
+                    taskPtr->m_bError = !FillArrowArray(taskPtr);
+                }
+                taskPtr->m_bArrayReady = true;
+                taskPtr->m_oCV.notify_one();
+                while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                {
+                    taskPtr->m_oCV.wait(oLock);
+                }
+            } while (!taskPtr->m_bStop);
+        };
+
+        task->m_bFetchRows = true;
+        try
+        {
+            task->m_oThread = std::thread(taskRunner);
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot start worker thread: %s", e.what());
+            break;
+        }
+        m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
+    }
+}
+
+/************************************************************************/
+/*                           FillArrowArray()                           */
+/************************************************************************/
+
+// Called from a worker thread. Decode the records of the range of the task
+// directly into its ArrowArray, using the .shp and .dbf handles of the task.
+bool OGRShapeLayer::FillArrowArray(ArrowArrayPrefetchTask *poTask) const
+{
+    OGRArrowArrayHelper &oHelper = *(poTask->m_poHelper);
+    SHPHandle hSHP = poTask->m_hSHP;
+    DBFHandle hDBF = poTask->m_hDBF;
+    const uint32_t nMemLimit = poTask->m_nMemLimit;
+    const int iEndShapeId = static_cast<int>(
+        std::min<GIntBig>(m_nTotalShapeCount,
+                          static_cast<GIntBig>(poTask->m_iStartShapeId) +
+                              oHelper.m_nMaxBatchSize));
+
+    // Whether adding nLen bytes to the variable-length array psArray would
+    // make it exceed the memory limit.
+    const auto ExceedsMemLimit =
+        [nMemLimit](const struct ArrowArray *psArray, int iFeat, size_t nLen)
+    {
+        const uint32_t nCurLength =
+            static_cast<const uint32_t *>(psArray->buffers[1])[iFeat];
+        return iFeat > 0 && nLen <= nMemLimit &&
+               nLen > nMemLimit - nCurLength;
+    };
+
+    const int iGeomArrowField =
+        hSHP != nullptr && !oHelper.m_mapOGRGeomFieldToArrowField.empty()
+            ? oHelper.m_mapOGRGeomFieldToArrowField[0]
+            : -1;
+    const OGRwkbGeometryType eGeomType =
+        iGeomArrowField >= 0 ? m_poFeatureDefn->GetGeomFieldDefn(0)->GetType()
+                             : wkbNone;
+    std::unique_ptr<OGRGeometry> poEmptyGeom;
+    if (iGeomArrowField >= 0 &&
+        !m_poFeatureDefn->GetGeomFieldDefn(0)->IsNullable())
+    {
+        poEmptyGeom.reset(OGRGeometryFactory::createGeometry(
+            wkbFlatten(eGeomType) == wkbUnknown ? wkbGeometryCollection
+                                                : eGeomType));
+    }
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int iFeat = 0;
+    int iShape = poTask->m_iStartShapeId;
+    for (; iShape < iEndShapeId; ++iShape)
+    {
+        if (DBFIsRecordDeleted(hDBF, iShape))
+            continue;
+        if (VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)) ||
+            VSIFErrorL(VSI_SHP_GetVSIL(hDBF->fp)))
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Error while reading %s",
+                     CPLResetExtensionSafe(m_osFullName.c_str(), "dbf")
+                         .c_str());
+            return false;
+        }
+
+        if (oHelper.m_bIncludeFID)
+            oHelper.m_panFIDValues[iFeat] = iShape;
+
+        for (int iField = 0; iField < oHelper.m_nFieldCount &&
+                             !poTask->m_bMemoryLimitReached;
+             ++iField)
+        {
+            const int iArrowField = oHelper.m_mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefn(iField);
+            const auto eType = poFieldDefn->GetType();
+            struct ArrowArray *psArray =
+                oHelper.m_out_array->children[iArrowField];
+
+            if (eType == OFTString)
+            {
+                const char *pszFieldVal =
+                    DBFReadStringAttribute(hDBF, iShape, iField);
+                if (pszFieldVal == nullptr || pszFieldVal[0] == '\0')
+                {
+                    if (!oHelper.SetNull(iArrowField, iFeat))
+                        return false;
+                    continue;
+                }
+                char *pszUTF8Field = nullptr;
+                if (!m_osEncoding.empty())
+                {
+                    pszUTF8Field = CPLRecode(pszFieldVal, m_osEncoding.c_str(),
+                                             CPL_ENC_UTF8);
+                    pszFieldVal = pszUTF8Field;
+                }
+                const size_t nLen = strlen(pszFieldVal);
+                if (ExceedsMemLimit(psArray, iFeat, nLen))
+                {
+                    poTask->m_bMemoryLimitReached = true;
+                }
+                else
+                {
+                    GByte *pabyDst = oHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (pabyDst == nullptr)
+                    {
+                        CPLFree(pszUTF8Field);
+                        return false;
+                    }
+                    memcpy(pabyDst, pszFieldVal, nLen);
+                }
+                CPLFree(pszUTF8Field);
+                continue;
+            }
+
+            if (DBFIsAttributeNULL(hDBF, iShape, iField))
+            {
+                if (!oHelper.SetNull(iArrowField, iFeat))
+                    return false;
+                continue;
+            }
+
+            if (eType == OFTInteger && poFieldDefn->GetSubType() == OFSTBoolean)
+            {
+                const char *pszVal =
+                    DBFReadLogicalAttribute(hDBF, iShape, iField);
+                if (pszVal[0] == 'T' || pszVal[0] == 't' || pszVal[0] == 'Y' ||
+                    pszVal[0] == 'y')
+                {
+                    OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                }
+                continue;
+            }
+
+            const char *pszVal = DBFReadStringAttribute(hDBF, iShape, iField);
+            if (eType == OFTInteger)
+            {
+                const long long nVal64 = std::strtoll(pszVal, nullptr, 10);
+                OGRArrowArrayHelper::SetInt32(
+                    psArray, iFeat,
+                    nVal64 > INT_MAX   ? INT_MAX
+                    : nVal64 < INT_MIN ? INT_MIN
+                                       : static_cast<int>(nVal64));
+            }
+            else if (eType == OFTInteger64)
+            {
+                OGRArrowArrayHelper::SetInt64(
+                    psArray, iFeat, CPLAtoGIntBigEx(pszVal, FALSE, nullptr));
+            }
+            else if (eType == OFTReal)
+            {
+                OGRArrowArrayHelper::SetDouble(psArray, iFeat,
+                                               CPLStrtod(pszVal, nullptr));
+            }
+            else
+            {
+                CPLAssert(eType == OFTDate);
+                OGRField sFld;
+                memset(&sFld, 0, sizeof(sFld));
+                if (strlen(pszVal) >= 10 && pszVal[2] == '/' &&
+                    pszVal[5] == '/')
+                {
+                    sFld.Date.Month = static_cast<GByte>(atoi(pszVal + 0));
+                    sFld.Date.Day = static_cast<GByte>(atoi(pszVal + 3));
+                    sFld.Date.Year = static_cast<GInt16>(atoi(pszVal + 6));
+                }
+                else
+                {
+                    const int nFullDate = atoi(pszVal);
+                    sFld.Date.Year = static_cast<GInt16>(nFullDate / 10000);
+                    sFld.Date.Month =
+                        static_cast<GByte>((nFullDate / 100) % 100);
+                    sFld.Date.Day = static_cast<GByte>(nFullDate % 100);
+                }
+                OGRArrowArrayHelper::SetDate(psArray, iFeat, brokenDown, sFld);
+            }
+        }
+
+        if (iGeomArrowField >= 0 && !poTask->m_bMemoryLimitReached)
+        {
+            std::unique_ptr<OGRGeometry> poGeometry(SHPReadOGRObject(
+                hSHP, iShape, nullptr, poTask->m_bHasWarnedWrongWindingOrder));
+            if (poGeometry)
+                SHPSetOGRGeometryDimension(poGeometry.get(), eGeomType);
+            const OGRGeometry *poGeomToWrite =
+                poGeometry ? poGeometry.get() : poEmptyGeom.get();
+            if (poGeomToWrite == nullptr)
+            {
+                if (!oHelper.SetNull(iGeomArrowField, iFeat))
+                    return false;
+            }
+            else
+            {
+                const size_t nLen = poGeomToWrite->WkbSize();
+                struct ArrowArray *psArray =
+                    oHelper.m_out_array->children[iGeomArrowField];
+                if (ExceedsMemLimit(psArray, iFeat, nLen))
+                {
+                    poTask->m_bMemoryLimitReached = true;
+                }
+                else
+                {
+                    GByte *pabyWKB = oHelper.GetPtrForStringOrBinary(
+                        iGeomArrowField, iFeat, nLen);
+                    if (pabyWKB == nullptr)
+                        return false;
+                    poGeomToWrite->exportToWkb(wkbNDR, pabyWKB, wkbVariantIso);
+                }
+            }
+        }
+
+        if (poTask->m_bMemoryLimitReached)
+        {
+            CPLDebug("Shape",
+                     "FillArrowArray(): premature end of batch after %d "
+                     "features due to too big array",
+                     iFeat);
+            // The current record is left for the next batch: forget about
+            // the null values that may have already been set for it.
+            for (int i = 0; i < oHelper.m_nChildren; ++i)
+            {
+                struct ArrowArray *psChild = oHelper.m_out_array->children[i];
+                const uint8_t *pabyValidity =
+                    static_cast<const uint8_t *>(psChild->buffers[0]);
+                if (pabyValidity &&
+                    (pabyValidity[iFeat / 8] & (1 << (iFeat % 8))) == 0)
+                {
+                    --psChild->null_count;
+                }
+            }
+            break;
+        }
+
+        ++iFeat;
+    }
+
+    poTask->m_iNextShapeId = iShape;
+    oHelper.Shrink(iFeat);
+    return true;
+}
+
+/************************************************************************/
+/*                   GetNextArrowArrayAsynchronous()                    */
+/************************************************************************/
+
+// Return the ArrowArray of the oldest queued task, and recycle that task to
+// decode the next range of records that is not yet assigned to a task.
+int OGRShapeLayer::GetNextArrowArrayAsynchronous(struct ArrowArray *out_array)
+{
+    memset(out_array, 0, sizeof(*out_array));
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        m_aosArrowArrayStreamOptions);
+
+    while (!m_oQueueArrowArrayPrefetchTasks.empty())
+    {
+        const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
+        auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
+        m_oQueueArrowArrayPrefetchTasks.pop();
+
+        // Wait for thread to be ready
+        {
+            std::unique_lock oLock(task->m_oMutex);
+            while (!task->m_bArrayReady)
+            {
+                task->m_oCV.wait(oLock);
+            }
+            task->m_bArrayReady = false;
+        }
+        task->m_oErrorAccumulator.ReplayErrors();
+        task->m_oErrorAccumulator.ClearErrors();
+        if (task->m_bHasWarnedWrongWindingOrder)
+            m_bHasWarnedWrongWindingOrder = true;
+
+        if (task->m_bError)
+        {
+            task.reset();
+            CancelAsyncNextArrowArray();
+            return EIO;
+        }
+        if (task->m_iStartShapeId != m_iNextShapeId)
+        {
+            // Should not normally happen, unless the user messes with
+            // GetNextFeature()
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Worker thread task has not expected m_iStartShapeId "
+                     "value. Got %d, expected %d",
+                     task->m_iStartShapeId, m_iNextShapeId);
+            task.reset();
+            CancelAsyncNextArrowArray();
+            return EIO;
+        }
+
+        m_iNextShapeId = task->m_iNextShapeId;
+        const bool bHasFeatures = task->m_psArrowArray->length > 0;
+        if (bHasFeatures)
+        {
+            // Transfer the task ArrowArray to the client array
+            memcpy(out_array, task->m_psArrowArray.get(),
+                   sizeof(struct ArrowArray));
+            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+        }
+
+        if (task->m_bMemoryLimitReached)
+        {
+            // The range of records of this task has been partly read, so
+            // the other tasks are now out of sync. Restart them from
+            // m_iNextShapeId at next call.
+            task.reset();
+            CancelAsyncNextArrowArray();
+        }
+        // Are the records still available for reading beyond the current
+        // queued tasks ? If so, recycle this task to read them
+        else if (task->m_iStartShapeId +
+                     static_cast<GIntBig>(nTasks) * nMaxBatchSize <
+                 m_nTotalShapeCount)
+        {
+            task->m_iStartShapeId = static_cast<int>(
+                task->m_iStartShapeId +
+                static_cast<GIntBig>(nTasks) * nMaxBatchSize);
+            if (!PrepareArrowArrayPrefetchTask(task.get()))
+            {
+                task.reset();
+                CancelAsyncNextArrowArray();
+                if (out_array->release)
+                    out_array->release(out_array);
+                memset(out_array, 0, sizeof(*out_array));
+                return ENOMEM;
+            }
+            // Wake-up thread with new task
+            {
+                std::lock_guard oLock(task->m_oMutex);
+                task->m_bFetchRows = true;
+                task->m_oCV.notify_one();
+            }
+            m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
+        }
+
+        if (bHasFeatures)
+            return 0;
+    }
+
+    return 0;
+}
+
+/************************************************************************/
+/*                     CancelAsyncNextArrowArray()                      */
+/************************************************************************/
+
+void OGRShapeLayer::CancelAsyncNextArrowArray()
+{
+    // The destructor of a task stops and joins its thread
+    while (!m_oQueueArrowArrayPrefetchTasks.empty())
+        m_oQueueArrowArrayPrefetchTasks.pop();
+}
+
 /************************************************************************/
 /*                          GetMetadataItem()                           */
 /************************************************************************/
@@ -1384,6 +1384,39 @@ SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP, DBFHandle hDBF,
     return poDefn;
 }
 
+/************************************************************************/
+/*                     SHPSetOGRGeometryDimension()                     */
+/*                                                                      */
+/*      Set/unset the Z and M flags of a geometry read from a shape,    */
+/*      according to the geometry type of the layer.                    */
+/************************************************************************/
+
+void SHPSetOGRGeometryDimension(OGRGeometry *poGeometry,
+                                OGRwkbGeometryType eLayerGeomType)
+
+{
+    if (eLayerGeomType == wkbUnknown)
+        return;
+
+    const OGRwkbGeometryType eGeomInType = poGeometry->getGeometryType();
+    if (wkbHasZ(eLayerGeomType) && !wkbHasZ(eGeomInType))
+    {
+        poGeometry->set3D(TRUE);
+    }
+    else if (!wkbHasZ(eLayerGeomType) && wkbHasZ(eGeomInType))
+    {
+        poGeometry->set3D(FALSE);
+    }
+    if (wkbHasM(eLayerGeomType) && !wkbHasM(eGeomInType))
+    {
+        poGeometry->setMeasured(TRUE);
+    }
+    else if (!wkbHasM(eLayerGeomType) && wkbHasM(eGeomInType))
+    {
+        poGeometry->setMeasured(FALSE);
+    }
+}
+
 /************************************************************************/
 /*                         SHPReadOGRFeature()                          */
 /************************************************************************/
@@ -1437,31 +1470,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
 
             if (poGeometry)
             {
-                // Set/unset flags.
-                const OGRwkbGeometryType eMyGeomType =
-                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType();
-
-                if (eMyGeomType != wkbUnknown)
-                {
-                    OGRwkbGeometryType eGeomInType =
-                        poGeometry->getGeometryType();
-                    if (wkbHasZ(eMyGeomType) && !wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(TRUE);
-                    }
-                    else if (!wkbHasZ(eMyGeomType) && wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(FALSE);
-                    }
-                    if (wkbHasM(eMyGeomType) && !wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(TRUE);
-                    }
-                    else if (!wkbHasM(eMyGeomType) && wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(FALSE);
-                    }
-                }
+                SHPSetOGRGeometryDimension(
+                    poGeometry,
+                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType());
             }
 
             poFeature->SetGeometryDirectly(poGeometry);
@@ -63,6 +63,23 @@ void swqerror(swq_parse_context *context, const char *msg)
     CPLError(CE_Failure, CPLE_AppDefined, "%s", osMsg.c_str());
 }
 
+/************************************************************************/
+/*                        IsFollowedByKeyword()                         */
+/************************************************************************/
+
+// Returns whether the next token after pszNext is pszKeyword.
+
+static bool IsFollowedByKeyword(const char *pszNext, const char *pszKeyword)
+{
+    while (isspace(static_cast<unsigned char>(*pszNext)))
+        pszNext++;
+    const size_t nLen = strlen(pszKeyword);
+    if (!EQUALN(pszNext, pszKeyword, nLen))
+        return false;
+    const unsigned char chAfter = static_cast<unsigned char>(pszNext[nLen]);
+    return !(isalnum(chAfter) || chAfter == '_' || chAfter > 127);
+}
+
 /************************************************************************/
 /*                               swqlex()                               */
 /*                                                                      */
@@ -267,6 +284,10 @@ int swqlex(YYSTYPE *ppNode, swq_parse_context *context)
             nReturn = SWQT_WHERE;
         else if (EQUAL(osToken, "ON"))
             nReturn = SWQT_ON;
+        // GROUP is only a keyword when followed by BY, so that fields named
+        // "group" can still be used without quoting.
+        else if (EQUAL(osToken, "GROUP") && IsFollowedByKeyword(pszNext, "BY"))
+            nReturn = SWQT_GROUP;
         else if (EQUAL(osToken, "ORDER"))
             nReturn = SWQT_ORDER;
         else if (EQUAL(osToken, "BY"))
@@ -388,12 +409,7 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
                 select_info->column_summary[i].oSetDistinctValues =
                     std::set<CPLString, swq_summary::Comparator>(oComparator);
             }
-            select_info->column_summary[i].min =
-                std::numeric_limits<double>::infinity();
-            select_info->column_summary[i].max =
-                -std::numeric_limits<double>::infinity();
-            select_info->column_summary[i].osMin = "9999/99/99 99:99:99";
-            select_info->column_summary[i].osMax = "0000/00/00 00:00:00";
+            swq_summary_init(select_info->column_summary[i]);
         }
         assert(!select_info->column_summary.empty());
     }
@@ -428,10 +444,67 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
         return nullptr;
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Process various options.                                        */
-    /* -------------------------------------------------------------------- */
+    return swq_summary_accumulate(summary, def, pszValue, pdfValue);
+}
 
+/************************************************************************/
+/*                          swq_summary_init()                          */
+/************************************************************************/
+
+void swq_summary_init(swq_summary &summary)
+
+{
+    summary.min = std::numeric_limits<double>::infinity();
+    summary.max = -std::numeric_limits<double>::infinity();
+    summary.osMin = "9999/99/99 99:99:99";
+    summary.osMax = "0000/00/00 00:00:00";
+}
+
+/************************************************************************/
+/*                        swq_summary_add_term()                        */
+/************************************************************************/
+
+static void swq_summary_add_term(swq_summary &summary, double dfNewVal)
+
+{
+    // Cf KahanBabushkaNeumaierSum of
+    // https://en.wikipedia.org/wiki/Kahan_summation_algorithm#Further_enhancements
+    // We set a number of temporary variables as volatile, to
+    // prevent potential undesired compiler optimizations.
+
+    const volatile double new_sum_acc = summary.sum_acc + dfNewVal;
+    if (summary.sum_only_finite_terms && std::isfinite(dfNewVal))
+    {
+        if (std::fabs(summary.sum_acc) >= std::fabs(dfNewVal))
+        {
+            const volatile double diff = (summary.sum_acc - new_sum_acc);
+            summary.sum_correction += (diff + dfNewVal);
+        }
+        else
+        {
+            const volatile double diff = (dfNewVal - new_sum_acc);
+            summary.sum_correction += (diff + summary.sum_acc);
+        }
+    }
+    else
+    {
+        summary.sum_only_finite_terms = false;
+    }
+    summary.sum_acc = new_sum_acc;
+}
+
+/************************************************************************/
+/*                       swq_summary_accumulate()                       */
+/*                                                                      */
+/*      Accumulate a value of a non-DISTINCT column into its summary.   */
+/************************************************************************/
+
+const char *swq_summary_accumulate(swq_summary &summary,
+                                   const swq_col_def *def,
+                                   const char *pszValue,
+                                   const double *pdfValue)
+
+{
     switch (def->col_func)
     {
         case SWQCF_MIN:
@@ -471,33 +544,7 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
             if (pdfValue)
             {
                 summary.count++;
-
-                // Cf KahanBabushkaNeumaierSum of
-                // https://en.wikipedia.org/wiki/Kahan_summation_algorithm#Further_enhancements
-                // We set a number of temporary variables as volatile, to
-                // prevent potential undesired compiler optimizations.
-
-                const double dfNewVal = *pdfValue;
-                const volatile double new_sum_acc = summary.sum_acc + dfNewVal;
-                if (summary.sum_only_finite_terms && std::isfinite(dfNewVal))
-                {
-                    if (std::fabs(summary.sum_acc) >= std::fabs(dfNewVal))
-                    {
-                        const volatile double diff =
-                            (summary.sum_acc - new_sum_acc);
-                        summary.sum_correction += (diff + dfNewVal);
-                    }
-                    else
-                    {
-                        const volatile double diff = (dfNewVal - new_sum_acc);
-                        summary.sum_correction += (diff + summary.sum_acc);
-                    }
-                }
-                else
-                {
-                    summary.sum_only_finite_terms = false;
-                }
-                summary.sum_acc = new_sum_acc;
+                swq_summary_add_term(summary, *pdfValue);
             }
             else if (pszValue && pszValue[0] != '\0')
             {
@@ -595,6 +642,78 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
     return nullptr;
 }
 
+/************************************************************************/
+/*                         swq_summary_merge()                          */
+/*                                                                      */
+/*      Merge into summary the partial summary of the same column       */
+/*      computed on other rows.                                         */
+/************************************************************************/
+
+void swq_summary_merge(swq_summary &summary, const swq_summary &other,
+                       const swq_col_def *def)
+
+{
+    if (other.count == 0)
+        return;
+
+    if (def->distinct_flag)
+    {
+        summary.oSetDistinctValues.insert(other.oSetDistinctValues.begin(),
+                                          other.oSetDistinctValues.end());
+        summary.count =
+            static_cast<GIntBig>(summary.oSetDistinctValues.size());
+        return;
+    }
+
+    switch (def->col_func)
+    {
+        case SWQCF_MIN:
+            summary.min = std::min(summary.min, other.min);
+            if (summary.count == 0 || strcmp(other.osMin, summary.osMin) < 0)
+                summary.osMin = other.osMin;
+            break;
+
+        case SWQCF_MAX:
+            summary.max = std::max(summary.max, other.max);
+            if (summary.count == 0 || strcmp(other.osMax, summary.osMax) > 0)
+                summary.osMax = other.osMax;
+            break;
+
+        case SWQCF_AVG:
+        case SWQCF_SUM:
+            if (!other.sum_only_finite_terms)
+                summary.sum_only_finite_terms = false;
+            swq_summary_add_term(summary, other.sum_acc);
+            summary.sum_correction += other.sum_correction;
+            break;
+
+        case SWQCF_STDDEV_POP:
+        case SWQCF_STDDEV_SAMP:
+        {
+            // Chan et al. parallel variant of Welford's algorithm:
+            // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+            const double dfCount = static_cast<double>(summary.count);
+            const double dfOtherCount = static_cast<double>(other.count);
+            const double dfTotalCount = dfCount + dfOtherCount;
+            const double dfDelta =
+                other.mean_for_variance - summary.mean_for_variance;
+            summary.mean_for_variance +=
+                dfDelta * dfOtherCount / dfTotalCount;
+            summary.sq_dist_from_mean_acc +=
+                other.sq_dist_from_mean_acc +
+                dfDelta * dfDelta * dfCount * dfOtherCount / dfTotalCount;
+            break;
+        }
+
+        case SWQCF_COUNT:
+        case SWQCF_NONE:
+        case SWQCF_CUSTOM:
+            break;
+    }
+
+    summary.count += other.count;
+}
+
 /************************************************************************/
 /*                      sort comparison functions.                      */
 /************************************************************************/
@@ -946,7 +1065,8 @@ CPLErr swq_expr_compile2(const char *where_clause, swq_field_list *field_list,
 static const char *const apszSQLReservedKeywords[] = {
     "OR",    "AND",      "NOT",    "LIKE",   "IS",   "NULL", "IN",    "BETWEEN",
     "CAST",  "DISTINCT", "ESCAPE", "SELECT", "LEFT", "JOIN", "WHERE", "ON",
-    "ORDER", "BY",       "FROM",   "AS",     "ASC",  "DESC", "UNION", "ALL"};
+    "ORDER", "BY",       "FROM",   "AS",     "ASC",  "DESC", "UNION", "ALL",
+    "GROUP"};
 
 int swq_is_reserved_keyword(const char *pszStr)
 {
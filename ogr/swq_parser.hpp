@@ -70,28 +70,29 @@ extern int swqdebug;
     SWQT_JOIN = 271,               /* "JOIN"  */
     SWQT_WHERE = 272,              /* "WHERE"  */
     SWQT_ON = 273,                 /* "ON"  */
-    SWQT_ORDER = 274,              /* "ORDER"  */
-    SWQT_BY = 275,                 /* "BY"  */
-    SWQT_FROM = 276,               /* "FROM"  */
-    SWQT_AS = 277,                 /* "AS"  */
-    SWQT_ASC = 278,                /* "ASC"  */
-    SWQT_DESC = 279,               /* "DESC"  */
-    SWQT_DISTINCT = 280,           /* "DISTINCT"  */
-    SWQT_CAST = 281,               /* "CAST"  */
-    SWQT_UNION = 282,              /* "UNION"  */
-    SWQT_ALL = 283,                /* "ALL"  */
-    SWQT_LIMIT = 284,              /* "LIMIT"  */
-    SWQT_OFFSET = 285,             /* "OFFSET"  */
-    SWQT_EXCEPT = 286,             /* "EXCEPT"  */
-    SWQT_EXCLUDE = 287,            /* "EXCLUDE"  */
-    SWQT_HIDDEN = 288,             /* "HIDDEN"  */
-    SWQT_VALUE_START = 289,        /* SWQT_VALUE_START  */
-    SWQT_SELECT_START = 290,       /* SWQT_SELECT_START  */
-    SWQT_NOT = 291,                /* "NOT"  */
-    SWQT_OR = 292,                 /* "OR"  */
-    SWQT_AND = 293,                /* "AND"  */
-    SWQT_UMINUS = 294,             /* SWQT_UMINUS  */
-    SWQT_RESERVED_KEYWORD = 295    /* "reserved keyword"  */
+    SWQT_GROUP = 274,              /* "GROUP"  */
+    SWQT_ORDER = 275,              /* "ORDER"  */
+    SWQT_BY = 276,                 /* "BY"  */
+    SWQT_FROM = 277,               /* "FROM"  */
+    SWQT_AS = 278,                 /* "AS"  */
+    SWQT_ASC = 279,                /* "ASC"  */
+    SWQT_DESC = 280,               /* "DESC"  */
+    SWQT_DISTINCT = 281,           /* "DISTINCT"  */
+    SWQT_CAST = 282,               /* "CAST"  */
+    SWQT_UNION = 283,              /* "UNION"  */
+    SWQT_ALL = 284,                /* "ALL"  */
+    SWQT_LIMIT = 285,              /* "LIMIT"  */
+    SWQT_OFFSET = 286,             /* "OFFSET"  */
+    SWQT_EXCEPT = 287,             /* "EXCEPT"  */
+    SWQT_EXCLUDE = 288,            /* "EXCLUDE"  */
+    SWQT_HIDDEN = 289,             /* "HIDDEN"  */
+    SWQT_VALUE_START = 290,        /* SWQT_VALUE_START  */
+    SWQT_SELECT_START = 291,       /* SWQT_SELECT_START  */
+    SWQT_NOT = 292,                /* "NOT"  */
+    SWQT_OR = 293,                 /* "OR"  */
+    SWQT_AND = 294,                /* "AND"  */
+    SWQT_UMINUS = 295,             /* SWQT_UMINUS  */
+    SWQT_RESERVED_KEYWORD = 296    /* "reserved keyword"  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -61,6 +61,7 @@
 %token SWQT_JOIN                "JOIN"
 %token SWQT_WHERE               "WHERE"
 %token SWQT_ON                  "ON"
+%token SWQT_GROUP               "GROUP"
 %token SWQT_ORDER               "ORDER"
 %token SWQT_BY                  "BY"
 %token SWQT_FROM                "FROM"
@@ -823,12 +824,12 @@ select_statement:
     | '(' select_core ')' opt_union_all
 
 select_core:
-    SWQT_SELECT select_field_list SWQT_FROM table_def opt_joins opt_where opt_order_by opt_limit opt_offset
+    SWQT_SELECT select_field_list SWQT_FROM table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset
     {
         delete $4;
     }
 
-    | SWQT_SELECT SWQT_DISTINCT select_field_list SWQT_FROM table_def opt_joins opt_where opt_order_by opt_limit opt_offset
+    | SWQT_SELECT SWQT_DISTINCT select_field_list SWQT_FROM table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset
     {
         context->poCurSelect->query_mode = SWQM_DISTINCT_LIST;
         delete $5;
@@ -1098,6 +1099,21 @@ opt_joins:
             delete $3;
         }
 
+opt_group_by:
+    | SWQT_GROUP SWQT_BY group_spec_list
+
+group_spec_list:
+    group_spec ',' group_spec_list
+    | group_spec
+
+group_spec:
+    field_value
+        {
+            context->poCurSelect->PushGroupBy( $1->table_name, $1->string_value );
+            delete $1;
+            $1 = nullptr;
+        }
+
 opt_order_by:
     | SWQT_ORDER SWQT_BY sort_spec_list
 
@@ -76,6 +76,14 @@ swq_select::~swq_select()
         }
     }
 
+    for (int i = 0; i < group_specs; i++)
+    {
+        CPLFree(group_defs[i].table_name);
+        CPLFree(group_defs[i].field_name);
+    }
+
+    CPLFree(group_defs);
+
     for (int i = 0; i < order_specs; i++)
     {
         CPLFree(order_defs[i].table_name);
@@ -288,6 +296,18 @@ char *swq_select::Unparse()
         CPLFree(pszTmp);
     }
 
+    if (group_specs > 0)
+    {
+        osSelect += " GROUP BY ";
+        for (int i = 0; i < group_specs; i++)
+        {
+            if (i > 0)
+                osSelect += ", ";
+            osSelect +=
+                swq_expr_node::QuoteIfNecessary(group_defs[i].field_name, '"');
+        }
+    }
+
     if (order_specs > 0)
     {
         osSelect += " ORDER BY ";
@@ -696,6 +716,24 @@ int swq_select::PushTableDef(const char *pszDataSource, const char *pszName,
     return table_count - 1;
 }
 
+/************************************************************************/
+/*                            PushGroupBy()                             */
+/************************************************************************/
+
+void swq_select::PushGroupBy(const char *pszTableName, const char *pszFieldName)
+
+{
+    group_specs++;
+    group_defs = static_cast<swq_group_def *>(
+        CPLRealloc(group_defs, sizeof(swq_group_def) * group_specs));
+
+    group_defs[group_specs - 1].table_name =
+        CPLStrdup(pszTableName ? pszTableName : "");
+    group_defs[group_specs - 1].field_name = CPLStrdup(pszFieldName);
+    group_defs[group_specs - 1].table_index = -1;
+    group_defs[group_specs - 1].field_index = -1;
+}
+
 /************************************************************************/
 /*                            PushOrderBy()                             */
 /************************************************************************/
@@ -1040,6 +1078,9 @@ CPLErr swq_select::parse(swq_field_list *field_list,
     /*      indications.                                                    */
     /* -------------------------------------------------------------------- */
 
+    if (group_specs > 0 && CheckGroupBy(field_list) != CE_None)
+        return CE_Failure;
+
     int bAllowDistinctOnMultipleFields =
         (poParseOptions && poParseOptions->bAllowDistinctOnMultipleFields);
     if (query_mode == SWQM_DISTINCT_LIST && result_columns() > 1 &&
@@ -1050,7 +1091,8 @@ CPLErr swq_select::parse(swq_field_list *field_list,
         return CE_Failure;
     }
 
-    for (int i = 0; i < result_columns(); i++)
+    // GROUP BY queries have been checked by CheckGroupBy()
+    for (int i = 0; query_mode != SWQM_GROUP_BY && i < result_columns(); i++)
     {
         swq_col_def *def = &column_defs[i];
         int this_indicator = -1;
@@ -1159,6 +1201,21 @@ CPLErr swq_select::parse(swq_field_list *field_list,
                      def->field_name);
             return CE_Failure;
         }
+
+        if (query_mode == SWQM_GROUP_BY)
+        {
+            bool bIsGroupField = false;
+            for (int j = 0; !bIsGroupField && j < group_specs; j++)
+                bIsGroupField = group_defs[j].field_index == def->field_index;
+            if (!bIsGroupField)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Field '%s' used in ORDER BY must be one of the "
+                         "GROUP BY fields",
+                         def->field_name);
+                return CE_Failure;
+            }
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -1179,6 +1236,105 @@ CPLErr swq_select::parse(swq_field_list *field_list,
     return CE_None;
 }
 
+/************************************************************************/
+/*                            CheckGroupBy()                            */
+/*                                                                      */
+/*      Identify the GROUP BY fields, and check that the other          */
+/*      columns are aggregates.                                         */
+/************************************************************************/
+
+CPLErr swq_select::CheckGroupBy(swq_field_list *field_list)
+
+{
+    if (query_mode == SWQM_DISTINCT_LIST)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "SELECT DISTINCT not supported together with GROUP BY.");
+        return CE_Failure;
+    }
+
+    if (join_count > 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GROUP BY not supported together with JOIN.");
+        return CE_Failure;
+    }
+
+    for (int i = 0; i < group_specs; i++)
+    {
+        swq_group_def *def = group_defs + i;
+
+        // Identify field.
+        swq_field_type field_type;
+        def->field_index =
+            swq_identify_field(def->table_name, def->field_name, field_list,
+                               &field_type, &(def->table_index));
+        if (def->field_index == -1)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unrecognized field name %s in GROUP BY.",
+                     def->table_name[0]
+                         ? CPLSPrintf("%s.%s", def->table_name, def->field_name)
+                         : def->field_name);
+            return CE_Failure;
+        }
+
+        if (field_type == SWQ_GEOMETRY)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot use geometry field '%s' in a GROUP BY clause",
+                     def->field_name);
+            return CE_Failure;
+        }
+    }
+
+    for (int i = 0; i < result_columns(); i++)
+    {
+        const swq_col_def *def = &column_defs[i];
+
+        if (def->col_func == SWQCF_NONE)
+        {
+            // Only GROUP BY fields can be selected as such
+            bool bIsGroupField = false;
+            if (def->expr == nullptr || def->expr->eNodeType == SNT_COLUMN)
+            {
+                for (int j = 0; !bIsGroupField && j < group_specs; j++)
+                {
+                    bIsGroupField =
+                        group_defs[j].field_index == def->field_index;
+                }
+            }
+            if (!bIsGroupField)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Column '%s' must be one of the GROUP BY fields, "
+                         "or be used in an aggregate function.",
+                         def->field_alias ? def->field_alias
+                                          : def->field_name);
+                return CE_Failure;
+            }
+        }
+        else if (def->col_func == SWQCF_CUSTOM)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Custom column functions not supported together with "
+                     "GROUP BY.");
+            return CE_Failure;
+        }
+        else if (def->col_func == SWQCF_COUNT && def->distinct_flag &&
+                 def->field_type == SWQ_GEOMETRY)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "SELECT COUNT DISTINCT on a geometry not supported.");
+            return CE_Failure;
+        }
+    }
+
+    query_mode = SWQM_GROUP_BY;
+
+    return CE_None;
+}
+
 bool swq_select::IsFieldExcluded(int src_index, const char *pszTableName,
                                  const char *pszFieldName)
 {
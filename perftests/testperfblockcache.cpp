@@ -0,0 +1,191 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test performance of the global raster block cache under
+ *           multi-threading.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "gdal_priv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+/************************************************************************/
+/*                          BenchRasterBand                             */
+/************************************************************************/
+
+// Synthetic band whose IReadBlock() is nearly free, so that the benchmark
+// measures the cost of the block cache itself.
+class BenchRasterBand final : public GDALRasterBand
+{
+  public:
+    BenchRasterBand(GDALDataset *poDSIn, int nBlockSize)
+    {
+        poDS = poDSIn;
+        nBand = 1;
+        eDataType = GDT_Byte;
+        nRasterXSize = poDSIn->GetRasterXSize();
+        nRasterYSize = poDSIn->GetRasterYSize();
+        nBlockXSize = nBlockSize;
+        nBlockYSize = nBlockSize;
+    }
+
+    CPLErr IReadBlock(int nBlockXOff, int, void *pData) override
+    {
+        static_cast<GByte *>(pData)[0] = static_cast<GByte>(nBlockXOff);
+        return CE_None;
+    }
+};
+
+/************************************************************************/
+/*                           BenchDataset                               */
+/************************************************************************/
+
+class BenchDataset final : public GDALDataset
+{
+  public:
+    BenchDataset(int nSize, int nBlockSize)
+    {
+        nRasterXSize = nSize;
+        nRasterYSize = nSize;
+        SetBand(1, new BenchRasterBand(this, nBlockSize));
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+static void Usage()
+{
+    printf("Usage: testperfblockcache [-threads max_threads] "
+           "[-iters iterations_per_thread]\n"
+           "                          [-size raster_size] "
+           "[-blocksize block_size] [-cachemax bytes]\n"
+           "                          [--config GDAL_CACHE_SHARDS val]\n"
+           "                          [--config GDAL_CACHE_POLICY "
+           "LRU|LAZY_LRU|2Q]\n");
+    exit(1);
+}
+
+/************************************************************************/
+/*                                main()                                */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nMaxThreads = CPLGetNumCPUs();
+    int nIters = 1000 * 1000;
+    int nSize = 8192;
+    int nBlockSize = 64;
+    GIntBig nCacheMax = 16 * 1024 * 1024;
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        if (iArg + 1 < argc && strcmp(argv[iArg], "-threads") == 0)
+            nMaxThreads = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-iters") == 0)
+            nIters = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-size") == 0)
+            nSize = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-blocksize") == 0)
+            nBlockSize = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-cachemax") == 0)
+            nCacheMax = CPLAtoGIntBig(argv[++iArg]);
+        else
+            Usage();
+    }
+
+    GDALSetCacheMax64(nCacheMax);
+    printf("GDAL_CACHE_SHARDS=%s, GDAL_CACHE_POLICY=%s, cache max=" CPL_FRMT_GIB
+           " bytes\n",
+           CPLGetConfigOption("GDAL_CACHE_SHARDS", "1"),
+           CPLGetConfigOption("GDAL_CACHE_POLICY", "LRU"), nCacheMax);
+
+    std::vector<int> anThreadCounts;
+    for (int nThreads = 1; nThreads < nMaxThreads; nThreads *= 2)
+        anThreadCounts.push_back(nThreads);
+    anThreadCounts.push_back(nMaxThreads);
+
+    const int nBlocksPerRow = DIV_ROUND_UP(nSize, nBlockSize);
+    for (const int nThreads : anThreadCounts)
+    {
+        // One dataset per thread, to simulate unrelated workloads that
+        // only share the global block cache.
+        std::vector<std::unique_ptr<BenchDataset>> apoDS;
+        for (int i = 0; i < nThreads; ++i)
+            apoDS.push_back(std::make_unique<BenchDataset>(nSize, nBlockSize));
+
+        GUIntBig nHitsBefore = 0;
+        GUIntBig nMissesBefore = 0;
+        GDALGetCacheStatistics(&nHitsBefore, &nMissesBefore, nullptr);
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> aoThreads;
+        for (int i = 0; i < nThreads; ++i)
+        {
+            aoThreads.emplace_back(
+                [&apoDS, i, nIters, nBlocksPerRow]()
+                {
+                    GDALRasterBand *poBand = apoDS[i]->GetRasterBand(1);
+                    std::mt19937 oGen(i);
+                    std::uniform_int_distribution<int> oDist(
+                        0, nBlocksPerRow - 1);
+                    for (int iIter = 0; iIter < nIters; ++iIter)
+                    {
+                        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(
+                            oDist(oGen), oDist(oGen));
+                        if (poBlock)
+                            poBlock->DropLock();
+                    }
+                });
+        }
+        for (auto &oThread : aoThreads)
+            oThread.join();
+        const double dfElapsed =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                          start)
+                .count();
+
+        GUIntBig nHits = 0;
+        GUIntBig nMisses = 0;
+        GDALGetCacheStatistics(&nHits, &nMisses, nullptr);
+        nHits -= nHitsBefore;
+        nMisses -= nMissesBefore;
+
+        printf("threads=%d: %.0f blocks/s (%.2f s), hit ratio %.1f %%\n",
+               nThreads, static_cast<double>(nIters) * nThreads / dfElapsed,
+               dfElapsed,
+               nHits + nMisses
+                   ? 100.0 * static_cast<double>(nHits) /
+                         static_cast<double>(nHits + nMisses)
+                   : 0.0);
+    }
+
+    CSLDestroy(argv);
+    GDALDestroyDriverManager();
+
+    return 0;
+}
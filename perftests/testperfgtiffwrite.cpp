@@ -0,0 +1,183 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test performance of multi-threaded GTiff/COG writing.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "gdal_priv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+static void Usage()
+{
+    printf("Usage: testperfgtiffwrite [-threads max_threads] [-size size]\n"
+           "                          [-bands count] [-codecs "
+           "codec1,codec2,...] [-iters count]\n"
+           "                          [-cog] [-out filename]\n"
+           "                          [--config GTIFF_OUT_OF_ORDER_WRITES "
+           "YES|NO]\n");
+    exit(1);
+}
+
+/************************************************************************/
+/*                                main()                                */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nMaxThreads = CPLGetNumCPUs();
+    int nSize = 4096;
+    int nBands = 3;
+    int nIters = 1;
+    bool bCOG = false;
+    std::string osOut = "/vsimem/testperfgtiffwrite.tif";
+    CPLStringList aosCodecs(
+        CSLTokenizeString2("DEFLATE,LZW,ZSTD,LERC,WEBP,JPEG", ",", 0));
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        if (iArg + 1 < argc && strcmp(argv[iArg], "-threads") == 0)
+            nMaxThreads = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-size") == 0)
+            nSize = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-bands") == 0)
+            nBands = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-iters") == 0)
+            nIters = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-codecs") == 0)
+            aosCodecs.Assign(CSLTokenizeString2(argv[++iArg], ",", 0));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-out") == 0)
+            osOut = argv[++iArg];
+        else if (strcmp(argv[iArg], "-cog") == 0)
+            bCOG = true;
+        else
+            Usage();
+    }
+
+    GDALAllRegister();
+
+    auto poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    auto poDriver =
+        GetGDALDriverManager()->GetDriverByName(bCOG ? "COG" : "GTiff");
+    if (!poMEMDriver || !poDriver)
+    {
+        fprintf(stderr, "MEM and %s drivers are required\n",
+                bCOG ? "COG" : "GTiff");
+        exit(1);
+    }
+
+    // Smooth gradient with some noise, so that codecs have some work to do,
+    // without being fully incompressible.
+    std::unique_ptr<GDALDataset> poSrcDS(
+        poMEMDriver->Create("", nSize, nSize, nBands, GDT_Byte, nullptr));
+    {
+        std::vector<GByte> abyLine(nSize);
+        unsigned nSeed = 1;
+        for (int iBand = 1; iBand <= nBands; ++iBand)
+        {
+            for (int y = 0; y < nSize; ++y)
+            {
+                for (int x = 0; x < nSize; ++x)
+                {
+                    nSeed = nSeed * 1103515245U + 12345U;
+                    abyLine[x] = static_cast<GByte>(
+                        ((x + y) * iBand / 16 + ((nSeed >> 16) & 7)) & 0xFF);
+                }
+                CPL_IGNORE_RET_VAL(poSrcDS->GetRasterBand(iBand)->RasterIO(
+                    GF_Write, 0, y, nSize, 1, abyLine.data(), nSize, 1,
+                    GDT_Byte, 0, 0, nullptr));
+            }
+        }
+    }
+
+    std::vector<int> anThreadCounts;
+    for (int nThreads = 1; nThreads < nMaxThreads; nThreads *= 2)
+        anThreadCounts.push_back(nThreads);
+    anThreadCounts.push_back(nMaxThreads);
+
+    const double dfMB =
+        static_cast<double>(nSize) * nSize * nBands / (1024.0 * 1024.0);
+    printf("%s, %dx%dx%d, GTIFF_OUT_OF_ORDER_WRITES=%s\n",
+           bCOG ? "COG" : "GTiff", nSize, nSize, nBands,
+           CPLGetConfigOption("GTIFF_OUT_OF_ORDER_WRITES", "NO"));
+
+    const char *pszCompressionMethods =
+        poDriver->GetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST);
+    for (const char *pszCodec : aosCodecs)
+    {
+        if (!pszCompressionMethods ||
+            !strstr(pszCompressionMethods,
+                    CPLSPrintf("<Value>%s</Value>", pszCodec)))
+        {
+            printf("%s: not available\n", pszCodec);
+            continue;
+        }
+        for (const int nThreads : anThreadCounts)
+        {
+            if ((EQUAL(pszCodec, "WEBP") && nBands > 4) ||
+                (EQUAL(pszCodec, "JPEG") && nBands != 1 && nBands != 3))
+                break;
+
+            CPLStringList aosOptions;
+            aosOptions.SetNameValue("COMPRESS", pszCodec);
+            aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", nThreads));
+            if (!bCOG)
+                aosOptions.SetNameValue("TILED", "YES");
+
+            double dfBestElapsed = 0;
+            bool bOK = true;
+            for (int iIter = 0; iIter < nIters && bOK; ++iIter)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                std::unique_ptr<GDALDataset> poDS(
+                    poDriver->CreateCopy(osOut.c_str(), poSrcDS.get(), false,
+                                         aosOptions.List(), nullptr, nullptr));
+                bOK = poDS != nullptr && poDS->Close() == CE_None;
+                poDS.reset();
+                const double dfElapsed =
+                    std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+                if (iIter == 0 || dfElapsed < dfBestElapsed)
+                    dfBestElapsed = dfElapsed;
+                VSIUnlink(osOut.c_str());
+            }
+            if (!bOK)
+            {
+                printf("%s, threads=%d: failed\n", pszCodec, nThreads);
+                break;
+            }
+            printf("%s, threads=%d: %.1f MB/s (%.3f s)\n", pszCodec, nThreads,
+                   dfMB / dfBestElapsed, dfBestElapsed);
+        }
+    }
+
+    poSrcDS.reset();
+    CSLDestroy(argv);
+    GDALDestroyDriverManager();
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test performance of overview computation per resampling method.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "gdal_priv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+static void Usage()
+{
+    printf("Usage: testperfoverview [-size size] [-bands count] "
+           "[-types type1,type2,...]\n"
+           "                        [-methods method1,method2,...] "
+           "[-levels count] [-iters count]\n"
+           "                        [--config GDAL_NUM_THREADS val] "
+           "[--config GDAL_USE_AVX YES|NO]\n");
+    exit(1);
+}
+
+/************************************************************************/
+/*                                main()                                */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nSize = 4096;
+    int nBands = 1;
+    int nLevels = 1;
+    int nIters = 1;
+    CPLStringList aosTypes(CSLTokenizeString2("Byte,UInt16,Float32", ",", 0));
+    CPLStringList aosMethods(CSLTokenizeString2(
+        "NEAREST,AVERAGE,RMS,GAUSS,CUBIC,CUBICSPLINE,LANCZOS,BILINEAR,MODE",
+        ",", 0));
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        if (iArg + 1 < argc && strcmp(argv[iArg], "-size") == 0)
+            nSize = std::max(2, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-bands") == 0)
+            nBands = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-levels") == 0)
+            nLevels = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-iters") == 0)
+            nIters = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-types") == 0)
+            aosTypes.Assign(CSLTokenizeString2(argv[++iArg], ",", 0));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-methods") == 0)
+            aosMethods.Assign(CSLTokenizeString2(argv[++iArg], ",", 0));
+        else
+            Usage();
+    }
+
+    GDALAllRegister();
+
+    auto poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poMEMDriver)
+    {
+        fprintf(stderr, "MEM driver is required\n");
+        exit(1);
+    }
+
+    std::vector<int> anOverviewList;
+    for (int i = 0; i < nLevels; ++i)
+        anOverviewList.push_back(2 << i);
+
+    printf("%dx%dx%d, %d level(s), GDAL_NUM_THREADS=%s, GDAL_USE_AVX=%s\n",
+           nSize, nSize, nBands, nLevels,
+           CPLGetConfigOption("GDAL_NUM_THREADS", "1"),
+           CPLGetConfigOption("GDAL_USE_AVX", "YES"));
+
+    const double dfMPixels = static_cast<double>(nSize) * nSize * nBands / 1e6;
+    for (const char *pszType : aosTypes)
+    {
+        const GDALDataType eDT = GDALGetDataTypeByName(pszType);
+        if (eDT == GDT_Unknown)
+        {
+            printf("%s: unknown data type\n", pszType);
+            continue;
+        }
+
+        // Smooth gradient with some noise, and a limited number of distinct
+        // values, so that MODE has realistic work to do.
+        std::unique_ptr<GDALDataset> poSrcDS(
+            poMEMDriver->Create("", nSize, nSize, nBands, eDT, nullptr));
+        {
+            std::vector<double> adfLine(nSize);
+            unsigned nSeed = 1;
+            for (int iBand = 1; iBand <= nBands; ++iBand)
+            {
+                for (int y = 0; y < nSize; ++y)
+                {
+                    for (int x = 0; x < nSize; ++x)
+                    {
+                        nSeed = nSeed * 1103515245U + 12345U;
+                        adfLine[x] =
+                            ((x + y) * iBand / 16 + ((nSeed >> 16) & 7)) % 256;
+                    }
+                    CPL_IGNORE_RET_VAL(poSrcDS->GetRasterBand(iBand)->RasterIO(
+                        GF_Write, 0, y, nSize, 1, adfLine.data(), nSize, 1,
+                        GDT_Float64, 0, 0, nullptr));
+                }
+            }
+        }
+
+        for (const char *pszMethod : aosMethods)
+        {
+            double dfBestElapsed = 0;
+            bool bOK = true;
+            for (int iIter = 0; iIter < nIters && bOK; ++iIter)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                bOK = poSrcDS->BuildOverviews(
+                          pszMethod, static_cast<int>(anOverviewList.size()),
+                          anOverviewList.data(), 0, nullptr, nullptr, nullptr,
+                          nullptr) == CE_None;
+                const double dfElapsed =
+                    std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+                if (iIter == 0 || dfElapsed < dfBestElapsed)
+                    dfBestElapsed = dfElapsed;
+                CPL_IGNORE_RET_VAL(poSrcDS->BuildOverviews(
+                    "NONE", 0, nullptr, 0, nullptr, nullptr, nullptr,
+                    nullptr));
+            }
+            if (!bOK)
+            {
+                printf("%s, %s: failed\n", pszType, pszMethod);
+                continue;
+            }
+            printf("%s, %s: %.1f Mpixels/s (%.3f s)\n", pszType, pszMethod,
+                   dfMPixels / dfBestElapsed, dfBestElapsed);
+        }
+    }
+
+    CSLDestroy(argv);
+    GDALDestroyDriverManager();
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+# SPDX-License-Identifier: MIT
+# Copyright 2026, GDAL contributors
+
+# Measures the effect of CPL_VSIL_CURL_COALESCE_CONCURRENT_REQUESTS when
+# several threads read overlapping windows of the same remote COG, served
+# by a local HTTP server with an artificial latency.
+
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+from osgeo import gdal
+
+LATENCY = 0.05
+NUM_THREADS = 8
+
+src_ds = gdal.GetDriverByName("MEM").Create("", 4096, 4096, 3)
+for i in range(3):
+    src_ds.GetRasterBand(i + 1).Fill(50 * (i + 1))
+gdal.GetDriverByName("COG").CreateCopy(
+    "/vsimem/src.tif", src_ds, options=["BLOCKSIZE=256", "COMPRESS=NONE"]
+)
+src_ds = None
+f = gdal.VSIFOpenL("/vsimem/src.tif", "rb")
+data = gdal.VSIFReadL(1, gdal.VSIStatL("/vsimem/src.tif").size, f)
+gdal.VSIFCloseL(f)
+gdal.Unlink("/vsimem/src.tif")
+
+get_count = 0
+get_count_lock = threading.Lock()
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+
+    def log_message(self, format, *args):
+        pass
+
+    def do_HEAD(self):
+        self.send_response(200)
+        self.send_header("Content-Length", str(len(data)))
+        self.send_header("Accept-Ranges", "bytes")
+        self.end_headers()
+
+    def do_GET(self):
+        global get_count
+        with get_count_lock:
+            get_count += 1
+        time.sleep(LATENCY)
+        start, end = 0, len(data) - 1
+        rng = self.headers.get("Range")
+        if rng:
+            start, end = [int(x) for x in rng[len("bytes=") :].split("-")]
+            end = min(end, len(data) - 1)
+            self.send_response(206)
+            self.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(data))
+            )
+        else:
+            self.send_response(200)
+        self.send_header("Content-Length", str(end - start + 1))
+        self.end_headers()
+        self.wfile.write(data[start : end + 1])
+
+
+server = ThreadingHTTPServer(("localhost", 0), Handler)
+threading.Thread(target=server.serve_forever, daemon=True).start()
+url = "/vsicurl/http://localhost:%d/src.tif" % server.server_address[1]
+
+
+def read_windows(thread_idx):
+    ds = gdal.Open(url)
+    # Windows read by successive threads largely overlap
+    for i in range(4):
+        xoff = (thread_idx * 256 + i * 1024) % 3072
+        ds.ReadRaster(xoff, i * 1024, 1024, 1024)
+
+
+def doit(coalesce):
+    global get_count
+    gdal.VSICurlClearCache()
+    get_count = 0
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_COALESCE_CONCURRENT_REQUESTS": coalesce,
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+        },
+        thread_local=False,
+    ):
+        start = time.time()
+        threads = [
+            threading.Thread(target=read_windows, args=(i,))
+            for i in range(NUM_THREADS)
+        ]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        end = time.time()
+    print(
+        "CPL_VSIL_CURL_COALESCE_CONCURRENT_REQUESTS=%s: %.2f s, %d GET requests"
+        % (coalesce, end - start, get_count)
+    )
+
+
+for coalesce in ("NO", "YES"):
+    doit(coalesce)
+
+server.shutdown()
@@ -0,0 +1,42 @@
+# SPDX-License-Identifier: MIT
+# Copyright 2026, GDAL contributors
+
+import time
+
+from osgeo import gdal
+
+
+def doit(compress, chunks_in_flight):
+
+    src_filename = "/vsimem/src.tif"
+    if gdal.VSIStatL(src_filename) is None:
+        ds = gdal.GetDriverByName("GTiff").Create(
+            src_filename, 10000, 10000, 3, options=["TILED=YES"]
+        )
+        ds.SetGeoTransform([400000, 10, 0, 5000000, 0, -10])
+        ds.SetProjection("EPSG:32631")
+        ds.GetRasterBand(1).Fill(50)
+        ds.GetRasterBand(2).Fill(100)
+        ds.GetRasterBand(3).Fill(200)
+        ds = None
+
+    dst_filename = "/vsimem/dst.tif"
+    start = time.time()
+    gdal.Warp(
+        dst_filename,
+        src_filename,
+        options=f"-t_srs EPSG:4326 -r cubic -multi -wm 64 -co TILED=YES -co COMPRESS={compress} -wo NUM_THREADS=ALL_CPUS -wo NUM_CHUNKS_IN_FLIGHT={chunks_in_flight}",
+    )
+    end = time.time()
+    print(
+        "COMPRESS=%s, NUM_CHUNKS_IN_FLIGHT=%s: %.2f"
+        % (compress, chunks_in_flight, end - start)
+    )
+    gdal.Unlink(dst_filename)
+
+
+for compress in ("NONE", "ZSTD"):
+    for chunks_in_flight in ("2", "4", "8", "ALL_CPUS"):
+        doit(compress, chunks_in_flight)
+
+gdal.Unlink("/vsimem/src.tif")
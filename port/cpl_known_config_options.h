@@ -82,6 +82,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CLOUD_RUN_TIMEOUT_SECONDS", // from cpl_google_cloud.cpp
    "CLOUD_RUN_WORKER_POOL", // from cpl_google_cloud.cpp
    "COG_DELETE_TEMP_FILES", // from cogdriver.cpp
+   "COG_IN_MEMORY_OVERVIEWS_MAX_SIZE", // from cogdriver.cpp
    "COG_TMP_COMPRESSION", // from cogdriver.cpp
    "COMPRESS_GEOM", // from ogrsqlitelayer.cpp
    "COMPRESS_OVERVIEW", // from gt_overview.cpp
@@ -134,22 +135,34 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSI_MEM_MTIME", // from cpl_vsi_mem.cpp
    "CPL_VSIAZ_UNLINK_BATCH_SIZE", // from cpl_vsil_az.cpp
    "CPL_VSIGS_UNLINK_BATCH_SIZE", // from cpl_vsil_gs.cpp
+   "CPL_VSIL_CURL_ADAPTIVE_READAHEAD", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_FILENAME", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_AUTHORIZATION_HEADER_ALLOWED_IF_REDIRECT", // from cpl_http.cpp, cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CACHE_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CHUNK_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_COALESCE_CONCURRENT_REQUESTS", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_DISK_CACHE", // from cpl_vsil_curl_disk_cache.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_SIZE", // from cpl_vsil_curl_disk_cache.cpp
    "CPL_VSIL_CURL_HONOR_CACHE_CONTROL", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_STORAGE_CLASSES", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_MAX_INFLIGHT_BYTES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_MAX_RANGES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_NON_CACHED", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READAHEAD_MAX_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_SHARED_CACHE", // from cpl_vsil_curl_shared_cache.cpp
+   "CPL_VSIL_CURL_SHARED_CACHE_SIZE", // from cpl_vsil_curl_shared_cache.cpp
+   "CPL_VSIL_CURL_SHARED_CACHE_TTL", // from cpl_vsil_curl_shared_cache.cpp
    "CPL_VSIL_CURL_SLOW_GET_SIZE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_STREMAING_SIMULATED_CURL_ERROR", // from cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_USE_HEAD", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_USE_S3_REDIRECT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_DEFLATE_CHUNK_SIZE", // from cpl_minizip_zip.cpp, cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX_DIR", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX_SPAN", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_SAVE_INFO", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_WRITE_PROPERTIES", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_NETWORK_STATS_ENABLED", // from cpl_vsil_curl.cpp
@@ -237,6 +250,8 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_BAG_MAX_SIZE_VARRES_MAP", // from bagdataset.cpp
    "GDAL_BAND_BLOCK_CACHE", // from gdalrasterband.cpp
    "GDAL_CACHE_DIRECTORY", // from gdal_misc.cpp
+   "GDAL_CACHE_POLICY", // from gdalrasterblock.cpp
+   "GDAL_CACHE_SHARDS", // from gdalrasterblock.cpp
    "GDAL_CACHEMAX", // from gdalrasterblock.cpp, nearblack_bin.cpp
    "GDAL_CONFIG_FILE", // from cpl_conv.cpp
    "GDAL_CURL_CA_BUNDLE", // from cpl_http.cpp
@@ -251,6 +266,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_DAAS_SERVER_BYTE_LIMIT", // from daasdataset.cpp
    "GDAL_DAAS_X_FORWARDED_USER", // from daasdataset.cpp
    "GDAL_DATA", // from cpl_csv.cpp, cpl_findfile.cpp, gdaldrivermanager.cpp
+   "GDAL_DATASET_CACHEMAX", // from gdaldataset.cpp
    "GDAL_DEBUG_BLOCK_CACHE", // from gdalrasterblock.cpp
    "GDAL_DEBUG_PROCESS_DYNAMIC_METADATA", // from gdaljp2metadata.cpp
    "GDAL_DEFAULT_CREATE_COPY", // from gdaldriver.cpp
@@ -360,6 +376,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_OVR_CHUNK_MAX_SIZE", // from overview.cpp
    "GDAL_OVR_CHUNK_MAX_SIZE_FOR_TEMP_FILE", // from overview.cpp
    "GDAL_OVR_CHUNKYSIZE", // from overview.cpp
+   "GDAL_OVR_FUSED_PYRAMID", // from overview.cpp
    "GDAL_OVR_PROPAGATE_NODATA", // from overview.cpp
    "GDAL_OVR_TEMP_DRIVER", // from overview.cpp
    "GDAL_PAM_ENABLE_MARK_DIRTY", // from gdalpamdataset.cpp
@@ -424,7 +441,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_TIFF_INTERNAL_MASK_TO_8BIT", // from gtiffdataset.cpp, gtiffdataset_write.cpp
    "GDAL_TIFF_OVR_BLOCKSIZE", // from geotiff.cpp
    "GDAL_TRY_PDS3_WITH_VICAR", // from pdsdrivercore.cpp
-   "GDAL_USE_AVX", // from gdalgrid.cpp
+   "GDAL_USE_AVX", // from gdalgrid.cpp, overview.cpp
    "GDAL_USE_GEOJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_GMLJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_SSE", // from gdalgrid.cpp
@@ -542,7 +559,9 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GTIFF_IMPORT_FROM_EPSG", // from gt_wkt_srs.cpp
    "GTIFF_LINEAR_UNITS", // from gt_wkt_srs.cpp
    "GTIFF_MAX_CUMULATED_MEM_USAGE", // from tifvsi.cpp
+   "GTIFF_OUT_OF_ORDER_WRITES", // from gtiffdataset_write.cpp
    "GTIFF_POINT_GEO_IGNORE", // from gt_wkt_srs.cpp, gtiffdataset_read.cpp, gtiffdataset_write.cpp
+   "GTIFF_READ_AHEAD", // from gtiffdataset_read.cpp
    "GTIFF_READ_ANGULAR_PARAMS_IN_DEGREE", // from gt_wkt_srs.cpp
    "GTIFF_REPORT_COMPD_CS", // from gtiffdataset_read.cpp, gtiffdataset_write.cpp
    "GTIFF_SRS_SOURCE", // from gt_wkt_srs.cpp
@@ -714,6 +733,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_ARROW_READ_GDAL_FOOTER", // from ogrfeatherlayer.cpp
    "OGR_ARROW_REGISTER_GEOARROW_WKB_EXTENSION", // from ogrfeatherdriver.cpp
    "OGR_ARROW_USE_VSI", // from ogrfeatherdriver.cpp
+   "OGR_ARROW_VECTORIZED_FILTER", // from ogrlayerarrow.cpp
    "OGR_ARROW_WRITE_BBOX", // from ogrfeatherwriterlayer.cpp
    "OGR_ARROW_WRITE_GDAL_FOOTER", // from ogrfeatherwriterlayer.cpp
    "OGR_ARROW_WRITE_GDAL_GEOMETRY_TYPE", // from ogrfeatherwriterlayer.cpp
@@ -830,7 +850,10 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_SHAPE_PACK_IN_PLACE", // from ogrshapedatasource.cpp, ogrshapelayer.cpp
    "OGR_SHAPE_USE_VSIMEM_FOR_TEMP", // from ogrshapedatasource.cpp
    "OGR_SKIP", // from gdaldrivermanager.cpp
-   "OGR_SQL_LIKE_AS_ILIKE", // from ogrwfsfilter.cpp, swq_op_general.cpp
+   "OGR_SQL_HASH_JOIN", // from ogr_gensql.cpp
+   "OGR_SQL_HASH_JOIN_MAX_MEMORY", // from ogr_gensql.cpp
+   "OGR_SQL_LIKE_AS_ILIKE", // from ogrlayerarrow.cpp, ogrwfsfilter.cpp, swq_op_general.cpp
+   "OGR_SQL_ORDER_BY_MAX_MEMORY", // from ogr_gensql.cpp
    "OGR_SQL_STRICT", // from swq.cpp
    "OGR_SQLITE_ALLOW_EXTERNAL_ACCESS", // from ogrsqlitesqlfunctionscommon.cpp
    "OGR_SQLITE_CACHE", // from ogrgmldatasource.cpp, ogrsqlitedatasource.cpp
@@ -1015,6 +1038,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "SENTINEL2_USE_MAIN_MTD", // from sentinel2dataset.cpp
    "SHAPE_2GB_LIMIT", // from ogrshapedatasource.cpp
    "SHAPE_ENCODING", // from ogrshapelayer.cpp
+   "SHAPE_NUM_THREADS", // from ogrshapelayer.cpp
    "SHAPE_RESTORE_SHX", // from ogrshapedatasource.cpp
    "SHAPE_REWIND_ON_WRITE", // from ogrshapelayer.cpp
    "SPARSE_OK_OVERVIEW", // from gt_overview.cpp
@@ -13,6 +13,8 @@
 #include "cpl_port.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_vsil_curl_class.h"
+#include "cpl_vsil_curl_disk_cache.h"
+#include "cpl_vsil_curl_shared_cache.h"
 
 #include <algorithm>
 #include <array>
@@ -527,6 +529,29 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
 
     m_bCached = poFSIn->AllowCachedDataFor(pszFilename);
     poFS->GetCachedFileProp(m_pszURL, oFileProp);
+
+    m_bAdaptiveReadahead = CPLTestBool(
+        CPLGetConfigOption("CPL_VSIL_CURL_ADAPTIVE_READAHEAD", "NO"));
+    if (m_bAdaptiveReadahead)
+    {
+        constexpr GIntBig READAHEAD_MAX_SIZE_DEFAULT = 8 * 1024 * 1024;
+        GIntBig nMaxReadahead = READAHEAD_MAX_SIZE_DEFAULT;
+        const char *pszMaxReadahead =
+            CPLGetConfigOption("CPL_VSIL_CURL_READAHEAD_MAX_SIZE", nullptr);
+        if (pszMaxReadahead &&
+            CPLParseMemorySize(pszMaxReadahead, &nMaxReadahead, nullptr) !=
+                CE_None)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Could not parse value for "
+                     "CPL_VSIL_CURL_READAHEAD_MAX_SIZE. "
+                     "Using default value of " CPL_FRMT_GIB " instead.",
+                     READAHEAD_MAX_SIZE_DEFAULT);
+            nMaxReadahead = READAHEAD_MAX_SIZE_DEFAULT;
+        }
+        m_nMaxReadahead = static_cast<vsi_l_offset>(
+            std::clamp<GIntBig>(nMaxReadahead, 0, INT_MAX));
+    }
 }
 
 /************************************************************************/
@@ -543,6 +568,14 @@ VSICurlHandle::~VSICurlHandle()
     {
         VSICURLMultiCleanup(m_hCurlMultiHandleForAdviseRead);
     }
+    if (m_oThreadPrefetch.joinable())
+    {
+        m_oThreadPrefetch.join();
+    }
+    if (m_hCurlMultiHandleForPrefetch)
+    {
+        VSICURLMultiCleanup(m_hCurlMultiHandleForPrefetch);
+    }
 
     if (!m_bCached)
     {
@@ -1640,7 +1673,8 @@ retry:
                             std::min<size_t>(sWriteFuncData.nSize - nOffset,
                                              knDOWNLOAD_CHUNK_SIZE);
                         poFS->AddRegion(m_pszURL, nOffset, nToCache,
-                                        sWriteFuncData.pBuffer + nOffset);
+                                        sWriteFuncData.pBuffer + nOffset,
+                                        m_bCached);
                         nOffset += nToCache;
                     }
                 }
@@ -1900,6 +1934,91 @@ VSICurlHandle::GetRedirectURLIfValid(bool &bHasExpired,
     return osURL;
 }
 
+/************************************************************************/
+/*                         InflightBytesLimiter                         */
+/************************************************************************/
+
+namespace
+{
+class InflightBytesLimiter
+{
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCond{};
+    size_t m_nInflightBytes = 0;
+
+  public:
+    // Reserves nBytes, unless this would make the bytes in flight exceed
+    // nMaxBytes (0 meaning unlimited). In that case, waits for them to be
+    // released if bWait is set, or returns false. A reservation always
+    // succeeds when nothing is in flight.
+    bool Acquire(size_t nBytes, size_t nMaxBytes, bool bWait)
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        const auto CanAcquire = [this, nBytes, nMaxBytes]()
+        {
+            return nMaxBytes == 0 || m_nInflightBytes == 0 ||
+                   nBytes <= nMaxBytes - std::min(nMaxBytes, m_nInflightBytes);
+        };
+        if (!CanAcquire())
+        {
+            if (!bWait)
+                return false;
+            m_oCond.wait(oLock, CanAcquire);
+        }
+        m_nInflightBytes += nBytes;
+        return true;
+    }
+
+    void Release(size_t nBytes)
+    {
+        if (nBytes == 0)
+            return;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            m_nInflightBytes -= nBytes;
+        }
+        m_oCond.notify_all();
+    }
+};
+}  // namespace
+
+static InflightBytesLimiter &GetInflightBytesLimiter()
+{
+    static InflightBytesLimiter oLimiter;
+    return oLimiter;
+}
+
+/************************************************************************/
+/*                        GetMaxInflightBytes()                         */
+/************************************************************************/
+
+static size_t GetMaxInflightBytes()
+{
+    constexpr GIntBig MAX_INFLIGHT_BYTES_DEFAULT = 100 * 1024 * 1024;
+    GIntBig nMaxInflightBytes = MAX_INFLIGHT_BYTES_DEFAULT;
+    const char *pszMaxInflightBytes =
+        CPLGetConfigOption("CPL_VSIL_CURL_MAX_INFLIGHT_BYTES", nullptr);
+    if (pszMaxInflightBytes &&
+        CPLParseMemorySize(pszMaxInflightBytes, &nMaxInflightBytes, nullptr) !=
+            CE_None)
+    {
+        nMaxInflightBytes = MAX_INFLIGHT_BYTES_DEFAULT;
+    }
+    return static_cast<size_t>(std::min<GUIntBig>(
+        std::numeric_limits<size_t>::max(),
+        static_cast<GUIntBig>(std::max<GIntBig>(0, nMaxInflightBytes))));
+}
+
+/************************************************************************/
+/*                     CoalesceConcurrentRequests()                     */
+/************************************************************************/
+
+static bool CoalesceConcurrentRequests()
+{
+    return CPLTestBool(CPLGetConfigOption(
+        "CPL_VSIL_CURL_COALESCE_CONCURRENT_REQUESTS", "YES"));
+}
+
 /************************************************************************/
 /*                           CurrentDownload                            */
 /************************************************************************/
@@ -1914,9 +2033,11 @@ struct CurrentDownload
     int m_nBlocks = 0;
     std::string m_osAlreadyDownloadedData{};
     bool m_bHasAlreadyDownloadedData = false;
+    bool m_bFromCoveringRange = false;
+    std::shared_ptr<VSICurlFilesystemHandlerBase::RangeInDownload> m_poRange{};
 
     CurrentDownload(VSICurlFilesystemHandlerBase *poFS, const char *pszURL,
-                    vsi_l_offset startOffset, int nBlocks)
+                    vsi_l_offset startOffset, int nBlocks, size_t nSize)
         : m_poFS(poFS), m_osURL(pszURL), m_nStartOffset(startOffset),
           m_nBlocks(nBlocks)
     {
@@ -1924,6 +2045,28 @@ struct CurrentDownload
                                                      m_nBlocks);
         m_bHasAlreadyDownloadedData = res.first;
         m_osAlreadyDownloadedData = std::move(res.second);
+        if (m_bHasAlreadyDownloadedData || !CoalesceConcurrentRequests())
+            return;
+
+        // Check if the region is covered by a larger download in progress
+        // in another thread, typically a ReadMultiRange() one.
+        bool bCovered = false;
+        auto poRange = m_poFS->StartDownloadRange(m_osURL, m_nStartOffset,
+                                                  nSize, bCovered);
+        if (!bCovered)
+        {
+            m_poRange = std::move(poRange);
+            return;
+        }
+        std::string osData;
+        osData.resize(nSize);
+        if (VSICurlFilesystemHandlerBase::WaitForDownloadRange(
+                *poRange, m_nStartOffset, nSize, osData.data()))
+        {
+            m_bFromCoveringRange = true;
+            SetData(osData);
+            m_osAlreadyDownloadedData = std::move(osData);
+        }
     }
 
     bool HasAlreadyDownloadedData() const
@@ -1931,6 +2074,13 @@ struct CurrentDownload
         return m_bHasAlreadyDownloadedData;
     }
 
+    // Whether the data comes from a download of another thread that did
+    // not store it in the region cache.
+    bool IsFromCoveringRange() const
+    {
+        return m_bFromCoveringRange;
+    }
+
     const std::string &GetAlreadyDownloadedData() const
     {
         return m_osAlreadyDownloadedData;
@@ -1942,13 +2092,22 @@ struct CurrentDownload
         m_bHasAlreadyDownloadedData = true;
         m_poFS->NotifyStopDownloadRegion(m_osURL, m_nStartOffset, m_nBlocks,
                                          osData);
+        if (m_poRange)
+        {
+            m_poFS->StopDownloadRange(m_osURL, m_poRange, osData.data(),
+                                      osData.size());
+        }
     }
 
     ~CurrentDownload()
     {
         if (!m_bHasAlreadyDownloadedData)
+        {
             m_poFS->NotifyStopDownloadRegion(m_osURL, m_nStartOffset, m_nBlocks,
                                              std::string());
+            if (m_poRange)
+                m_poFS->StopDownloadRange(m_osURL, m_poRange, nullptr, 0);
+        }
     }
 
     CurrentDownload(const CurrentDownload &) = delete;
@@ -2044,6 +2203,112 @@ void VSICurlFilesystemHandlerBase::NotifyStopDownloadRegion(
     m_oMutex.unlock();
 }
 
+/************************************************************************/
+/*                         StartDownloadRange()                         */
+/************************************************************************/
+
+/** Indicate intent at downloading [nStartOffset, nStartOffset + nSize[ of
+ * osURL.
+ *
+ * If a download in progress in another thread covers that range, it is
+ * returned and bCovered is set: WaitForDownloadRange() must then be called on
+ * it. Otherwise, the range is registered as being downloaded, and
+ * StopDownloadRange() must be called on the returned object once done.
+ */
+std::shared_ptr<VSICurlFilesystemHandlerBase::RangeInDownload>
+VSICurlFilesystemHandlerBase::StartDownloadRange(const std::string &osURL,
+                                                 vsi_l_offset nStartOffset,
+                                                 size_t nSize, bool &bCovered)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    auto &apoRanges = m_oMapRangesInDownload[osURL];
+    for (const auto &poRange : apoRanges)
+    {
+        if (nStartOffset >= poRange->nStartOffset &&
+            nStartOffset + nSize <= poRange->nStartOffset + poRange->nSize)
+        {
+            std::lock_guard<std::mutex> oRangeLock(poRange->oMutex);
+            poRange->nWaiters++;
+            bCovered = true;
+            return poRange;
+        }
+    }
+
+    auto poRange = std::make_shared<RangeInDownload>();
+    poRange->nStartOffset = nStartOffset;
+    poRange->nSize = nSize;
+    apoRanges.push_back(poRange);
+    bCovered = false;
+    return poRange;
+}
+
+/************************************************************************/
+/*                         StopDownloadRange()                          */
+/************************************************************************/
+
+/** Indicate that the download of a range registered with
+ * StartDownloadRange() is finished, and wake up the threads waiting for it.
+ * pData is nullptr if the download failed.
+ */
+void VSICurlFilesystemHandlerBase::StopDownloadRange(
+    const std::string &osURL, const std::shared_ptr<RangeInDownload> &poRange,
+    const char *pData, size_t nSize)
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        auto oIter = m_oMapRangesInDownload.find(osURL);
+        if (oIter != m_oMapRangesInDownload.end())
+        {
+            auto &apoRanges = oIter->second;
+            apoRanges.erase(
+                std::remove(apoRanges.begin(), apoRanges.end(), poRange),
+                apoRanges.end());
+            if (apoRanges.empty())
+                m_oMapRangesInDownload.erase(oIter);
+        }
+    }
+
+    // No new waiter can show up now that the range is unregistered
+    std::lock_guard<std::mutex> oRangeLock(poRange->oMutex);
+    if (poRange->nWaiters > 0 && pData)
+        poRange->osData.assign(pData, nSize);
+    poRange->bDone = true;
+    poRange->oCond.notify_all();
+}
+
+/************************************************************************/
+/*                        WaitForDownloadRange()                        */
+/************************************************************************/
+
+/** Wait for the download of a range returned by StartDownloadRange() with
+ * bCovered set, and copy [nStartOffset, nStartOffset + nSize[ into pBuffer.
+ * Returns false if the download failed.
+ */
+bool VSICurlFilesystemHandlerBase::WaitForDownloadRange(
+    RangeInDownload &oRange, vsi_l_offset nStartOffset, size_t nSize,
+    void *pBuffer)
+{
+    std::unique_lock<std::mutex> oLock(oRange.oMutex);
+    while (!oRange.bDone)
+    {
+        oRange.oCond.wait(oLock);
+    }
+    oRange.nWaiters--;
+    if (nStartOffset < oRange.nStartOffset ||
+        nStartOffset + nSize > oRange.nStartOffset + oRange.osData.size())
+    {
+        return false;
+    }
+    if (nSize > 0)
+    {
+        memcpy(pBuffer,
+               oRange.osData.data() +
+                   static_cast<size_t>(nStartOffset - oRange.nStartOffset),
+               nSize);
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                           DownloadRegion()                           */
 /************************************************************************/
@@ -2059,10 +2324,26 @@ std::string VSICurlHandle::DownloadRegion(const vsi_l_offset startOffset,
 
     // Check if there is not a download of the same region in progress in
     // another thread, and if so wait for it to be completed
-    CurrentDownload currentDownload(poFS, m_pszURL, startOffset, nBlocks);
+    vsi_l_offset nRegionSize =
+        static_cast<vsi_l_offset>(nBlocks) * VSICURLGetDownloadChunkSize();
+    if (oFileProp.bHasComputedFileSize)
+    {
+        nRegionSize = std::min(nRegionSize,
+                               oFileProp.fileSize > startOffset
+                                   ? oFileProp.fileSize - startOffset
+                                   : 0);
+    }
+    CurrentDownload currentDownload(poFS, m_pszURL, startOffset, nBlocks,
+                                    static_cast<size_t>(nRegionSize));
     if (currentDownload.HasAlreadyDownloadedData())
     {
-        return currentDownload.GetAlreadyDownloadedData();
+        const std::string &osData = currentDownload.GetAlreadyDownloadedData();
+        if (currentDownload.IsFromCoveringRange())
+        {
+            DownloadRegionPostProcess(startOffset, nBlocks, osData.data(),
+                                      osData.size());
+        }
+        return osData;
     }
 
 begin:
@@ -2467,13 +2748,291 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
 #endif
         const size_t nChunkSize =
             std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
-        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer);
+        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer,
+                        m_bCached);
         l_startOffset += nChunkSize;
         pBuffer += nChunkSize;
         nSize -= nChunkSize;
     }
 }
 
+/************************************************************************/
+/*                        UpdateAccessPattern()                         */
+/************************************************************************/
+
+// Matches a read with the tracked streams, and once a stream has been
+// confirmed by a few reads, prefetches asynchronously the data it is
+// predicted to read next.
+
+void VSICurlHandle::UpdateAccessPattern(vsi_l_offset nOffset, size_t nSize)
+{
+    const vsi_l_offset nChunkSize = VSICURLGetDownloadChunkSize();
+    const vsi_l_offset nEnd = nOffset + nSize;
+    ++m_nReadCounter;
+
+    ReadStream *psStream = nullptr;
+    vsi_l_offset nCandidateStride = 0;
+    for (auto &sStream : m_asReadStreams)
+    {
+        if (sStream.nLastUse == 0)
+            continue;
+        if (nOffset > sStream.nLastOffset && nEnd > sStream.nLastEnd &&
+            nOffset <= sStream.nLastEnd + nChunkSize)
+        {
+            // (Nearly) contiguous with the previous read of the stream
+            if (sStream.nStride != 0)
+            {
+                sStream.nStride = 0;
+                sStream.nConfidence = 0;
+            }
+            psStream = &sStream;
+            break;
+        }
+        if (sStream.nStride != 0 &&
+            nOffset == sStream.nLastOffset + sStream.nStride)
+        {
+            psStream = &sStream;
+            break;
+        }
+        if (nOffset > sStream.nLastEnd &&
+            nOffset - sStream.nLastOffset <= m_nMaxReadahead &&
+            (nCandidateStride == 0 ||
+             nOffset - sStream.nLastOffset < nCandidateStride))
+        {
+            nCandidateStride = nOffset - sStream.nLastOffset;
+        }
+    }
+
+    if (psStream == nullptr)
+    {
+        // Start a new stream in place of the least recently used one. If
+        // the read closely follows another stream, the distance to it is
+        // a stride to be confirmed by the next read.
+        psStream = &*std::min_element(
+            m_asReadStreams.begin(), m_asReadStreams.end(),
+            [](const ReadStream &a, const ReadStream &b)
+            { return a.nLastUse < b.nLastUse; });
+        *psStream = ReadStream();
+        psStream->nStride = nCandidateStride;
+        psStream->nPrefetchedUpTo = nEnd;
+    }
+    else
+    {
+        ++psStream->nConfidence;
+    }
+    psStream->nLastOffset = nOffset;
+    psStream->nLastEnd = nEnd;
+    psStream->nLastUse = m_nReadCounter;
+
+    constexpr int MIN_CONFIDENCE = 2;
+    if (psStream->nConfidence < MIN_CONFIDENCE || m_nMaxReadahead == 0 ||
+        m_bPrefetchRunning || !oFileProp.bHasComputedFileSize)
+    {
+        return;
+    }
+
+    std::vector<std::pair<vsi_l_offset, size_t>> aoRanges;
+    vsi_l_offset nPrefetchedUpTo = psStream->nPrefetchedUpTo;
+    if (psStream->nStride == 0)
+    {
+        // The readahead window doubles with each confirming read. It is
+        // only refilled once half of it has been consumed, to avoid
+        // issuing small requests.
+        const vsi_l_offset nWindow =
+            std::min(m_nMaxReadahead,
+                     nChunkSize << std::min(psStream->nConfidence, 20));
+        const vsi_l_offset nStart =
+            std::max(nPrefetchedUpTo,
+                     cpl::div_round_up(nEnd, nChunkSize) * nChunkSize);
+        const vsi_l_offset nTarget =
+            cpl::div_round_up(nEnd + nWindow, nChunkSize) * nChunkSize;
+        if (nTarget > nStart && nTarget - nStart >= nWindow / 2)
+        {
+            aoRanges.emplace_back(nStart,
+                                  static_cast<size_t>(nTarget - nStart));
+            nPrefetchedUpTo = nTarget;
+        }
+    }
+    else
+    {
+        // Predict the next reads of the stream within the readahead
+        // window, and only issue them once there are enough of them.
+        constexpr int MAX_PREDICTED_READS = 8;
+        const int nPredictedReads =
+            std::min(psStream->nConfidence, MAX_PREDICTED_READS);
+        for (int i = 1; i <= nPredictedReads; ++i)
+        {
+            const vsi_l_offset nDistance = i * psStream->nStride;
+            if (nDistance > m_nMaxReadahead)
+                break;
+            const vsi_l_offset nPredicted = nOffset + nDistance;
+            if (nPredicted < nPrefetchedUpTo)
+                continue;
+            const vsi_l_offset nStart = (nPredicted / nChunkSize) * nChunkSize;
+            const vsi_l_offset nRangeEnd =
+                cpl::div_round_up(nPredicted + nSize, nChunkSize) * nChunkSize;
+            aoRanges.emplace_back(nStart,
+                                  static_cast<size_t>(nRangeEnd - nStart));
+            nPrefetchedUpTo = nPredicted + nSize;
+        }
+        if (static_cast<int>(aoRanges.size()) <
+            std::max(1, nPredictedReads / 2))
+        {
+            aoRanges.clear();
+        }
+    }
+
+    // Do not read after end of file
+    for (size_t i = 0; i < aoRanges.size(); ++i)
+    {
+        auto &oRange = aoRanges[i];
+        if (oRange.first >= oFileProp.fileSize)
+        {
+            aoRanges.resize(i);
+            break;
+        }
+        if (oRange.second > oFileProp.fileSize - oRange.first)
+            oRange.second =
+                static_cast<size_t>(oFileProp.fileSize - oRange.first);
+    }
+
+    if (!aoRanges.empty())
+    {
+        psStream->nPrefetchedUpTo = nPrefetchedUpTo;
+        Prefetch(aoRanges);
+    }
+}
+
+/************************************************************************/
+/*                              Prefetch()                              */
+/************************************************************************/
+
+void VSICurlHandle::Prefetch(
+    const std::vector<std::pair<vsi_l_offset, size_t>> &aoRanges)
+{
+    if (m_oThreadPrefetch.joinable())
+    {
+        m_oThreadPrefetch.join();
+    }
+    m_aoPrefetchRanges.clear();
+
+    // Do not prefetch more than what the region cache can hold without
+    // evicting the data that is going to be read.
+    const int knMAX_REGIONS = GetMaxRegions();
+    const int nMaxChunks = std::max(1, knMAX_REGIONS / 4);
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    if (m_oSetPrefetchedChunks.size() > static_cast<size_t>(knMAX_REGIONS))
+        m_oSetPrefetchedChunks.clear();
+
+    // Skip chunks that are already cached
+    int nChunks = 0;
+    for (const auto &[nOffset, nSize] : aoRanges)
+    {
+        for (vsi_l_offset nChunkOffset = nOffset;
+             nChunkOffset < nOffset + nSize && nChunks < nMaxChunks;
+             nChunkOffset += knDOWNLOAD_CHUNK_SIZE)
+        {
+            if (poFS->GetRegion(m_pszURL, nChunkOffset) != nullptr)
+                continue;
+            const size_t nChunkSize = static_cast<size_t>(
+                std::min<vsi_l_offset>(knDOWNLOAD_CHUNK_SIZE,
+                                       nOffset + nSize - nChunkOffset));
+            if (!m_aoPrefetchRanges.empty() &&
+                m_aoPrefetchRanges.back()->nStartOffset +
+                        m_aoPrefetchRanges.back()->nSize ==
+                    nChunkOffset)
+            {
+                m_aoPrefetchRanges.back()->nSize += nChunkSize;
+            }
+            else
+            {
+                auto poRange =
+                    std::make_unique<AdviseReadRange>(m_oRetryParameters);
+                poRange->nStartOffset = nChunkOffset;
+                poRange->nSize = nChunkSize;
+                m_aoPrefetchRanges.push_back(std::move(poRange));
+            }
+            m_oSetPrefetchedChunks.insert(nChunkOffset);
+            ++nChunks;
+        }
+    }
+    if (m_aoPrefetchRanges.empty())
+        return;
+
+    UpdateQueryString();
+
+    bool bHasExpired = false;
+    CPLStringList aosHTTPOptions(m_aosHTTPOptions);
+    const std::string l_osURL(
+        GetRedirectURLIfValid(bHasExpired, aosHTTPOptions));
+    if (bHasExpired)
+    {
+        m_aoPrefetchRanges.clear();
+        return;
+    }
+
+#ifdef DEBUG
+    CPLDebug(poFS->GetDebugKey(), "Prefetching %u ranges",
+             static_cast<unsigned>(m_aoPrefetchRanges.size()));
+#endif
+
+    m_bPrefetchRunning = true;
+    m_oThreadPrefetch = std::thread(
+        [this, aosHTTPOptions = std::move(aosHTTPOptions)](
+            const std::string &osURL)
+        {
+            DownloadRangesInParallel(m_aoPrefetchRanges,
+                                     m_hCurlMultiHandleForPrefetch, osURL,
+                                     aosHTTPOptions, "Prefetch", true);
+            m_bPrefetchRunning = false;
+        },
+        l_osURL);
+}
+
+/************************************************************************/
+/*                         IsBeingPrefetched()                          */
+/************************************************************************/
+
+bool VSICurlHandle::IsBeingPrefetched(vsi_l_offset nOffset)
+{
+    for (auto &poRange : m_aoPrefetchRanges)
+    {
+        if (nOffset >= poRange->nStartOffset &&
+            nOffset < poRange->nStartOffset + poRange->nSize)
+        {
+            std::lock_guard<std::mutex> oLock(poRange->oMutex);
+            return !poRange->bDone;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                          WaitForPrefetch()                           */
+/************************************************************************/
+
+// Waits for the prefetch request of the chunk at nOffset, if there is one.
+// Returns whether there was one.
+
+bool VSICurlHandle::WaitForPrefetch(vsi_l_offset nOffset)
+{
+    for (auto &poRange : m_aoPrefetchRanges)
+    {
+        if (nOffset >= poRange->nStartOffset &&
+            nOffset < poRange->nStartOffset + poRange->nSize)
+        {
+            std::unique_lock<std::mutex> oLock(poRange->oMutex);
+            // coverity[missing_lock:FALSE]
+            while (!poRange->bDone)
+            {
+                poRange->oCV.wait(oLock);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                                Read()                                */
 /************************************************************************/
@@ -2495,6 +3054,9 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
              static_cast<int>(curOffset), static_cast<int>(nBufferRequestSize));
 #endif
 
+    if (m_bAdaptiveReadahead)
+        UpdateAccessPattern(curOffset, nBufferRequestSize);
+
     vsi_l_offset iterOffset = curOffset;
     const int knMAX_REGIONS = GetMaxRegions();
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
@@ -2519,8 +3081,15 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
             poFS->GetRegion(m_pszURL, nOffsetToDownload);
+        if (psRegion == nullptr && WaitForPrefetch(nOffsetToDownload))
+            psRegion = poFS->GetRegion(m_pszURL, nOffsetToDownload);
         if (psRegion != nullptr)
         {
+            if (!m_oSetPrefetchedChunks.empty() &&
+                m_oSetPrefetchedChunks.erase(nOffsetToDownload) > 0)
+            {
+                NetworkStatisticsLogger::LogPrefetchHit(psRegion->size());
+            }
             osRegion = *psRegion;
         }
         else
@@ -2553,15 +3122,16 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
             if (nBlocksToDownload < nMinBlocksToDownload)
                 nBlocksToDownload = nMinBlocksToDownload;
 
-            // Avoid reading already cached data.
+            // Avoid reading already cached (or being prefetched) data.
             // Note: this might get evicted if concurrent reads are done, but
             // this should not cause bugs. Just missed optimization.
             for (int i = 1; i < nBlocksToDownload; i++)
             {
-                if (poFS->GetRegion(m_pszURL, nOffsetToDownload +
-                                                  static_cast<vsi_l_offset>(i) *
-                                                      knDOWNLOAD_CHUNK_SIZE) !=
-                    nullptr)
+                const vsi_l_offset nChunkOffset =
+                    nOffsetToDownload +
+                    static_cast<vsi_l_offset>(i) * knDOWNLOAD_CHUNK_SIZE;
+                if (poFS->GetRegion(m_pszURL, nChunkOffset) != nullptr ||
+                    IsBeingPrefetched(nChunkOffset))
                 {
                     nBlocksToDownload = i;
                     break;
@@ -2715,6 +3285,11 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         size_t nSize;
         CPLHTTPRetryContext retryContext;
         bool bToRetry = true;  // true initially to trigger first attempt
+        // Download in progress of this request, or of another thread that
+        // covers it if bCovered is set.
+        std::shared_ptr<VSICurlFilesystemHandlerBase::RangeInDownload>
+            poRange{};
+        bool bCovered = false;
 
         MergedRequest(int first, int last, vsi_l_offset start, size_t size,
                       const CPLHTTPRetryParameters &params)
@@ -2753,8 +3328,54 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     if (asMergedRequests.empty())
         return 0;
 
+    // Requests covered by downloads in progress in other threads (of
+    // ReadMultiRange() or Read()) are not issued, but wait for their result.
+    if (CoalesceConcurrentRequests())
+    {
+        for (auto &oReq : asMergedRequests)
+        {
+            oReq.poRange = poFS->StartDownloadRange(
+                m_pszURL, oReq.nStartOffset, oReq.nSize, oReq.bCovered);
+            if (oReq.bCovered)
+                oReq.bToRetry = false;
+        }
+    }
+
+    // Wake up the threads waiting for the result of a request
+    const auto NotifyRequestDone =
+        [this](MergedRequest &oReq, const char *pData, size_t nDataSize)
+    {
+        if (oReq.poRange)
+        {
+            poFS->StopDownloadRange(m_pszURL, oReq.poRange, pData, nDataSize);
+            oReq.poRange.reset();
+        }
+    };
+
+    const auto CopyToRanges =
+        [&anSortedSizes, &apSortedData](const MergedRequest &oReq,
+                                        const char *pData, size_t nDataSize)
+    {
+        size_t nOffset = 0;
+        for (int iRange = oReq.iFirstRange; iRange <= oReq.iLastRange;
+             iRange++)
+        {
+            if (nDataSize - nOffset < anSortedSizes[iRange])
+                return false;
+            if (anSortedSizes[iRange] > 0)
+            {
+                memcpy(apSortedData[iRange], pData + nOffset,
+                       anSortedSizes[iRange]);
+            }
+            nOffset += anSortedSizes[iRange];
+        }
+        return true;
+    };
+
     int nRet = 0;
     size_t nTotalDownloaded = 0;
+    const size_t nMaxInflightBytes = GetMaxInflightBytes();
+    auto &oInflightBytesLimiter = GetInflightBytesLimiter();
 
     // Retry loop: re-issue only failed requests that are retryable
     while (true)
@@ -2768,10 +3389,23 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         std::vector<CurlErrBuffer> asCurlErrors(nRequests);
 
         bool bAnyHandle = false;
+        bool bDeferred = false;
+        size_t nReservedBytes = 0;
         for (size_t iReq = 0; iReq < nRequests; iReq++)
         {
             if (!asMergedRequests[iReq].bToRetry)
                 continue;
+
+            // Cap the number of bytes in flight among all threads. The
+            // first request of a batch waits for room if needed, the other
+            // ones are deferred to the next batch.
+            if (!oInflightBytesLimiter.Acquire(asMergedRequests[iReq].nSize,
+                                               nMaxInflightBytes, !bAnyHandle))
+            {
+                bDeferred = true;
+                continue;
+            }
+            nReservedBytes += asMergedRequests[iReq].nSize;
             asMergedRequests[iReq].bToRetry = false;
 
             CURL *hCurlHandle = curl_easy_init();
@@ -2843,6 +3477,7 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         {
             VSICURLMultiPerform(hMultiHandle);
         }
+        oInflightBytesLimiter.Release(nReservedBytes);
 
         // Process results
         bool bRetry = false;
@@ -2907,31 +3542,21 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                              "Request for %s failed with response_code=%ld",
                              rangeStr, response_code);
                     nRet = -1;
+                    NotifyRequestDone(asMergedRequests[iReq], nullptr, 0);
                 }
             }
-            else if (nRet == 0)
+            else
             {
-                size_t nOffset = 0;
-                size_t nRemainingSize = asWriteFuncData[iReq].nSize;
-                nTotalDownloaded += nRemainingSize;
-                for (int iRange = asMergedRequests[iReq].iFirstRange;
-                     iRange <= asMergedRequests[iReq].iLastRange; iRange++)
+                nTotalDownloaded += asWriteFuncData[iReq].nSize;
+                if (nRet == 0 && !CopyToRanges(asMergedRequests[iReq],
+                                               asWriteFuncData[iReq].pBuffer,
+                                               asWriteFuncData[iReq].nSize))
                 {
-                    if (nRemainingSize < anSortedSizes[iRange])
-                    {
-                        nRet = -1;
-                        break;
-                    }
-
-                    if (anSortedSizes[iRange] > 0)
-                    {
-                        memcpy(apSortedData[iRange],
-                               asWriteFuncData[iReq].pBuffer + nOffset,
-                               anSortedSizes[iRange]);
-                    }
-                    nOffset += anSortedSizes[iRange];
-                    nRemainingSize -= anSortedSizes[iRange];
+                    nRet = -1;
                 }
+                NotifyRequestDone(asMergedRequests[iReq],
+                                  asWriteFuncData[iReq].pBuffer,
+                                  asWriteFuncData[iReq].nSize);
             }
 
             curl_multi_remove_handle(hMultiHandle, aHandles[iReq]);
@@ -2944,9 +3569,42 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                 curl_slist_free_all(aHeaders[iReq]);
         }
 
-        if (!bRetry || nRet != 0)
+        if ((!bRetry && !bDeferred) || nRet != 0)
             break;
-        CPLSleep(dfMaxDelay);
+        if (bRetry)
+            CPLSleep(dfMaxDelay);
+    }
+
+    for (auto &oReq : asMergedRequests)
+    {
+        if (oReq.bCovered)
+        {
+            // Get the result of the download of the other thread, or
+            // fallback to reading the data ourselves.
+            if (nRet != 0)
+                continue;
+            std::string osData;
+            osData.resize(oReq.nSize);
+            if (VSICurlFilesystemHandlerBase::WaitForDownloadRange(
+                    *oReq.poRange, oReq.nStartOffset, oReq.nSize,
+                    osData.data()))
+            {
+                CopyToRanges(oReq, osData.data(), osData.size());
+            }
+            else if (VSIVirtualHandle::ReadMultiRange(
+                         oReq.iLastRange - oReq.iFirstRange + 1,
+                         &apSortedData[oReq.iFirstRange],
+                         &anSortedOffsets[oReq.iFirstRange],
+                         &anSortedSizes[oReq.iFirstRange]) != 0)
+            {
+                nRet = -1;
+            }
+        }
+        else
+        {
+            // Not completed because of the failure of another request
+            NotifyRequestDone(oReq, nullptr, 0);
+        }
     }
 
     NetworkStatisticsLogger::LogGET(nTotalDownloaded);
@@ -3651,299 +4309,333 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
              static_cast<unsigned>(m_aoAdviseReadRanges.size()));
 #endif
 
-    const auto task = [this, aosHTTPOptions = std::move(aosHTTPOptions)](
-                          const std::string &osURL)
-    {
-        if (!m_hCurlMultiHandleForAdviseRead)
-            m_hCurlMultiHandleForAdviseRead = VSICURLMultiInit();
+    m_oThreadAdviseRead = std::thread(
+        [this, aosHTTPOptions = std::move(aosHTTPOptions)](
+            const std::string &osURL)
+        {
+            DownloadRangesInParallel(m_aoAdviseReadRanges,
+                                     m_hCurlMultiHandleForAdviseRead, osURL,
+                                     aosHTTPOptions, "AdviseRead", false);
+        },
+        l_osURL);
+}
+
+/************************************************************************/
+/*                      DownloadRangesInParallel()                      */
+/************************************************************************/
+
+// Downloads aoRanges with parallel requests of hCurlMultiHandle, signaling
+// each range as soon as it is done. When bAddToRegionCache is set, the data
+// is stored in the region cache instead of in the ranges.
+
+void VSICurlHandle::DownloadRangesInParallel(
+    std::vector<std::unique_ptr<AdviseReadRange>> &aoRanges,
+    CURLM *&hCurlMultiHandle, const std::string &osURL,
+    const CPLStringList &aosHTTPOptions, const char *pszAction,
+    bool bAddToRegionCache)
+{
+    if (!hCurlMultiHandle)
+        hCurlMultiHandle = VSICURLMultiInit();
 
-        NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
-        NetworkStatisticsFile oContextFile(m_osFilename.c_str());
-        NetworkStatisticsAction oContextAction("AdviseRead");
+    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+    NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+    NetworkStatisticsAction oContextAction(pszAction);
 
 #ifdef CURLPIPE_MULTIPLEX
-        // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
-        // used)
-        // Not that this does not enable HTTP/1.1 pipeling, which is not
-        // recommended for example by Google Cloud Storage.
-        // For HTTP/1.1, parallel connections work better since you can get
-        // results out of order.
-        if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
-        {
-            curl_multi_setopt(m_hCurlMultiHandleForAdviseRead,
-                              CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
-        }
+    // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
+    // used)
+    // Not that this does not enable HTTP/1.1 pipeling, which is not
+    // recommended for example by Google Cloud Storage.
+    // For HTTP/1.1, parallel connections work better since you can get
+    // results out of order.
+    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+    {
+        curl_multi_setopt(hCurlMultiHandle, CURLMOPT_PIPELINING,
+                          CURLPIPE_MULTIPLEX);
+    }
 #endif
 
-        size_t nTotalDownloaded = 0;
+    size_t nTotalDownloaded = 0;
+
+    while (true)
+    {
 
-        while (true)
+        std::vector<CURL *> aHandles;
+        std::vector<WriteFuncStruct> asWriteFuncData(aoRanges.size());
+        std::vector<WriteFuncStruct> asWriteFuncHeaderData(aoRanges.size());
+        std::vector<char *> apszRanges;
+        std::vector<struct curl_slist *> aHeaders;
+
+        struct CurlErrBuffer
+        {
+            std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
+        };
+        std::vector<CurlErrBuffer> asCurlErrors(aoRanges.size());
+
+        std::map<CURL *, size_t> oMapHandleToIdx;
+        for (size_t i = 0; i < aoRanges.size(); ++i)
         {
+            if (!aoRanges[i]->bToRetry)
+            {
+                aHandles.push_back(nullptr);
+                apszRanges.push_back(nullptr);
+                aHeaders.push_back(nullptr);
+                continue;
+            }
+            aoRanges[i]->bToRetry = false;
+
+            CURL *hCurlHandle = curl_easy_init();
+            oMapHandleToIdx[hCurlHandle] = i;
+            aHandles.push_back(hCurlHandle);
+
+            // As the multi-range request is likely not the first one, we don't
+            // need to wait as we already know if pipelining is possible
+            // unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_PIPEWAIT, 1);
+
+            struct curl_slist *headers = VSICurlSetOptions(
+                hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
+
+            // Prefetched data is not requested by the user, so the read
+            // callback is not invoked for it.
+            VSICURLInitWriteFuncStruct(
+                &asWriteFuncData[i], this,
+                bAddToRegionCache ? nullptr : pfnReadCbk,
+                bAddToRegionCache ? nullptr : pReadCbkUserData);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
+                                       &asWriteFuncData[i]);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
+                                       VSICurlHandleWriteFunc);
+
+            VSICURLInitWriteFuncStruct(&asWriteFuncHeaderData[i], nullptr,
+                                       nullptr, nullptr);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
+                                       &asWriteFuncHeaderData[i]);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
+                                       VSICurlHandleWriteFunc);
+            asWriteFuncHeaderData[i].bIsHTTP = STARTS_WITH(m_pszURL, "http");
+            asWriteFuncHeaderData[i].nStartOffset = aoRanges[i]->nStartOffset;
+
+            asWriteFuncHeaderData[i].nEndOffset =
+                aoRanges[i]->nStartOffset + aoRanges[i]->nSize - 1;
+
+            char rangeStr[512] = {};
+            snprintf(rangeStr, sizeof(rangeStr),
+                     CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                     asWriteFuncHeaderData[i].nStartOffset,
+                     asWriteFuncHeaderData[i].nEndOffset);
 
-            std::vector<CURL *> aHandles;
-            std::vector<WriteFuncStruct> asWriteFuncData(
-                m_aoAdviseReadRanges.size());
-            std::vector<WriteFuncStruct> asWriteFuncHeaderData(
-                m_aoAdviseReadRanges.size());
-            std::vector<char *> apszRanges;
-            std::vector<struct curl_slist *> aHeaders;
+            if constexpr (ENABLE_DEBUG)
+            {
+                CPLDebug(poFS->GetDebugKey(), "Downloading %s (%s)...",
+                         rangeStr, osURL.c_str());
+            }
 
-            struct CurlErrBuffer
+            if (asWriteFuncHeaderData[i].bIsHTTP)
             {
-                std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
-            };
-            std::vector<CurlErrBuffer> asCurlErrors(
-                m_aoAdviseReadRanges.size());
+                std::string osHeaderRange(
+                    CPLSPrintf("Range: bytes=%s", rangeStr));
+                // So it gets included in Azure signature
+                char *pszRange = CPLStrdup(osHeaderRange.c_str());
+                apszRanges.push_back(pszRange);
+                headers = curl_slist_append(headers, pszRange);
+                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE,
+                                           nullptr);
+            }
+            else
+            {
+                apszRanges.push_back(nullptr);
+                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE,
+                                           rangeStr);
+            }
+
+            asCurlErrors[i].szCurlErrBuf[0] = '\0';
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
+                                       &asCurlErrors[i].szCurlErrBuf[0]);
+
+            headers = GetCurlHeaders("GET", headers);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER,
+                                       headers);
+            aHeaders.push_back(headers);
+            curl_multi_add_handle(hCurlMultiHandle, hCurlHandle);
+        }
+
+        const auto DealWithRequest =
+            [this, &aoRanges, bAddToRegionCache, &osURL, &nTotalDownloaded,
+             &oMapHandleToIdx, &asCurlErrors, &asWriteFuncHeaderData,
+             &asWriteFuncData](CURL *hCurlHandle)
+        {
+            auto oIter = oMapHandleToIdx.find(hCurlHandle);
+            CPLAssert(oIter != oMapHandleToIdx.end());
+            const auto iReq = oIter->second;
+
+            long response_code = 0;
+            curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
 
-            std::map<CURL *, size_t> oMapHandleToIdx;
-            for (size_t i = 0; i < m_aoAdviseReadRanges.size(); ++i)
+            if (ENABLE_DEBUG && asCurlErrors[iReq].szCurlErrBuf[0] != '\0')
             {
-                if (!m_aoAdviseReadRanges[i]->bToRetry)
-                {
-                    aHandles.push_back(nullptr);
-                    apszRanges.push_back(nullptr);
-                    aHeaders.push_back(nullptr);
-                    continue;
-                }
-                m_aoAdviseReadRanges[i]->bToRetry = false;
-
-                CURL *hCurlHandle = curl_easy_init();
-                oMapHandleToIdx[hCurlHandle] = i;
-                aHandles.push_back(hCurlHandle);
-
-                // As the multi-range request is likely not the first one, we don't
-                // need to wait as we already know if pipelining is possible
-                // unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_PIPEWAIT, 1);
-
-                struct curl_slist *headers = VSICurlSetOptions(
-                    hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
-
-                VSICURLInitWriteFuncStruct(&asWriteFuncData[i], this,
-                                           pfnReadCbk, pReadCbkUserData);
-                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
-                                           &asWriteFuncData[i]);
-                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
-                                           VSICurlHandleWriteFunc);
-
-                VSICURLInitWriteFuncStruct(&asWriteFuncHeaderData[i], nullptr,
-                                           nullptr, nullptr);
-                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
-                                           &asWriteFuncHeaderData[i]);
-                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
-                                           VSICurlHandleWriteFunc);
-                asWriteFuncHeaderData[i].bIsHTTP =
-                    STARTS_WITH(m_pszURL, "http");
-                asWriteFuncHeaderData[i].nStartOffset =
-                    m_aoAdviseReadRanges[i]->nStartOffset;
-
-                asWriteFuncHeaderData[i].nEndOffset =
-                    m_aoAdviseReadRanges[i]->nStartOffset +
-                    m_aoAdviseReadRanges[i]->nSize - 1;
+                char rangeStr[512] = {};
+                snprintf(rangeStr, sizeof(rangeStr),
+                         CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                         asWriteFuncHeaderData[iReq].nStartOffset,
+                         asWriteFuncHeaderData[iReq].nEndOffset);
+
+                const char *pszErrorMsg = &asCurlErrors[iReq].szCurlErrBuf[0];
+                CPLDebug(poFS->GetDebugKey(),
+                         "ReadMultiRange(%s), %s: response_code=%d, msg=%s",
+                         osURL.c_str(), rangeStr,
+                         static_cast<int>(response_code), pszErrorMsg);
+            }
 
+            bool bToRetry = false;
+            if ((response_code != 206 && response_code != 225) ||
+                asWriteFuncHeaderData[iReq].nEndOffset + 1 !=
+                    asWriteFuncHeaderData[iReq].nStartOffset +
+                        asWriteFuncData[iReq].nSize)
+            {
                 char rangeStr[512] = {};
                 snprintf(rangeStr, sizeof(rangeStr),
                          CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
-                         asWriteFuncHeaderData[i].nStartOffset,
-                         asWriteFuncHeaderData[i].nEndOffset);
+                         asWriteFuncHeaderData[iReq].nStartOffset,
+                         asWriteFuncHeaderData[iReq].nEndOffset);
 
-                if constexpr (ENABLE_DEBUG)
+                // Look if we should attempt a retry
+                if (aoRanges[iReq]->retryContext.CanRetry(
+                        static_cast<int>(response_code),
+                        asWriteFuncData[iReq].pBuffer,
+                        &asCurlErrors[iReq].szCurlErrBuf[0]))
                 {
-                    CPLDebug(poFS->GetDebugKey(), "Downloading %s (%s)...",
-                             rangeStr, osURL.c_str());
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "HTTP error code for %s range %s: %d. "
+                             "Retrying again in %.1f secs",
+                             osURL.c_str(), rangeStr,
+                             static_cast<int>(response_code),
+                             aoRanges[iReq]->retryContext.GetCurrentDelay());
+                    aoRanges[iReq]->dfSleepDelay =
+                        aoRanges[iReq]->retryContext.GetCurrentDelay();
+                    bToRetry = true;
                 }
-
-                if (asWriteFuncHeaderData[i].bIsHTTP)
+                else if (bAddToRegionCache)
                 {
-                    std::string osHeaderRange(
-                        CPLSPrintf("Range: bytes=%s", rangeStr));
-                    // So it gets included in Azure signature
-                    char *pszRange = CPLStrdup(osHeaderRange.c_str());
-                    apszRanges.push_back(pszRange);
-                    headers = curl_slist_append(headers, pszRange);
-                    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE,
-                                               nullptr);
+                    // Prefetching is speculative: the data is requested
+                    // again if it is actually read.
+                    CPLDebug(poFS->GetDebugKey(),
+                             "Prefetch of %s range %s failed with "
+                             "response_code=%ld",
+                             osURL.c_str(), rangeStr, response_code);
                 }
                 else
                 {
-                    apszRanges.push_back(nullptr);
-                    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE,
-                                               rangeStr);
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Request for %s range %s failed with "
+                             "response_code=%ld",
+                             osURL.c_str(), rangeStr, response_code);
                 }
-
-                asCurlErrors[i].szCurlErrBuf[0] = '\0';
-                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
-                                           &asCurlErrors[i].szCurlErrBuf[0]);
-
-                headers = GetCurlHeaders("GET", headers);
-                unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER,
-                                           headers);
-                aHeaders.push_back(headers);
-                curl_multi_add_handle(m_hCurlMultiHandleForAdviseRead,
-                                      hCurlHandle);
             }
-
-            const auto DealWithRequest = [this, &osURL, &nTotalDownloaded,
-                                          &oMapHandleToIdx, &asCurlErrors,
-                                          &asWriteFuncHeaderData,
-                                          &asWriteFuncData](CURL *hCurlHandle)
+            else
             {
-                auto oIter = oMapHandleToIdx.find(hCurlHandle);
-                CPLAssert(oIter != oMapHandleToIdx.end());
-                const auto iReq = oIter->second;
-
-                long response_code = 0;
-                curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE,
-                                  &response_code);
-
-                if (ENABLE_DEBUG && asCurlErrors[iReq].szCurlErrBuf[0] != '\0')
-                {
-                    char rangeStr[512] = {};
-                    snprintf(rangeStr, sizeof(rangeStr),
-                             CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
-                             asWriteFuncHeaderData[iReq].nStartOffset,
-                             asWriteFuncHeaderData[iReq].nEndOffset);
-
-                    const char *pszErrorMsg =
-                        &asCurlErrors[iReq].szCurlErrBuf[0];
-                    CPLDebug(poFS->GetDebugKey(),
-                             "ReadMultiRange(%s), %s: response_code=%d, msg=%s",
-                             osURL.c_str(), rangeStr,
-                             static_cast<int>(response_code), pszErrorMsg);
-                }
-
-                bool bToRetry = false;
-                if ((response_code != 206 && response_code != 225) ||
-                    asWriteFuncHeaderData[iReq].nEndOffset + 1 !=
-                        asWriteFuncHeaderData[iReq].nStartOffset +
-                            asWriteFuncData[iReq].nSize)
+                const size_t nSize = asWriteFuncData[iReq].nSize;
+                if (bAddToRegionCache)
                 {
-                    char rangeStr[512] = {};
-                    snprintf(rangeStr, sizeof(rangeStr),
-                             CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
-                             asWriteFuncHeaderData[iReq].nStartOffset,
-                             asWriteFuncHeaderData[iReq].nEndOffset);
-
-                    // Look if we should attempt a retry
-                    if (m_aoAdviseReadRanges[iReq]->retryContext.CanRetry(
-                            static_cast<int>(response_code),
-                            asWriteFuncData[iReq].pBuffer,
-                            &asCurlErrors[iReq].szCurlErrBuf[0]))
+                    const int knDOWNLOAD_CHUNK_SIZE =
+                        VSICURLGetDownloadChunkSize();
+                    for (size_t nPos = 0; nPos < nSize;
+                         nPos += knDOWNLOAD_CHUNK_SIZE)
                     {
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "HTTP error code for %s range %s: %d. "
-                                 "Retrying again in %.1f secs",
-                                 osURL.c_str(), rangeStr,
-                                 static_cast<int>(response_code),
-                                 m_aoAdviseReadRanges[iReq]
-                                     ->retryContext.GetCurrentDelay());
-                        m_aoAdviseReadRanges[iReq]->dfSleepDelay =
-                            m_aoAdviseReadRanges[iReq]
-                                ->retryContext.GetCurrentDelay();
-                        bToRetry = true;
-                    }
-                    else
-                    {
-                        CPLError(CE_Failure, CPLE_AppDefined,
-                                 "Request for %s range %s failed with "
-                                 "response_code=%ld",
-                                 osURL.c_str(), rangeStr, response_code);
+                        poFS->AddRegion(
+                            m_pszURL, aoRanges[iReq]->nStartOffset + nPos,
+                            std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE),
+                                     nSize - nPos),
+                            asWriteFuncData[iReq].pBuffer + nPos, m_bCached);
                     }
                 }
                 else
                 {
-                    const size_t nSize = asWriteFuncData[iReq].nSize;
-                    memcpy(&m_aoAdviseReadRanges[iReq]->abyData[0],
+                    memcpy(&aoRanges[iReq]->abyData[0],
                            asWriteFuncData[iReq].pBuffer, nSize);
-                    m_aoAdviseReadRanges[iReq]->abyData.resize(nSize);
-
-                    nTotalDownloaded += nSize;
+                    aoRanges[iReq]->abyData.resize(nSize);
                 }
 
-                m_aoAdviseReadRanges[iReq]->bToRetry = bToRetry;
-
-                if (!bToRetry)
-                {
-                    std::lock_guard<std::mutex> oLock(
-                        m_aoAdviseReadRanges[iReq]->oMutex);
-                    m_aoAdviseReadRanges[iReq]->bDone = true;
-                    m_aoAdviseReadRanges[iReq]->oCV.notify_all();
-                }
-            };
+                nTotalDownloaded += nSize;
+            }
 
-            int repeats = 0;
+            aoRanges[iReq]->bToRetry = bToRetry;
 
-            void *old_handler = CPLHTTPIgnoreSigPipe();
-            while (true)
+            if (!bToRetry)
             {
-                int still_running;
-                while (curl_multi_perform(m_hCurlMultiHandleForAdviseRead,
-                                          &still_running) ==
-                       CURLM_CALL_MULTI_PERFORM)
-                {
-                    // loop
-                }
-                if (!still_running)
-                {
-                    break;
-                }
+                std::lock_guard<std::mutex> oLock(aoRanges[iReq]->oMutex);
+                aoRanges[iReq]->bDone = true;
+                aoRanges[iReq]->oCV.notify_all();
+            }
+        };
 
-                CURLMsg *msg;
-                do
-                {
-                    int msgq = 0;
-                    msg = curl_multi_info_read(m_hCurlMultiHandleForAdviseRead,
-                                               &msgq);
-                    if (msg && (msg->msg == CURLMSG_DONE))
-                    {
-                        DealWithRequest(msg->easy_handle);
-                    }
-                } while (msg);
+        int repeats = 0;
 
-                CPLMultiPerformWait(m_hCurlMultiHandleForAdviseRead, repeats);
+        void *old_handler = CPLHTTPIgnoreSigPipe();
+        while (true)
+        {
+            int still_running;
+            while (curl_multi_perform(hCurlMultiHandle, &still_running) ==
+                   CURLM_CALL_MULTI_PERFORM)
+            {
+                // loop
+            }
+            if (!still_running)
+            {
+                break;
             }
-            CPLHTTPRestoreSigPipeHandler(old_handler);
 
-            bool bRetry = false;
-            double dfDelay = 0.0;
-            for (size_t i = 0; i < m_aoAdviseReadRanges.size(); ++i)
+            CURLMsg *msg;
+            do
             {
-                bool bReqDone;
-                {
-                    // To please Coverity Scan
-                    std::lock_guard<std::mutex> oLock(
-                        m_aoAdviseReadRanges[i]->oMutex);
-                    bReqDone = m_aoAdviseReadRanges[i]->bDone;
-                }
-                if (!bReqDone && !m_aoAdviseReadRanges[i]->bToRetry)
-                {
-                    DealWithRequest(aHandles[i]);
-                }
-                if (m_aoAdviseReadRanges[i]->bToRetry)
-                    dfDelay = std::max(dfDelay,
-                                       m_aoAdviseReadRanges[i]->dfSleepDelay);
-                bRetry = bRetry || m_aoAdviseReadRanges[i]->bToRetry;
-                if (aHandles[i])
+                int msgq = 0;
+                msg = curl_multi_info_read(hCurlMultiHandle, &msgq);
+                if (msg && (msg->msg == CURLMSG_DONE))
                 {
-                    curl_multi_remove_handle(m_hCurlMultiHandleForAdviseRead,
-                                             aHandles[i]);
-                    VSICURLResetHeaderAndWriterFunctions(aHandles[i]);
-                    curl_easy_cleanup(aHandles[i]);
+                    DealWithRequest(msg->easy_handle);
                 }
-                CPLFree(apszRanges[i]);
-                CPLFree(asWriteFuncData[i].pBuffer);
-                CPLFree(asWriteFuncHeaderData[i].pBuffer);
-                if (aHeaders[i])
-                    curl_slist_free_all(aHeaders[i]);
-            }
-            if (!bRetry)
-                break;
-            CPLSleep(dfDelay);
+            } while (msg);
+
+            CPLMultiPerformWait(hCurlMultiHandle, repeats);
         }
+        CPLHTTPRestoreSigPipeHandler(old_handler);
 
-        NetworkStatisticsLogger::LogGET(nTotalDownloaded);
-    };
+        bool bRetry = false;
+        double dfDelay = 0.0;
+        for (size_t i = 0; i < aoRanges.size(); ++i)
+        {
+            bool bReqDone;
+            {
+                // To please Coverity Scan
+                std::lock_guard<std::mutex> oLock(aoRanges[i]->oMutex);
+                bReqDone = aoRanges[i]->bDone;
+            }
+            if (!bReqDone && !aoRanges[i]->bToRetry)
+            {
+                DealWithRequest(aHandles[i]);
+            }
+            if (aoRanges[i]->bToRetry)
+                dfDelay = std::max(dfDelay, aoRanges[i]->dfSleepDelay);
+            bRetry = bRetry || aoRanges[i]->bToRetry;
+            if (aHandles[i])
+            {
+                curl_multi_remove_handle(hCurlMultiHandle, aHandles[i]);
+                VSICURLResetHeaderAndWriterFunctions(aHandles[i]);
+                curl_easy_cleanup(aHandles[i]);
+            }
+            CPLFree(apszRanges[i]);
+            CPLFree(asWriteFuncData[i].pBuffer);
+            CPLFree(asWriteFuncHeaderData[i].pBuffer);
+            if (aHeaders[i])
+                curl_slist_free_all(aHeaders[i]);
+        }
+        if (!bRetry)
+            break;
+        CPLSleep(dfDelay);
+    }
 
-    m_oThreadAdviseRead = std::thread(task, l_osURL);
+    NetworkStatisticsLogger::LogGET(nTotalDownloaded);
+    if (bAddToRegionCache)
+        NetworkStatisticsLogger::LogPrefetch(nTotalDownloaded);
 }
 
 /************************************************************************/
@@ -4158,6 +4850,30 @@ VSICurlFilesystemHandlerBase::GetRegionCache()
     return m_poRegionCacheDoNotUseDirectly.get();
 }
 
+/************************************************************************/
+/*                         GetCacheValidator()                          */
+/************************************************************************/
+
+// Returns the string identifying the current version of the remote file,
+// to key its regions in the disk and shared caches, or an empty string if
+// unknown.
+static std::string GetCacheValidator(const char *pszURL)
+{
+    FileProp oFileProp;
+    if (!VSICURLGetCachedFileProp(pszURL, oFileProp) ||
+        oFileProp.eExists != EXIST_YES || !oFileProp.bHasComputedFileSize)
+    {
+        return std::string();
+    }
+    if (!oFileProp.ETag.empty())
+        return "ETag:" + oFileProp.ETag;
+    if (oFileProp.mTime != 0)
+        return CPLSPrintf("Last-Modified:" CPL_FRMT_GIB ",Size:" CPL_FRMT_GUIB,
+                          static_cast<GIntBig>(oFileProp.mTime),
+                          static_cast<GUIntBig>(oFileProp.fileSize));
+    return std::string();
+}
+
 /************************************************************************/
 /*                             GetRegion()                              */
 /************************************************************************/
@@ -4166,17 +4882,55 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
                                         vsi_l_offset nFileOffsetStart)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
+    std::string osValidator;
+    {
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> out;
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
+        {
+            return out;
+        }
+
+        osValidator = GetCacheValidator(pszURL);
+        auto poSharedCache = VSICurlSharedCache::Get(knDOWNLOAD_CHUNK_SIZE);
+        if (poSharedCache && !osValidator.empty())
+        {
+            out = std::make_shared<std::string>();
+            if (poSharedCache->GetRegion(pszURL, osValidator, nFileOffsetStart,
+                                         *out))
+            {
+                GetRegionCache()->insert(
+                    FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                    out);
+                return out;
+            }
+        }
+    }
+
+    // Disk accesses are done without holding hMutex
+    if (auto poDiskCache = VSICurlDiskCache::Get(knDOWNLOAD_CHUNK_SIZE))
     {
-        return out;
+        auto out = std::make_shared<std::string>();
+        if (!osValidator.empty() &&
+            poDiskCache->GetRegion(pszURL, osValidator, nFileOffsetStart, *out))
+        {
+            CPLMutexHolder oHolder(&hMutex);
+            if (auto poSharedCache =
+                    VSICurlSharedCache::Get(knDOWNLOAD_CHUNK_SIZE))
+            {
+                poSharedCache->AddRegion(pszURL, osValidator, nFileOffsetStart,
+                                         out->data(), out->size());
+            }
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out);
+            return out;
+        }
     }
 
     return nullptr;
@@ -4188,10 +4942,40 @@ VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
 
 void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
-                                             size_t nSize, const char *pData)
+                                             size_t nSize, const char *pData,
+                                             bool bShareable)
 {
+    // Data that must not be cached (CPL_VSIL_CURL_NON_CACHED, Cache-Control:
+    // no-cache, or VSI_CACHE explicitly set to FALSE) is only kept in the
+    // cache of this process, which is invalidated when the file is closed.
+    const std::string osValidator =
+        bShareable && CPLTestBool(CPLGetConfigOption("VSI_CACHE", "YES"))
+            ? GetCacheValidator(pszURL)
+            : std::string();
+
+    // Disk accesses are done without holding hMutex
+    if (!osValidator.empty())
+    {
+        if (auto poDiskCache =
+                VSICurlDiskCache::Get(VSICURLGetDownloadChunkSize()))
+        {
+            poDiskCache->AddRegion(pszURL, osValidator, nFileOffsetStart,
+                                   pData, nSize);
+        }
+    }
+
     CPLMutexHolder oHolder(&hMutex);
 
+    if (!osValidator.empty())
+    {
+        if (auto poSharedCache =
+                VSICurlSharedCache::Get(VSICURLGetDownloadChunkSize()))
+        {
+            poSharedCache->AddRegion(pszURL, osValidator, nFileOffsetStart,
+                                     pData, nSize);
+        }
+    }
+
     auto value = std::make_shared<std::string>();
     value->assign(pData, nSize);
     GetRegionCache()->insert(
@@ -4216,6 +5000,16 @@ bool VSICurlFilesystemHandlerBase::GetCachedFileProp(const char *pszURL,
         }
         oCacheFileProp.remove(std::string(pszURL));
     }
+    if (auto poSharedCache =
+            VSICurlSharedCache::Get(VSICURLGetDownloadChunkSize()))
+    {
+        if (poSharedCache->GetFileProp(pszURL, oFileProp))
+        {
+            oCacheFileProp.insert(std::string(pszURL), true);
+            VSICURLSetCachedFileProp(pszURL, oFileProp);
+            return true;
+        }
+    }
     return false;
 }
 
@@ -4229,6 +5023,11 @@ void VSICurlFilesystemHandlerBase::SetCachedFileProp(const char *pszURL,
     CPLMutexHolder oHolder(&hMutex);
     oCacheFileProp.insert(std::string(pszURL), true);
     VSICURLSetCachedFileProp(pszURL, oFileProp);
+    if (auto poSharedCache =
+            VSICurlSharedCache::Get(VSICURLGetDownloadChunkSize()))
+    {
+        poSharedCache->SetFileProp(pszURL, oFileProp);
+    }
 }
 
 /************************************************************************/
@@ -4326,6 +5125,12 @@ void VSICurlFilesystemHandlerBase::InvalidateCachedData(const char *pszURL)
     poRegionCache->cwalk(lambda);
     for (const auto &key : keysToRemove)
         poRegionCache->remove(key);
+
+    if (auto poSharedCache =
+            VSICurlSharedCache::Get(VSICURLGetDownloadChunkSize()))
+    {
+        poSharedCache->Invalidate(osURL, /* bExactMatch = */ true);
+    }
 }
 
 /************************************************************************/
@@ -4392,6 +5197,12 @@ void VSICurlFilesystemHandlerBase::PartialClearCache(
     }
     VSICURLInvalidateCachedFilePropPrefix(osURL.c_str());
 
+    if (auto poSharedCache =
+            VSICurlSharedCache::Get(VSICURLGetDownloadChunkSize()))
+    {
+        poSharedCache->Invalidate(osURL, /* bExactMatch = */ false);
+    }
+
     {
         const size_t nLen = strlen(pszFilenamePrefix);
         std::list<std::string> keysToRemove;
@@ -6296,6 +7107,28 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogPrefetch(size_t nDownloadedBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nPrefetchDownloadedBytes += nDownloadedBytes;
+    }
+}
+
+void NetworkStatisticsLogger::LogPrefetchHit(size_t nBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nPrefetchHitBytes += nBytes;
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -6325,6 +7158,20 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    if (counters.nPrefetchDownloadedBytes || counters.nPrefetchHitBytes)
+    {
+        CPLJSONObject oPrefetch;
+        oPrefetch.Add("downloaded_bytes", counters.nPrefetchDownloadedBytes);
+        oPrefetch.Add("hit_bytes", counters.nPrefetchHitBytes);
+        if (counters.nPrefetchDownloadedBytes)
+        {
+            oPrefetch.Add("hit_rate",
+                          static_cast<double>(counters.nPrefetchHitBytes) /
+                              static_cast<double>(
+                                  counters.nPrefetchDownloadedBytes));
+        }
+        oJSON.Add("prefetch", oPrefetch);
+    }
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
@@ -6665,6 +7512,11 @@ void VSIInstallCurlFileHandler(void)
  * mechanisms can prevent opening new files, or give an outdated version of
  * them.
  *
+ * Only the cache of the current process is cleared. The host-level cache
+ * set with the CPL_VSIL_CURL_SHARED_CACHE configuration option is shared
+ * with other processes, and is left untouched: use
+ * VSICurlPartialClearCache() to invalidate its entries for given files.
+ *
  */
 
 void VSICurlClearCache(void)
@@ -6683,6 +7535,9 @@ void VSICurlClearCache(void)
     }
     CSLDestroy(papszPrefix);
 
+    // The shared cache (CPL_VSIL_CURL_SHARED_CACHE) is in use by other
+    // processes, so it is left untouched.
+
     VSICurlStreamingClearCache();
 }
 
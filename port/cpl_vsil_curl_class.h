@@ -28,6 +28,7 @@
 #include "cpl_curl_priv.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <set>
@@ -212,6 +213,26 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     std::map<std::string, std::unique_ptr<RegionInDownload>>
         m_oMapRegionInDownload{};
 
+  public:
+    // Range of a file being downloaded by ReadMultiRange() or
+    // DownloadRegion(), so that requests of other threads that it covers
+    // wait for its result instead of being issued.
+    struct RangeInDownload
+    {
+        vsi_l_offset nStartOffset = 0;
+        size_t nSize = 0;
+        std::mutex oMutex{};
+        std::condition_variable oCond{};
+        bool bDone = false;
+        int nWaiters = 0;
+        std::string osData{};
+    };
+
+  private:
+    // Protected by m_oMutex
+    std::map<std::string, std::vector<std::shared_ptr<RangeInDownload>>>
+        m_oMapRangesInDownload{};
+
   protected:
     CPLMutex *hMutex = nullptr;
 
@@ -294,7 +315,7 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
                                            vsi_l_offset nFileOffsetStart);
 
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
-                   size_t nSize, const char *pData);
+                   size_t nSize, const char *pData, bool bShareable = true);
 
     std::pair<bool, std::string>
     NotifyStartDownloadRegion(const std::string &osURL,
@@ -303,6 +324,16 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
                                   vsi_l_offset startOffset, int nBlocks,
                                   const std::string &osData);
 
+    std::shared_ptr<RangeInDownload>
+    StartDownloadRange(const std::string &osURL, vsi_l_offset nStartOffset,
+                       size_t nSize, bool &bCovered);
+    void StopDownloadRange(const std::string &osURL,
+                           const std::shared_ptr<RangeInDownload> &poRange,
+                           const char *pData, size_t nSize);
+    static bool WaitForDownloadRange(RangeInDownload &oRange,
+                                     vsi_l_offset nStartOffset, size_t nSize,
+                                     void *pBuffer);
+
     bool GetCachedFileProp(const char *pszURL, FileProp &oFileProp);
     void SetCachedFileProp(const char *pszURL, FileProp &oFileProp);
     void InvalidateCachedData(const char *pszURL);
@@ -444,6 +475,42 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
     std::thread m_oThreadAdviseRead{};
     CURLM *m_hCurlMultiHandleForAdviseRead = nullptr;
 
+    void DownloadRangesInParallel(
+        std::vector<std::unique_ptr<AdviseReadRange>> &aoRanges,
+        CURLM *&hCurlMultiHandle, const std::string &osURL,
+        const CPLStringList &aosHTTPOptions, const char *pszAction,
+        bool bAddToRegionCache);
+
+    // Used by the adaptive readahead of Read(), enabled with
+    // CPL_VSIL_CURL_ADAPTIVE_READAHEAD. Each stream tracks a sequence of
+    // reads that are either contiguous, or separated by a constant stride.
+    struct ReadStream
+    {
+        vsi_l_offset nLastOffset = 0;
+        vsi_l_offset nLastEnd = 0;
+        vsi_l_offset nStride = 0;  // 0 for sequential streams
+        int nConfidence = 0;
+        vsi_l_offset nPrefetchedUpTo = 0;
+        GUIntBig nLastUse = 0;  // 0 for unused streams
+    };
+
+    bool m_bAdaptiveReadahead = false;
+    vsi_l_offset m_nMaxReadahead = 0;
+    std::array<ReadStream, 4> m_asReadStreams{};
+    GUIntBig m_nReadCounter = 0;
+    std::vector<std::unique_ptr<AdviseReadRange>> m_aoPrefetchRanges{};
+    std::thread m_oThreadPrefetch{};
+    std::atomic<bool> m_bPrefetchRunning = false;
+    CURLM *m_hCurlMultiHandleForPrefetch = nullptr;
+    // Chunks prefetched and not read yet
+    std::set<vsi_l_offset> m_oSetPrefetchedChunks{};
+
+    void UpdateAccessPattern(vsi_l_offset nOffset, size_t nSize);
+    void
+    Prefetch(const std::vector<std::pair<vsi_l_offset, size_t>> &aoRanges);
+    bool IsBeingPrefetched(vsi_l_offset nOffset);
+    bool WaitForPrefetch(vsi_l_offset nOffset);
+
   protected:
     virtual struct curl_slist *GetCurlHeaders(const std::string & /*osVerb*/,
                                               struct curl_slist *psHeaders)
@@ -1123,6 +1190,8 @@ class NetworkStatisticsLogger
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+        GIntBig nPrefetchDownloadedBytes = 0;
+        GIntBig nPrefetchHitBytes = 0;
     };
 
     enum class ContextPathType
@@ -1202,6 +1271,10 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogPrefetch(size_t nDownloadedBytes);
+
+    static void LogPrefetchHit(size_t nBytes);
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
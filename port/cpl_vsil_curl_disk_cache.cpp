@@ -0,0 +1,507 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of downloaded regions of /vsicurl/ and
+ *           related file systems.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_vsil_curl_disk_cache.h"
+
+#ifdef HAVE_CURL
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_multiproc.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <iterator>
+#include <set>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+constexpr char DISK_CACHE_MAGIC[8] = {'G', 'D', 'A', 'L', 'V', 'C', 'C', '1'};
+constexpr const char *DISK_CACHE_EXTENSION = ".chunk";
+constexpr const char *DISK_CACHE_TMP_EXTENSION = ".tmp";
+constexpr GIntBig DISK_CACHE_SIZE_DEFAULT = 1024 * 1024 * 1024;
+
+// Temporary files older than that have been left by a writer that died.
+constexpr int STALE_TMP_FILE_DELAY_SEC = 3600;
+
+// Fraction of the maximum size that this process may write before the
+// directory is scanned again for files of other processes.
+constexpr int RESCAN_FRACTION = 8;
+
+// The cache may contain data only readable with the credentials of the user,
+// so, as the shared cache, it must not be readable by others.
+constexpr long DISK_CACHE_DIR_MODE = 0700;
+
+/************************************************************************/
+/*                           CreatePrivate()                            */
+/************************************************************************/
+
+// Create an empty file only accessible by its owner, so that it keeps these
+// permissions when it is then opened with VSIFOpenL() in "wb" mode, whatever
+// the umask. Returns false if the file could not be created.
+static bool CreatePrivate(const std::string &osFilename)
+{
+#ifndef _WIN32
+    if (!STARTS_WITH(osFilename.c_str(), "/vsi"))
+    {
+        const int fd = open(osFilename.c_str(),
+                            O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        if (fd < 0)
+            return false;
+        close(fd);
+        return true;
+    }
+#endif
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+    return fp != nullptr && VSIFCloseL(fp) == 0;
+}
+
+/************************************************************************/
+/*                            TouchModTime()                            */
+/************************************************************************/
+
+// Set the modification time of a file to the current time, which is the
+// access time used to order the files of other processes when scanning.
+static void TouchModTime(const std::string &osFilename)
+{
+#ifndef _WIN32
+    if (!STARTS_WITH(osFilename.c_str(), "/vsi"))
+        CPL_IGNORE_RET_VAL(utimes(osFilename.c_str(), nullptr));
+#else
+    CPL_IGNORE_RET_VAL(osFilename);
+#endif
+}
+
+/************************************************************************/
+/*                         VSICurlDiskCache()                           */
+/************************************************************************/
+
+VSICurlDiskCache::VSICurlDiskCache(const std::string &osDirectory,
+                                   GIntBig nMaxSize, int nChunkSize)
+    : m_osDirectory(osDirectory), m_nMaxSize(nMaxSize),
+      m_nChunkSize(nChunkSize)
+{
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+std::shared_ptr<VSICurlDiskCache> VSICurlDiskCache::Get(int nChunkSize)
+{
+    const char *pszDirectory =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE", nullptr);
+    if (pszDirectory == nullptr || pszDirectory[0] == '\0')
+        return nullptr;
+
+    static std::mutex oMutex;
+    static std::shared_ptr<VSICurlDiskCache> poCurCache;
+
+    std::shared_ptr<VSICurlDiskCache> poCache;
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        if (poCurCache && poCurCache->m_osDirectory == pszDirectory)
+            return poCurCache;
+
+        GIntBig nMaxSize = DISK_CACHE_SIZE_DEFAULT;
+        const char *pszSize =
+            CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", nullptr);
+        if (pszSize &&
+            (CPLParseMemorySize(pszSize, &nMaxSize, nullptr) != CE_None ||
+             nMaxSize <= 0))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Invalid value for CPL_VSIL_CURL_DISK_CACHE_SIZE. "
+                     "Using default value of " CPL_FRMT_GIB " instead.",
+                     DISK_CACHE_SIZE_DEFAULT);
+            nMaxSize = DISK_CACHE_SIZE_DEFAULT;
+        }
+
+        VSIMkdirRecursive(pszDirectory, DISK_CACHE_DIR_MODE);
+        poCurCache.reset(
+            new VSICurlDiskCache(pszDirectory, nMaxSize, nChunkSize));
+        // Not shared with other threads yet, so m_oMutex need not be taken
+        CPL_IGNORE_RET_VAL(poCurCache->StartScanIfNeeded());
+        poCache = poCurCache;
+    }
+
+    // Index files left by previous runs without blocking the other users of
+    // the cache, which start with an empty index in the meantime.
+    poCache->ScanDirectory();
+    return poCache;
+}
+
+/************************************************************************/
+/*                         StartScanIfNeeded()                          */
+/************************************************************************/
+
+// Must be called with m_oMutex held. Returns true if the caller must call
+// ScanDirectory().
+bool VSICurlDiskCache::StartScanIfNeeded()
+{
+    if (m_bScanInProgress ||
+        (m_nScanCounter != 0 && m_nTotalSize <= m_nMaxSize &&
+         m_nBytesAddedSinceScan <= m_nMaxSize / RESCAN_FRACTION))
+    {
+        return false;
+    }
+    m_bScanInProgress = true;
+    m_nBytesAddedSinceScan = 0;
+    ++m_nScanCounter;
+    return true;
+}
+
+/************************************************************************/
+/*                           ScanDirectory()                            */
+/************************************************************************/
+
+// Index the files of the directory, which may have been written by previous
+// runs or other processes, delete temporary files left by dead writers, and
+// evict least recently used files if needed. The modification time of files
+// is updated on each hit, so it is their last access time. Must be called
+// without m_oMutex held, after StartScanIfNeeded() returned true.
+void VSICurlDiskCache::ScanDirectory()
+{
+    GUIntBig nScanCounter = 0;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        nScanCounter = m_nScanCounter;
+    }
+
+    const time_t nNow = time(nullptr);
+    const CPLStringList aosFiles(VSIReadDirRecursive(m_osDirectory.c_str()));
+    std::vector<std::pair<GIntBig, std::string>> aoFiles;
+    std::vector<GIntBig> anSizes;
+    for (const char *pszFile : aosFiles)
+    {
+        const std::string osFilename =
+            CPLFormFilenameSafe(m_osDirectory.c_str(), pszFile, nullptr);
+        const std::string osExtension = CPLGetExtensionSafe(pszFile);
+        VSIStatBufL sStat;
+        if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+            !VSI_ISREG(sStat.st_mode))
+        {
+            continue;
+        }
+        if (EQUAL(osExtension.c_str(), DISK_CACHE_TMP_EXTENSION + 1))
+        {
+            if (nNow - sStat.st_mtime > STALE_TMP_FILE_DELAY_SEC)
+                VSIUnlink(osFilename.c_str());
+            continue;
+        }
+        if (!EQUAL(osExtension.c_str(), DISK_CACHE_EXTENSION + 1))
+            continue;
+        aoFiles.emplace_back(static_cast<GIntBig>(sStat.st_mtime),
+                             osFilename);
+        anSizes.push_back(static_cast<GIntBig>(sStat.st_size));
+    }
+
+    // Most recently used first
+    std::vector<size_t> anOrder(aoFiles.size());
+    for (size_t i = 0; i < anOrder.size(); ++i)
+        anOrder[i] = i;
+    std::stable_sort(anOrder.begin(), anOrder.end(),
+                     [&aoFiles](size_t a, size_t b)
+                     { return aoFiles[a].first > aoFiles[b].first; });
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+
+    // Forget files deleted by other processes, unless this process has
+    // touched them since the start of the scan.
+    std::set<std::string> aosFound;
+    for (const auto &oFile : aoFiles)
+        aosFound.insert(oFile.second);
+    std::vector<std::string> aosToForget;
+    for (const auto &oIter : m_oMapEntries)
+    {
+        if (oIter.second.nScanCounter < nScanCounter &&
+            aosFound.find(oIter.first) == aosFound.end())
+        {
+            aosToForget.push_back(oIter.first);
+        }
+    }
+    for (const auto &osFilename : aosToForget)
+        Forget(osFilename);
+
+    // Files that this process has not used are older than those it has used.
+    for (const size_t i : anOrder)
+    {
+        if (m_oMapEntries.find(aoFiles[i].second) == m_oMapEntries.end())
+            Touch(aoFiles[i].second, anSizes[i], /* bMostRecent = */ false);
+    }
+    m_bScanInProgress = false;
+    EvictIfNeeded();
+
+    CPLDebug("VSICURL",
+             "Disk cache %s: %d chunks, " CPL_FRMT_GIB " bytes after scan",
+             m_osDirectory.c_str(), static_cast<int>(m_oMapEntries.size()),
+             m_nTotalSize);
+}
+
+/************************************************************************/
+/*                               GetKey()                               */
+/************************************************************************/
+
+std::string VSICurlDiskCache::GetKey(const std::string &osURL,
+                                     const std::string &osValidator,
+                                     vsi_l_offset nOffset) const
+{
+    std::string osKey(osURL);
+    osKey += '\n';
+    osKey += osValidator;
+    osKey += CPLSPrintf("\n" CPL_FRMT_GUIB "\n%d",
+                        static_cast<GUIntBig>(nOffset), m_nChunkSize);
+    return osKey;
+}
+
+/************************************************************************/
+/*                            GetFilename()                             */
+/************************************************************************/
+
+std::string VSICurlDiskCache::GetFilename(const std::string &osKey) const
+{
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    std::string osHex(pszHex);
+    CPLFree(pszHex);
+    // Spread files among 256 sub-directories
+    const std::string osSubDir = CPLFormFilenameSafe(
+        m_osDirectory.c_str(), osHex.substr(0, 2).c_str(), nullptr);
+    return CPLFormFilenameSafe(osSubDir.c_str(), osHex.c_str(),
+                               DISK_CACHE_EXTENSION + 1);
+}
+
+/************************************************************************/
+/*                               Touch()                                */
+/************************************************************************/
+
+// Must be called with m_oMutex held. New entries are inserted as the least
+// recently used one if bMostRecent is false.
+void VSICurlDiskCache::Touch(const std::string &osFilename, GIntBig nSize,
+                             bool bMostRecent)
+{
+    auto oIter = m_oMapEntries.find(osFilename);
+    if (oIter != m_oMapEntries.end())
+    {
+        m_aosLRU.splice(m_aosLRU.begin(), m_aosLRU, oIter->second.oIter);
+        m_nTotalSize += nSize - oIter->second.nSize;
+        oIter->second.nSize = nSize;
+        oIter->second.nScanCounter = m_nScanCounter;
+    }
+    else
+    {
+        Entry oEntry;
+        if (bMostRecent)
+        {
+            m_aosLRU.push_front(osFilename);
+            oEntry.oIter = m_aosLRU.begin();
+        }
+        else
+        {
+            m_aosLRU.push_back(osFilename);
+            oEntry.oIter = std::prev(m_aosLRU.end());
+        }
+        oEntry.nSize = nSize;
+        oEntry.nScanCounter = m_nScanCounter;
+        m_oMapEntries[osFilename] = oEntry;
+        m_nTotalSize += nSize;
+    }
+}
+
+/************************************************************************/
+/*                               Forget()                               */
+/************************************************************************/
+
+// Must be called with m_oMutex held.
+void VSICurlDiskCache::Forget(const std::string &osFilename)
+{
+    auto oIter = m_oMapEntries.find(osFilename);
+    if (oIter != m_oMapEntries.end())
+    {
+        m_nTotalSize -= oIter->second.nSize;
+        m_aosLRU.erase(oIter->second.oIter);
+        m_oMapEntries.erase(oIter);
+    }
+}
+
+/************************************************************************/
+/*                           EvictIfNeeded()                            */
+/************************************************************************/
+
+// Must be called with m_oMutex held. Nothing is done while a scan is in
+// progress, as the sizes of the files of other processes are then unknown.
+void VSICurlDiskCache::EvictIfNeeded()
+{
+    if (m_bScanInProgress)
+        return;
+    while (m_nTotalSize > m_nMaxSize && !m_aosLRU.empty())
+    {
+        const std::string osFilename = m_aosLRU.back();
+        Forget(osFilename);
+        VSIUnlink(osFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                             GetRegion()                              */
+/************************************************************************/
+
+bool VSICurlDiskCache::GetRegion(const std::string &osURL,
+                                 const std::string &osValidator,
+                                 vsi_l_offset nOffset, std::string &osData)
+{
+    const std::string osKey = GetKey(osURL, osValidator, nOffset);
+    const std::string osFilename = GetFilename(osKey);
+
+    // Files are only renamed into place once complete, so a file that
+    // exists is complete. It may have been written by another process.
+    bool bOK = false;
+    vsi_l_offset nFileSize = 0;
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (fp)
+    {
+        char abyMagic[sizeof(DISK_CACHE_MAGIC)];
+        GUInt32 nKeySize = 0;
+        std::string osStoredKey;
+        if (VSIFReadL(abyMagic, sizeof(abyMagic), 1, fp) == 1 &&
+            memcmp(abyMagic, DISK_CACHE_MAGIC, sizeof(abyMagic)) == 0 &&
+            VSIFReadL(&nKeySize, sizeof(nKeySize), 1, fp) == 1)
+        {
+            CPL_LSBPTR32(&nKeySize);
+            if (nKeySize == osKey.size())
+            {
+                osStoredKey.resize(nKeySize);
+                bOK = VSIFReadL(&osStoredKey[0], nKeySize, 1, fp) == 1 &&
+                      osStoredKey == osKey;
+            }
+        }
+        if (bOK)
+        {
+            const vsi_l_offset nDataOffset = VSIFTellL(fp);
+            bOK = VSIFSeekL(fp, 0, SEEK_END) == 0;
+            nFileSize = VSIFTellL(fp);
+            const vsi_l_offset nDataSize = nFileSize - nDataOffset;
+            bOK = bOK &&
+                  nDataSize <= static_cast<vsi_l_offset>(m_nChunkSize) &&
+                  VSIFSeekL(fp, nDataOffset, SEEK_SET) == 0;
+            if (bOK)
+            {
+                osData.resize(static_cast<size_t>(nDataSize));
+                bOK = nDataSize == 0 ||
+                      VSIFReadL(&osData[0], osData.size(), 1, fp) == 1;
+            }
+        }
+        VSIFCloseL(fp);
+    }
+    // So that other processes, or later runs, see it as recently used
+    if (bOK)
+        TouchModTime(osFilename);
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (bOK)
+    {
+        Touch(osFilename, static_cast<GIntBig>(nFileSize));
+        EvictIfNeeded();
+    }
+    else
+    {
+        // Not cached, evicted by another process, or corrupted
+        Forget(osFilename);
+        if (fp)
+            VSIUnlink(osFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                             AddRegion()                              */
+/************************************************************************/
+
+void VSICurlDiskCache::AddRegion(const std::string &osURL,
+                                 const std::string &osValidator,
+                                 vsi_l_offset nOffset, const char *pData,
+                                 size_t nSize)
+{
+    const std::string osKey = GetKey(osURL, osValidator, nOffset);
+    const std::string osFilename = GetFilename(osKey);
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if (m_oMapEntries.find(osFilename) != m_oMapEntries.end())
+            return;
+    }
+
+    // Write to a temporary file that is renamed once complete, so that
+    // readers of other threads or processes never see partial files.
+    const std::string osTmpFilename = CPLSPrintf(
+        "%s.%d." CPL_FRMT_GIB "%s", osFilename.c_str(),
+        CPLGetCurrentProcessID(), CPLGetPID(), DISK_CACHE_TMP_EXTENSION);
+    if (!CreatePrivate(osTmpFilename))
+    {
+        VSIMkdir(CPLGetPathSafe(osFilename.c_str()).c_str(),
+                 DISK_CACHE_DIR_MODE);
+        if (!CreatePrivate(osTmpFilename))
+            return;
+    }
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+    GUInt32 nKeySize = static_cast<GUInt32>(osKey.size());
+    CPL_LSBPTR32(&nKeySize);
+    bool bOK =
+        VSIFWriteL(DISK_CACHE_MAGIC, sizeof(DISK_CACHE_MAGIC), 1, fp) == 1 &&
+        VSIFWriteL(&nKeySize, sizeof(nKeySize), 1, fp) == 1 &&
+        VSIFWriteL(osKey.data(), osKey.size(), 1, fp) == 1 &&
+        (nSize == 0 || VSIFWriteL(pData, nSize, 1, fp) == 1);
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    const GIntBig nFileSize = static_cast<GIntBig>(
+        sizeof(DISK_CACHE_MAGIC) + sizeof(nKeySize) + osKey.size() + nSize);
+    bool bScan = false;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        Touch(osFilename, nFileSize);
+        m_nBytesAddedSinceScan += nFileSize;
+        // Check the actual size of the directory before evicting files
+        bScan = StartScanIfNeeded();
+    }
+    if (bScan)
+        ScanDirectory();
+}
+
+}  // namespace cpl
+
+//! @endcond
+
+#endif  // HAVE_CURL
@@ -0,0 +1,105 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of downloaded regions of /vsicurl/ and
+ *           related file systems.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_VSIL_CURL_DISK_CACHE_H_INCLUDED
+#define CPL_VSIL_CURL_DISK_CACHE_H_INCLUDED
+
+#ifdef HAVE_CURL
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+/************************************************************************/
+/*                           VSICurlDiskCache                           */
+/************************************************************************/
+
+// Each region is stored in its own file, whose name is the SHA256 of the
+// URL, the validator of the remote file (ETag, or modification time and
+// size) and the offset of the region. A changed remote file thus never
+// matches entries of its previous version, which are eventually evicted.
+// Eviction is least-recently-used, bounded by the total size of the files.
+// As several processes may share the directory, it is scanned again, outside
+// of any lock, once the size known to this process exceeds the maximum, or
+// after this process has written a fraction of it, so that eviction takes
+// into account the files written by the other processes.
+
+class VSICurlDiskCache
+{
+  public:
+    // Returns the cache configured with CPL_VSIL_CURL_DISK_CACHE, or
+    // nullptr if it is not configured.
+    static std::shared_ptr<VSICurlDiskCache> Get(int nChunkSize);
+
+    bool GetRegion(const std::string &osURL, const std::string &osValidator,
+                   vsi_l_offset nOffset, std::string &osData);
+    void AddRegion(const std::string &osURL, const std::string &osValidator,
+                   vsi_l_offset nOffset, const char *pData, size_t nSize);
+
+  private:
+    VSICurlDiskCache(const std::string &osDirectory, GIntBig nMaxSize,
+                     int nChunkSize);
+    CPL_DISALLOW_COPY_ASSIGN(VSICurlDiskCache)
+
+    void ScanDirectory();
+    bool StartScanIfNeeded();
+    std::string GetKey(const std::string &osURL,
+                       const std::string &osValidator,
+                       vsi_l_offset nOffset) const;
+    std::string GetFilename(const std::string &osKey) const;
+    void Touch(const std::string &osFilename, GIntBig nSize,
+               bool bMostRecent = true);
+    void Forget(const std::string &osFilename);
+    void EvictIfNeeded();
+
+    const std::string m_osDirectory;
+    const GIntBig m_nMaxSize;
+    const int m_nChunkSize;
+
+    std::mutex m_oMutex{};
+    GIntBig m_nTotalSize = 0;
+    // Bytes written by this process since the start of the last scan
+    GIntBig m_nBytesAddedSinceScan = 0;
+    bool m_bScanInProgress = false;
+    // Incremented when a scan starts
+    GUIntBig m_nScanCounter = 0;
+    // Most recently used entries are at the front
+    std::list<std::string> m_aosLRU{};
+
+    struct Entry
+    {
+        std::list<std::string>::iterator oIter{};
+        GIntBig nSize = 0;
+        // Value of m_nScanCounter when the entry was last touched
+        GUIntBig nScanCounter = 0;
+    };
+
+    std::unordered_map<std::string, Entry> m_oMapEntries{};
+};
+
+}  // namespace cpl
+
+//! @endcond
+
+#endif  // HAVE_CURL
+
+#endif  // CPL_VSIL_CURL_DISK_CACHE_H_INCLUDED
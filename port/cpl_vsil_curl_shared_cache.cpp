@@ -0,0 +1,730 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Host-level cache of downloaded regions and file properties of
+ *           /vsicurl/ and related file systems, shared between processes
+ *           through a memory-mapped file.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_vsil_curl_shared_cache.h"
+
+#ifdef HAVE_CURL
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsil_curl_class.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <mutex>
+
+#if defined(HAVE_MMAP) && !defined(_WIN32)
+#define HAVE_VSICURL_SHARED_CACHE
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+namespace
+{
+
+constexpr char SHARED_CACHE_MAGIC[8] = {'G', 'D', 'A', 'L', 'V', 'S', 'C', '1'};
+constexpr uint32_t SHARED_CACHE_VERSION = 2;
+constexpr size_t SHARED_CACHE_HEADER_SIZE = 4096;
+constexpr uint64_t SHARED_CACHE_SIZE_DEFAULT = 256 * 1024 * 1024;
+constexpr uint64_t N_WAYS = 4;
+constexpr uint32_t MAX_KEY_SIZE = 1024;
+constexpr uint32_t MAX_VALIDATOR_SIZE = 256;
+constexpr uint32_t MAX_ETAG_SIZE = 128;
+constexpr int SHARED_CACHE_TTL_DEFAULT = 60;
+
+// A slot locked for longer than that was probably locked by a process that
+// died while writing it.
+constexpr uint32_t STALE_LOCK_DELAY_SEC = 10;
+
+constexpr uint64_t LOCK_MASK = 0xFFFFFFFFU;
+
+struct SharedCacheHeader
+{
+    char szMagic[8];
+    uint32_t nVersion;
+    uint32_t nChunkSize;
+    uint64_t nTotalSize;
+    uint64_t nRegionSlots;
+    uint64_t nRegionSlotSize;
+    uint64_t nFilePropSlots;
+    uint64_t nFilePropSlotSize;
+};
+
+struct SlotHeader
+{
+    // High 32 bits: number of times the slot has been written.
+    // Low 32 bits: 0 if the slot is not locked, or 1 + the time in seconds
+    // at which it has been locked.
+    std::atomic<uint64_t> nSeq;
+    // Last access time in milliseconds, for replacement.
+    std::atomic<uint64_t> nLastAccess;
+    uint64_t nKeyHash;
+    uint64_t nOffset;
+    // Wall clock time at which the slot has been written, for expiration.
+    int64_t nStoreTime;
+    uint32_t nKeySize;  // 0 for an empty slot
+    uint32_t nValidatorSize;
+    uint32_t nDataSize;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "lock-free 64-bit atomics are needed for the shared cache");
+
+struct SharedFileProp
+{
+    int32_t nHTTPCode;
+    int32_t nMode;
+    uint64_t nFileSize;
+    int64_t nMTime;
+    uint8_t bIsDirectory;
+    uint8_t bIsAzureFolder;
+    uint8_t nETagSize;
+    char szETag[MAX_ETAG_SIZE];
+};
+
+constexpr uint64_t RoundUp64(uint64_t n)
+{
+    return (n + 63) / 64 * 64;
+}
+
+/************************************************************************/
+/*                             GetNowSec()                              */
+/************************************************************************/
+
+// steady_clock is system-wide on the platforms we support, so timestamps
+// can be compared between processes.
+uint32_t GetNowSec()
+{
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+uint64_t GetNowMilliSec()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+/************************************************************************/
+/*                              HashKey()                               */
+/************************************************************************/
+
+// FNV-1a, so that all processes compute the same hash whatever the
+// standard library they are built with.
+uint64_t HashKey(const std::string &osKey, uint64_t nOffset)
+{
+    uint64_t nHash = 14695981039346656037ULL;
+    for (const char ch : osKey)
+    {
+        nHash ^= static_cast<uint8_t>(ch);
+        nHash *= 1099511628211ULL;
+    }
+    for (int i = 0; i < 8; ++i)
+    {
+        nHash ^= static_cast<uint8_t>(nOffset >> (8 * i));
+        nHash *= 1099511628211ULL;
+    }
+    return nHash;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                       VSICurlSharedCache::Table                      */
+/************************************************************************/
+
+struct VSICurlSharedCache::Table
+{
+    GByte *pabyBase = nullptr;
+    uint64_t nSlots = 0;
+    uint64_t nSlotSize = 0;
+    uint32_t nDataCapacity = 0;
+
+    SlotHeader *GetSlot(uint64_t i) const
+    {
+        return reinterpret_cast<SlotHeader *>(pabyBase + i * nSlotSize);
+    }
+
+    static GByte *GetKey(SlotHeader *psSlot)
+    {
+        return reinterpret_cast<GByte *>(psSlot + 1);
+    }
+
+    static GByte *GetValidator(SlotHeader *psSlot)
+    {
+        return GetKey(psSlot) + MAX_KEY_SIZE;
+    }
+
+    static GByte *GetData(SlotHeader *psSlot)
+    {
+        return GetValidator(psSlot) + MAX_VALIDATOR_SIZE;
+    }
+
+    bool Get(const std::string &osKey, uint64_t nOffset,
+             const std::string &osValidator, int nMaxAgeSec,
+             std::string &osData);
+    void Put(const std::string &osKey, uint64_t nOffset,
+             const std::string &osValidator, const void *pData, size_t nSize);
+    void Invalidate(const std::string &osKeyPrefix, bool bExactMatch);
+
+  private:
+    static bool Lock(SlotHeader *psSlot, uint64_t &nLockedSeq);
+    static void Unlock(SlotHeader *psSlot, uint64_t nLockedSeq);
+};
+
+/************************************************************************/
+/*                                Lock()                                */
+/************************************************************************/
+
+bool VSICurlSharedCache::Table::Lock(SlotHeader *psSlot, uint64_t &nLockedSeq)
+{
+    uint64_t nSeq = psSlot->nSeq.load(std::memory_order_relaxed);
+    const uint32_t nNowSec = GetNowSec() & 0x7FFFFFFFU;
+    if ((nSeq & LOCK_MASK) != 0)
+    {
+        const uint32_t nLockSec = static_cast<uint32_t>(nSeq & LOCK_MASK) - 1;
+        if (((nNowSec - nLockSec) & 0x7FFFFFFFU) < STALE_LOCK_DELAY_SEC)
+            return false;
+    }
+    nLockedSeq = (((nSeq >> 32) + 1) << 32) | (nNowSec + 1);
+    return psSlot->nSeq.compare_exchange_strong(nSeq, nLockedSeq,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                               Unlock()                               */
+/************************************************************************/
+
+void VSICurlSharedCache::Table::Unlock(SlotHeader *psSlot, uint64_t nLockedSeq)
+{
+    // Fails if the lock has been considered as stale and stolen by another
+    // writer, in which case that writer will unlock the slot.
+    psSlot->nSeq.compare_exchange_strong(nLockedSeq, nLockedSeq & ~LOCK_MASK,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+// Entries whose validator differs from osValidator, or older than nMaxAgeSec
+// seconds if it is not negative, are not returned.
+bool VSICurlSharedCache::Table::Get(const std::string &osKey, uint64_t nOffset,
+                                    const std::string &osValidator,
+                                    int nMaxAgeSec, std::string &osData)
+{
+    if (osKey.empty() || osKey.size() > MAX_KEY_SIZE ||
+        osValidator.size() > MAX_VALIDATOR_SIZE)
+        return false;
+    const int64_t nNow = static_cast<int64_t>(time(nullptr));
+    const uint64_t nHash = HashKey(osKey, nOffset);
+    const uint64_t nFirstSlot = (nHash % (nSlots / N_WAYS)) * N_WAYS;
+    for (uint64_t iWay = 0; iWay < N_WAYS; ++iWay)
+    {
+        SlotHeader *psSlot = GetSlot(nFirstSlot + iWay);
+        const uint64_t nSeq = psSlot->nSeq.load(std::memory_order_acquire);
+        if ((nSeq & LOCK_MASK) != 0 || psSlot->nKeyHash != nHash ||
+            psSlot->nOffset != nOffset || psSlot->nKeySize != osKey.size())
+            continue;
+        const uint32_t nDataSize = psSlot->nDataSize;
+        if (nDataSize > nDataCapacity ||
+            memcmp(GetKey(psSlot), osKey.data(), osKey.size()) != 0)
+            continue;
+        if (psSlot->nValidatorSize != osValidator.size() ||
+            memcmp(GetValidator(psSlot), osValidator.data(),
+                   osValidator.size()) != 0 ||
+            (nMaxAgeSec >= 0 && nNow - psSlot->nStoreTime >= nMaxAgeSec))
+        {
+            // Entry of another version of the remote file, or expired
+            return false;
+        }
+        osData.assign(reinterpret_cast<const char *>(GetData(psSlot)),
+                      nDataSize);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (psSlot->nSeq.load(std::memory_order_relaxed) != nSeq)
+            return false;
+        psSlot->nLastAccess.store(GetNowMilliSec(), std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                                Put()                                 */
+/************************************************************************/
+
+void VSICurlSharedCache::Table::Put(const std::string &osKey, uint64_t nOffset,
+                                    const std::string &osValidator,
+                                    const void *pData, size_t nSize)
+{
+    if (osKey.empty() || osKey.size() > MAX_KEY_SIZE ||
+        osValidator.size() > MAX_VALIDATOR_SIZE || nSize > nDataCapacity)
+        return;
+    const uint64_t nHash = HashKey(osKey, nOffset);
+    const uint64_t nFirstSlot = (nHash % (nSlots / N_WAYS)) * N_WAYS;
+
+    // Replace the entry with the same key if there is one, otherwise an
+    // empty slot, otherwise the least recently accessed one.
+    SlotHeader *psVictim = nullptr;
+    uint64_t nOldestAccess = std::numeric_limits<uint64_t>::max();
+    for (uint64_t iWay = 0; iWay < N_WAYS; ++iWay)
+    {
+        SlotHeader *psSlot = GetSlot(nFirstSlot + iWay);
+        if (psSlot->nKeySize == 0)
+        {
+            psVictim = psSlot;
+            nOldestAccess = 0;
+        }
+        else if (psSlot->nKeyHash == nHash && psSlot->nOffset == nOffset &&
+                 psSlot->nKeySize == osKey.size())
+        {
+            psVictim = psSlot;
+            break;
+        }
+        else
+        {
+            const uint64_t nLastAccess =
+                psSlot->nLastAccess.load(std::memory_order_relaxed);
+            if (nLastAccess < nOldestAccess)
+            {
+                psVictim = psSlot;
+                nOldestAccess = nLastAccess;
+            }
+        }
+    }
+
+    uint64_t nLockedSeq = 0;
+    if (!Lock(psVictim, nLockedSeq))
+        return;  // Another process is writing it: do not wait for it.
+    psVictim->nKeyHash = nHash;
+    psVictim->nOffset = nOffset;
+    psVictim->nStoreTime = static_cast<int64_t>(time(nullptr));
+    psVictim->nKeySize = static_cast<uint32_t>(osKey.size());
+    psVictim->nValidatorSize = static_cast<uint32_t>(osValidator.size());
+    psVictim->nDataSize = static_cast<uint32_t>(nSize);
+    memcpy(GetKey(psVictim), osKey.data(), osKey.size());
+    memcpy(GetValidator(psVictim), osValidator.data(), osValidator.size());
+    if (nSize)
+        memcpy(GetData(psVictim), pData, nSize);
+    psVictim->nLastAccess.store(GetNowMilliSec(), std::memory_order_relaxed);
+    Unlock(psVictim, nLockedSeq);
+}
+
+/************************************************************************/
+/*                             Invalidate()                             */
+/************************************************************************/
+
+void VSICurlSharedCache::Table::Invalidate(const std::string &osKeyPrefix,
+                                           bool bExactMatch)
+{
+    for (uint64_t i = 0; i < nSlots; ++i)
+    {
+        SlotHeader *psSlot = GetSlot(i);
+        const uint32_t nKeySize = psSlot->nKeySize;
+        if (nKeySize == 0 || nKeySize > MAX_KEY_SIZE ||
+            nKeySize < osKeyPrefix.size() ||
+            (bExactMatch && nKeySize != osKeyPrefix.size()) ||
+            memcmp(GetKey(psSlot), osKeyPrefix.data(), osKeyPrefix.size()) !=
+                0)
+        {
+            continue;
+        }
+        uint64_t nLockedSeq = 0;
+        if (Lock(psSlot, nLockedSeq))
+        {
+            psSlot->nKeySize = 0;
+            psSlot->nDataSize = 0;
+            Unlock(psSlot, nLockedSeq);
+        }
+    }
+}
+
+/************************************************************************/
+/*                        ~VSICurlSharedCache()                         */
+/************************************************************************/
+
+VSICurlSharedCache::~VSICurlSharedCache()
+{
+#ifdef HAVE_VSICURL_SHARED_CACHE
+    if (m_pabyMapping)
+        munmap(m_pabyMapping, m_nMappingSize);
+    if (m_fd >= 0)
+        close(m_fd);
+#endif
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+bool VSICurlSharedCache::Open(const std::string &osFilename, uint64_t nSize,
+                              int nChunkSize)
+{
+#ifdef HAVE_VSICURL_SHARED_CACHE
+    // The cache may contain data only readable with the credentials of the
+    // user, so it must not be readable by others.
+    m_fd = open(osFilename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (m_fd < 0)
+    {
+        CPLError(CE_Warning, CPLE_FileIO,
+                 "Cannot open shared cache %s: %s. It will not be used",
+                 osFilename.c_str(), strerror(errno));
+        return false;
+    }
+
+    // Only the creation of the file is serialized between processes.
+    // Accesses to the cache itself are lock-free.
+    if (flock(m_fd, LOCK_EX) != 0)
+    {
+        CPLError(CE_Warning, CPLE_FileIO,
+                 "Cannot lock shared cache %s: %s. It will not be used",
+                 osFilename.c_str(), strerror(errno));
+        return false;
+    }
+
+    struct stat sStat;
+    bool bOK = fstat(m_fd, &sStat) == 0;
+    const bool bCreate = bOK && sStat.st_size == 0;
+    SharedCacheHeader sHeader;
+    memset(&sHeader, 0, sizeof(sHeader));
+    if (bCreate)
+    {
+        memcpy(sHeader.szMagic, SHARED_CACHE_MAGIC, sizeof(SHARED_CACHE_MAGIC));
+        sHeader.nVersion = SHARED_CACHE_VERSION;
+        sHeader.nChunkSize = static_cast<uint32_t>(nChunkSize);
+        sHeader.nRegionSlotSize =
+            RoundUp64(sizeof(SlotHeader) + MAX_KEY_SIZE +
+                                              MAX_VALIDATOR_SIZE + nChunkSize);
+        sHeader.nFilePropSlotSize =
+            RoundUp64(sizeof(SlotHeader) + MAX_KEY_SIZE + MAX_VALIDATOR_SIZE +
+                      sizeof(SharedFileProp));
+        const uint64_t nAvailable =
+            nSize > SHARED_CACHE_HEADER_SIZE ? nSize - SHARED_CACHE_HEADER_SIZE
+                                             : 0;
+        // File properties use 1/32 of the space
+        sHeader.nFilePropSlots =
+            std::max<uint64_t>(
+                N_WAYS, nAvailable / 32 / sHeader.nFilePropSlotSize) /
+            N_WAYS * N_WAYS;
+        const uint64_t nFilePropSize =
+            sHeader.nFilePropSlots * sHeader.nFilePropSlotSize;
+        sHeader.nRegionSlots =
+            nAvailable > nFilePropSize
+                ? (nAvailable - nFilePropSize) / sHeader.nRegionSlotSize /
+                      N_WAYS * N_WAYS
+                : 0;
+        if (sHeader.nRegionSlots == 0)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "CPL_VSIL_CURL_SHARED_CACHE_SIZE is too small. "
+                     "Shared cache will not be used");
+            bOK = false;
+        }
+        sHeader.nTotalSize = SHARED_CACHE_HEADER_SIZE + nFilePropSize +
+                             sHeader.nRegionSlots * sHeader.nRegionSlotSize;
+        if (bOK && (sHeader.nTotalSize !=
+                        static_cast<uint64_t>(static_cast<size_t>(
+                            sHeader.nTotalSize)) ||
+                    ftruncate(m_fd, static_cast<off_t>(sHeader.nTotalSize)) !=
+                        0))
+        {
+            CPLError(CE_Warning, CPLE_FileIO,
+                     "Cannot allocate shared cache %s. It will not be used",
+                     osFilename.c_str());
+            bOK = false;
+        }
+    }
+    else if (bOK)
+    {
+        bOK = static_cast<uint64_t>(sStat.st_size) >=
+                  SHARED_CACHE_HEADER_SIZE &&
+              pread(m_fd, &sHeader, sizeof(sHeader), 0) ==
+                  static_cast<ssize_t>(sizeof(sHeader)) &&
+              memcmp(sHeader.szMagic, SHARED_CACHE_MAGIC,
+                     sizeof(SHARED_CACHE_MAGIC)) == 0 &&
+              sHeader.nVersion == SHARED_CACHE_VERSION &&
+              sHeader.nTotalSize == static_cast<uint64_t>(sStat.st_size) &&
+              sHeader.nRegionSlots >= N_WAYS &&
+              sHeader.nFilePropSlots >= N_WAYS &&
+              sHeader.nRegionSlotSize ==
+                  RoundUp64(sizeof(SlotHeader) + MAX_KEY_SIZE +
+                            MAX_VALIDATOR_SIZE + sHeader.nChunkSize) &&
+              sHeader.nFilePropSlotSize ==
+                  RoundUp64(sizeof(SlotHeader) + MAX_KEY_SIZE +
+                            MAX_VALIDATOR_SIZE + sizeof(SharedFileProp)) &&
+              sHeader.nTotalSize ==
+                  SHARED_CACHE_HEADER_SIZE +
+                      sHeader.nFilePropSlots * sHeader.nFilePropSlotSize +
+                      sHeader.nRegionSlots * sHeader.nRegionSlotSize;
+        if (!bOK)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "%s is not a valid shared cache file. It will not be used",
+                     osFilename.c_str());
+        }
+        else if (sHeader.nChunkSize != static_cast<uint32_t>(nChunkSize))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Shared cache %s has been created with "
+                     "CPL_VSIL_CURL_CHUNK_SIZE=%u, whereas it is %d in this "
+                     "process. It will not be used",
+                     osFilename.c_str(), sHeader.nChunkSize, nChunkSize);
+            bOK = false;
+        }
+    }
+
+    if (bOK)
+    {
+        m_nMappingSize = static_cast<size_t>(sHeader.nTotalSize);
+        void *pMapping = mmap(nullptr, m_nMappingSize, PROT_READ | PROT_WRITE,
+                              MAP_SHARED, m_fd, 0);
+        if (pMapping == MAP_FAILED)
+        {
+            CPLError(CE_Warning, CPLE_FileIO,
+                     "Cannot map shared cache %s: %s. It will not be used",
+                     osFilename.c_str(), strerror(errno));
+            bOK = false;
+        }
+        else
+        {
+            m_pabyMapping = static_cast<GByte *>(pMapping);
+            // The file is zero-initialized by ftruncate(), which is the
+            // valid state of empty slots, so only the header must be written.
+            if (bCreate)
+                memcpy(m_pabyMapping, &sHeader, sizeof(sHeader));
+        }
+    }
+
+    flock(m_fd, LOCK_UN);
+    if (!bOK)
+        return false;
+
+    m_poFileProps = std::make_unique<Table>();
+    m_poFileProps->pabyBase = m_pabyMapping + SHARED_CACHE_HEADER_SIZE;
+    m_poFileProps->nSlots = sHeader.nFilePropSlots;
+    m_poFileProps->nSlotSize = sHeader.nFilePropSlotSize;
+    m_poFileProps->nDataCapacity = sizeof(SharedFileProp);
+
+    m_poRegions = std::make_unique<Table>();
+    m_poRegions->pabyBase = m_poFileProps->pabyBase +
+                            sHeader.nFilePropSlots * sHeader.nFilePropSlotSize;
+    m_poRegions->nSlots = sHeader.nRegionSlots;
+    m_poRegions->nSlotSize = sHeader.nRegionSlotSize;
+    m_poRegions->nDataCapacity = sHeader.nChunkSize;
+
+    CPLDebug("VSICURL",
+             "Using shared cache %s with " CPL_FRMT_GUIB
+             " region slots and " CPL_FRMT_GUIB " file property slots",
+             osFilename.c_str(), static_cast<GUIntBig>(sHeader.nRegionSlots),
+             static_cast<GUIntBig>(sHeader.nFilePropSlots));
+    return true;
+#else
+    CPL_IGNORE_RET_VAL(nSize);
+    CPL_IGNORE_RET_VAL(nChunkSize);
+    CPLError(CE_Warning, CPLE_NotSupported,
+             "CPL_VSIL_CURL_SHARED_CACHE=%s ignored: shared cache is not "
+             "supported on this platform",
+             osFilename.c_str());
+    return false;
+#endif
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+std::shared_ptr<VSICurlSharedCache> VSICurlSharedCache::Get(int nChunkSize)
+{
+    const char *pszFilename =
+        CPLGetConfigOption("CPL_VSIL_CURL_SHARED_CACHE", nullptr);
+    if (pszFilename == nullptr || pszFilename[0] == '\0')
+        return nullptr;
+
+    static std::mutex oMutex;
+    static std::string osCurFilename;
+    static std::shared_ptr<VSICurlSharedCache> poCurCache;
+    static std::string osCurTTL;
+
+    std::lock_guard<std::mutex> oLock(oMutex);
+    if (osCurFilename != pszFilename)
+    {
+        // Failures are also remembered, so that they are reported once
+        osCurFilename = pszFilename;
+        poCurCache.reset();
+
+        GIntBig nSize = static_cast<GIntBig>(SHARED_CACHE_SIZE_DEFAULT);
+        const char *pszSize =
+            CPLGetConfigOption("CPL_VSIL_CURL_SHARED_CACHE_SIZE", nullptr);
+        if (pszSize && (CPLParseMemorySize(pszSize, &nSize, nullptr) !=
+                            CE_None ||
+                        nSize <= 0))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Invalid value for CPL_VSIL_CURL_SHARED_CACHE_SIZE. "
+                     "Using default value of " CPL_FRMT_GUIB " instead.",
+                     static_cast<GUIntBig>(SHARED_CACHE_SIZE_DEFAULT));
+            nSize = static_cast<GIntBig>(SHARED_CACHE_SIZE_DEFAULT);
+        }
+
+        std::shared_ptr<VSICurlSharedCache> poCache(new VSICurlSharedCache());
+        if (poCache->Open(osCurFilename, static_cast<uint64_t>(nSize),
+                          nChunkSize))
+        {
+            poCurCache = std::move(poCache);
+        }
+    }
+
+    // The delay can be changed at any time, for example to force a refresh
+    // of file properties.
+    const char *pszTTL =
+        CPLGetConfigOption("CPL_VSIL_CURL_SHARED_CACHE_TTL", "");
+    if (poCurCache && (osCurTTL != pszTTL || poCurCache->m_nTTL.load() < 0))
+    {
+        osCurTTL = pszTTL;
+        int nTTL = SHARED_CACHE_TTL_DEFAULT;
+        if (pszTTL[0] != '\0')
+        {
+            nTTL = atoi(pszTTL);
+            if (nTTL < 0 || CPLGetValueType(pszTTL) != CPL_VALUE_INTEGER)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Invalid value for CPL_VSIL_CURL_SHARED_CACHE_TTL. "
+                         "Using default value of %d instead.",
+                         SHARED_CACHE_TTL_DEFAULT);
+                nTTL = SHARED_CACHE_TTL_DEFAULT;
+            }
+        }
+        poCurCache->m_nTTL.store(nTTL, std::memory_order_relaxed);
+    }
+    return poCurCache;
+}
+
+/************************************************************************/
+/*                             GetRegion()                              */
+/************************************************************************/
+
+bool VSICurlSharedCache::GetRegion(const std::string &osURL,
+                                   const std::string &osValidator,
+                                   vsi_l_offset nOffset, std::string &osData)
+{
+    // Regions do not expire: they are valid as long as the validator of the
+    // remote file is the same.
+    return m_poRegions->Get(osURL, nOffset, osValidator, -1, osData);
+}
+
+/************************************************************************/
+/*                             AddRegion()                              */
+/************************************************************************/
+
+void VSICurlSharedCache::AddRegion(const std::string &osURL,
+                                   const std::string &osValidator,
+                                   vsi_l_offset nOffset, const char *pData,
+                                   size_t nSize)
+{
+    m_poRegions->Put(osURL, nOffset, osValidator, pData, nSize);
+}
+
+/************************************************************************/
+/*                            GetFileProp()                             */
+/************************************************************************/
+
+bool VSICurlSharedCache::GetFileProp(const std::string &osURL,
+                                     FileProp &oFileProp)
+{
+    std::string osData;
+    if (!m_poFileProps->Get(osURL, 0, std::string(),
+                            m_nTTL.load(std::memory_order_relaxed), osData) ||
+        osData.size() != sizeof(SharedFileProp))
+    {
+        return false;
+    }
+    SharedFileProp sProp;
+    memcpy(&sProp, osData.data(), sizeof(sProp));
+    oFileProp.eExists = EXIST_YES;
+    oFileProp.bHasComputedFileSize = true;
+    oFileProp.nHTTPCode = sProp.nHTTPCode;
+    oFileProp.nMode = sProp.nMode;
+    oFileProp.fileSize = static_cast<vsi_l_offset>(sProp.nFileSize);
+    oFileProp.mTime = static_cast<time_t>(sProp.nMTime);
+    oFileProp.bIsDirectory = sProp.bIsDirectory != 0;
+    oFileProp.bIsAzureFolder = sProp.bIsAzureFolder != 0;
+    oFileProp.ETag.assign(sProp.szETag,
+                          std::min<size_t>(sProp.nETagSize, MAX_ETAG_SIZE));
+    return true;
+}
+
+/************************************************************************/
+/*                            SetFileProp()                             */
+/************************************************************************/
+
+void VSICurlSharedCache::SetFileProp(const std::string &osURL,
+                                     const FileProp &oFileProp)
+{
+    // Only share properties of existing files. Redirections are specific to
+    // a process, and negative results might become stale too easily.
+    if (oFileProp.eExists != EXIST_YES || !oFileProp.bHasComputedFileSize ||
+        !oFileProp.osRedirectURL.empty() ||
+        oFileProp.ETag.size() > MAX_ETAG_SIZE)
+    {
+        return;
+    }
+    SharedFileProp sProp;
+    memset(&sProp, 0, sizeof(sProp));
+    sProp.nHTTPCode = oFileProp.nHTTPCode;
+    sProp.nMode = oFileProp.nMode;
+    sProp.nFileSize = static_cast<uint64_t>(oFileProp.fileSize);
+    sProp.nMTime = static_cast<int64_t>(oFileProp.mTime);
+    sProp.bIsDirectory = oFileProp.bIsDirectory ? 1 : 0;
+    sProp.bIsAzureFolder = oFileProp.bIsAzureFolder ? 1 : 0;
+    sProp.nETagSize = static_cast<uint8_t>(oFileProp.ETag.size());
+    memcpy(sProp.szETag, oFileProp.ETag.data(), oFileProp.ETag.size());
+    m_poFileProps->Put(osURL, 0, std::string(), &sProp, sizeof(sProp));
+}
+
+/************************************************************************/
+/*                             Invalidate()                             */
+/************************************************************************/
+
+void VSICurlSharedCache::Invalidate(const std::string &osURLPrefix,
+                                    bool bExactMatch)
+{
+    m_poFileProps->Invalidate(osURLPrefix, bExactMatch);
+    m_poRegions->Invalidate(osURLPrefix, bExactMatch);
+}
+
+}  // namespace cpl
+
+//! @endcond
+
+#endif  // HAVE_CURL
@@ -0,0 +1,97 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Host-level cache of downloaded regions and file properties of
+ *           /vsicurl/ and related file systems, shared between processes
+ *           through a memory-mapped file.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_VSIL_CURL_SHARED_CACHE_H_INCLUDED
+#define CPL_VSIL_CURL_SHARED_CACHE_H_INCLUDED
+
+#ifdef HAVE_CURL
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+class FileProp;
+
+/************************************************************************/
+/*                          VSICurlSharedCache                          */
+/************************************************************************/
+
+// The file is made of a header followed by two tables of fixed-size slots,
+// one for regions and one for file properties. Slots are grouped in sets of
+// a few ways, selected by a hash of the key. Each slot is protected by a
+// sequence lock living in the mapping, so that readers and writers of
+// different processes never block each other: a reader that races with a
+// writer just gets a cache miss, and a writer that cannot lock a slot just
+// does not cache its data.
+// Regions are stored with the validator of the version of the remote file
+// they come from, and file properties expire after a delay, so that changes
+// of remote files are eventually seen.
+
+class VSICurlSharedCache
+{
+  public:
+    ~VSICurlSharedCache();
+
+    // Returns the cache configured with CPL_VSIL_CURL_SHARED_CACHE, or
+    // nullptr if it is not configured or cannot be used.
+    static std::shared_ptr<VSICurlSharedCache> Get(int nChunkSize);
+
+    // osValidator identifies the version of the remote file (see
+    // VSICurlDiskCache). Regions are only returned for the same validator.
+    bool GetRegion(const std::string &osURL, const std::string &osValidator,
+                   vsi_l_offset nOffset, std::string &osData);
+    void AddRegion(const std::string &osURL, const std::string &osValidator,
+                   vsi_l_offset nOffset, const char *pData, size_t nSize);
+
+    // File properties are returned for CPL_VSIL_CURL_SHARED_CACHE_TTL seconds
+    // after they have been stored.
+    bool GetFileProp(const std::string &osURL, FileProp &oFileProp);
+    void SetFileProp(const std::string &osURL, const FileProp &oFileProp);
+
+    // Invalidate all entries whose URL starts with osURLPrefix
+    // (or is equal to it, if bExactMatch is set).
+    void Invalidate(const std::string &osURLPrefix, bool bExactMatch);
+
+    struct Table;
+
+  private:
+    VSICurlSharedCache() = default;
+    CPL_DISALLOW_COPY_ASSIGN(VSICurlSharedCache)
+
+    bool Open(const std::string &osFilename, uint64_t nSize, int nChunkSize);
+
+    // Set by Get(), from CPL_VSIL_CURL_SHARED_CACHE_TTL.
+    std::atomic<int> m_nTTL{-1};
+    int m_fd = -1;
+    GByte *m_pabyMapping = nullptr;
+    size_t m_nMappingSize = 0;
+    std::unique_ptr<Table> m_poRegions{};
+    std::unique_ptr<Table> m_poFileProps{};
+};
+
+}  // namespace cpl
+
+//! @endcond
+
+#endif  // HAVE_CURL
+
+#endif  // CPL_VSIL_CURL_SHARED_CACHE_H_INCLUDED
@@ -79,6 +79,8 @@
 #endif
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
 #include <limits>
 #include <list>
@@ -93,6 +95,7 @@
 #include "cpl_minizip_ioapi.h"
 #include "cpl_minizip_unzip.h"
 #include "cpl_multiproc.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi_virtual.h"
@@ -144,6 +147,61 @@ typedef struct
     vsi_l_offset out;
 } GZipSnapshot;
 
+/************************************************************************/
+/*                             VSIGZipIndex                             */
+/************************************************************************/
+
+/* Persisted index of access points of a .gz file (CPL_VSIL_GZIP_INDEX=YES),
+   similar to the one of the zran.c example of zlib. An access point is at a
+   deflate block boundary, and records the last 32 KB of uncompressed data
+   before it, used as the dictionary to restart decompression from it.
+   Contrary to snapshots, access points do not need any zlib state, and can
+   thus be saved in a sidecar file, so that random seeks are fast from the
+   first opening of the .gz file after the index has been built.
+
+   Format of the index file (little-endian):
+   - header: "GDALGZIX", version (uint32), number of access points (uint32),
+     size (uint64) and modification time (int64) of the .gz file,
+     uncompressed size (uint64).
+   - one entry per access point, by increasing uncompressed offset:
+     offset in .gz file (uint64), consumed compressed bytes (uint64),
+     uncompressed offset (uint64), CRC32 (uint32), number of bits of the
+     previous byte (uint32), offset of the window in index file (uint64),
+     compressed size (uint32) and size (uint32) of the window.
+   - the windows, compressed with deflate.
+*/
+
+struct VSIGZipIndex
+{
+    struct AccessPoint
+    {
+        vsi_l_offset posInBaseHandle = 0;
+        vsi_l_offset in = 0;
+        vsi_l_offset out = 0;
+        uLong crc = 0;
+        int bits = 0;
+        vsi_l_offset nWindowOffset = 0;
+        uint32_t nWindowCompressedSize = 0;
+        uint32_t nWindowSize = 0;
+    };
+
+    static constexpr const char *SIGNATURE = "GDALGZIX";
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 8 + 4 + 4 + 8 + 8 + 8;
+    static constexpr size_t ENTRY_SIZE = 8 + 8 + 8 + 4 + 4 + 8 + 4 + 4;
+    static constexpr uint32_t WINDOW_SIZE = 32768;
+
+    std::string osFilename{};
+    vsi_l_offset nUncompressedSize = 0;
+    std::vector<AccessPoint> aoPoints{};
+
+    static std::string GetFilename(const char *pszBaseFileName);
+    static std::shared_ptr<VSIGZipIndex>
+    Load(const std::string &osFilename, vsi_l_offset nCompressedSize,
+         GIntBig nMTime);
+    bool ReadWindow(const AccessPoint &oPoint, std::string &osWindow) const;
+};
+
 class VSIGZipHandle final : public VSIVirtualHandle
 {
     VSIVirtualHandleUniquePtr m_poBaseHandle{};
@@ -178,6 +236,24 @@ class VSIGZipHandle final : public VSIVirtualHandle
     vsi_l_offset snapshot_byte_interval =
         0; /* number of compressed bytes at which we create a "snapshot" */
 
+    /* Persisted index of access points (CPL_VSIL_GZIP_INDEX) */
+    std::shared_ptr<const VSIGZipIndex> m_poIndex{}; /* loaded index */
+    bool m_bBuildIndex = false; /* whether an index is being built */
+    std::string m_osIndexFilename{};
+    GIntBig m_nBaseFileMTime = 0;
+    vsi_l_offset m_nIndexSpan = 0; /* uncompressed bytes between points */
+    /* Last 32 KB of uncompressed data, as a circular buffer */
+    std::vector<Byte> m_abyIndexWindow{};
+    vsi_l_offset m_nIndexBuiltOut = 0; /* uncompressed bytes indexed */
+    std::vector<VSIGZipIndex::AccessPoint> m_aoIndexPoints{};
+    std::string m_osIndexWindows{}; /* compressed windows */
+
+    void UpdateIndex(const Bytef *pNewData, vsi_l_offset nOutBefore,
+                     const Bytef *pStart);
+    void AddIndexAccessPoint(const Bytef *pStart);
+    void WriteIndex();
+    bool SeekToIndexAccessPoint(vsi_l_offset &offset);
+
     void check_header();
     int get_byte();
     bool gzseek(vsi_l_offset nOffset, int nWhence);
@@ -211,6 +287,7 @@ class VSIGZipHandle final : public VSIVirtualHandle
 
     VSIGZipHandle *Duplicate();
     bool CloseBaseHandle();
+    void InitIndex();
 
     vsi_l_offset GetLastReadOffset()
     {
@@ -354,8 +431,9 @@ class VSIGZipFilesystemHandler final : public VSIFilesystemHandler
     VSIVirtualHandleUniquePtr Open(const char *pszFilename,
                                    const char *pszAccess, bool bSetError,
                                    CSLConstList /* papszOptions */) override;
-    VSIGZipHandle *OpenGZipReadOnly(const char *pszFilename,
-                                    const char *pszAccess);
+    VSIGZipHandle *
+    OpenGZipReadOnly(const char *pszFilename, const char *pszAccess,
+                     VSIVirtualHandleUniquePtr poBaseHandle = nullptr);
     int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
              int nFlags) override;
     char **ReadDirEx(const char *pszDirname, int nMaxFiles) override;
@@ -402,6 +480,14 @@ VSIGZipHandle *VSIGZipHandle::Duplicate()
     }
 
     poHandle->m_nLastReadOffset = m_nLastReadOffset;
+    poHandle->m_poIndex = m_poIndex;
+    if (m_bBuildIndex || m_poIndex)
+    {
+        poHandle->m_osIndexFilename = m_osIndexFilename;
+        poHandle->m_nBaseFileMTime = m_nBaseFileMTime;
+        poHandle->m_nIndexSpan = m_nIndexSpan;
+        poHandle->m_bBuildIndex = m_poIndex == nullptr;
+    }
 
     // Most important: duplicate the snapshots!
 
@@ -897,6 +983,15 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         }
     }
 
+    if (m_poIndex && offset > 0)
+    {
+        if (!SeekToIndexAccessPoint(offset))
+        {
+            CPL_VSIL_GZ_RETURN(FALSE);
+            return false;
+        }
+    }
+
     // Offset is now the number of bytes to skip.
 
     if (offset != 0 && outbuf == nullptr)
@@ -1111,202 +1206,1874 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nBytes)
                     m_nLastReadOffset = out;
             }
 
-            errno = 0;
-            stream.avail_in =
-                static_cast<uInt>(m_poBaseHandle->Read(inbuf, Z_BUFSIZE));
-#ifdef ENABLE_DEBUG
-            CPLDebug("GZIP", CPL_FRMT_GUIB " " CPL_FRMT_GUIB,
-                     m_poBaseHandle->Tell(), offsetEndCompressedData);
-#endif
-            if (m_poBaseHandle->Tell() > offsetEndCompressedData)
+            errno = 0;
+            stream.avail_in =
+                static_cast<uInt>(m_poBaseHandle->Read(inbuf, Z_BUFSIZE));
+#ifdef ENABLE_DEBUG
+            CPLDebug("GZIP", CPL_FRMT_GUIB " " CPL_FRMT_GUIB,
+                     m_poBaseHandle->Tell(), offsetEndCompressedData);
+#endif
+            if (m_poBaseHandle->Tell() > offsetEndCompressedData)
+            {
+#ifdef ENABLE_DEBUG
+                CPLDebug("GZIP", "avail_in before = %d", stream.avail_in);
+#endif
+                stream.avail_in = stream.avail_in -
+                                  static_cast<uInt>(m_poBaseHandle->Tell() -
+                                                    offsetEndCompressedData);
+                if (m_poBaseHandle->Seek(offsetEndCompressedData, SEEK_SET) !=
+                    0)
+                    CPLError(CE_Failure, CPLE_FileIO, "Seek() failed");
+#ifdef ENABLE_DEBUG
+                CPLDebug("GZIP", "avail_in after = %d", stream.avail_in);
+#endif
+            }
+            if (stream.avail_in == 0)
+            {
+                z_eof = 1;
+                if (m_poBaseHandle->Error() ||
+                    m_poBaseHandle->Tell() != offsetEndCompressedData)
+                {
+                    z_err = Z_ERRNO;
+                    break;
+                }
+            }
+            stream.next_in = inbuf;
+        }
+        in += stream.avail_in;
+        out += stream.avail_out;
+        const Bytef *pBeforeInflate = stream.next_out;
+        const vsi_l_offset nOutBeforeInflate = out - stream.avail_out;
+        // When building an index, stop at the end of each deflate block,
+        // where access points can be created.
+        z_err = inflate(&(stream), m_bBuildIndex ? Z_BLOCK : Z_NO_FLUSH);
+        in -= stream.avail_in;
+        out -= stream.avail_out;
+        if (m_bBuildIndex)
+            UpdateIndex(pBeforeInflate, nOutBeforeInflate, pStart);
+
+        if (z_err == Z_STREAM_END && m_compressed_size != 2)
+        {
+            // Check CRC and original size.
+            crc =
+                crc32(crc, pStart, static_cast<uInt>(stream.next_out - pStart));
+            pStart = stream.next_out;
+            if (m_expected_crc)
+            {
+#ifdef ENABLE_DEBUG
+                CPLDebug("GZIP", "Computed CRC = %X. Expected CRC = %X",
+                         static_cast<unsigned int>(crc),
+                         static_cast<unsigned int>(m_expected_crc));
+#endif
+            }
+            if (m_expected_crc != 0 && m_expected_crc != crc)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "CRC error. Got %X instead of %X",
+                         static_cast<unsigned int>(crc),
+                         static_cast<unsigned int>(m_expected_crc));
+                z_err = Z_DATA_ERROR;
+            }
+            else if (m_expected_crc == 0)
+            {
+                const uLong read_crc = static_cast<unsigned long>(getLong());
+                if (read_crc != crc)
+                {
+                    CPLError(CE_Failure, CPLE_FileIO,
+                             "CRC error. Got %X instead of %X",
+                             static_cast<unsigned int>(crc),
+                             static_cast<unsigned int>(read_crc));
+                    z_err = Z_DATA_ERROR;
+                }
+                else
+                {
+                    CPL_IGNORE_RET_VAL(getLong());
+                    // The uncompressed length returned by above getlong() may
+                    // be different from out in case of concatenated .gz files.
+                    // Check for such files:
+                    check_header();
+                    if (z_err == Z_OK)
+                    {
+                        inflateReset(&(stream));
+                        crc = 0;
+                    }
+                }
+            }
+        }
+        if (z_err != Z_OK || z_eof)
+            break;
+    }
+    crc = crc32(crc, pStart, static_cast<uInt>(stream.next_out - pStart));
+
+    // The whole stream has been decompressed contiguously
+    if (m_bBuildIndex && z_err == Z_STREAM_END && m_nIndexBuiltOut == out)
+        WriteIndex();
+
+    unsigned ret = len - stream.avail_out;
+    if (z_err != Z_OK && z_err != Z_STREAM_END)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "In file %s, at line %d, decompression failed with "
+                 "z_err = %d, return = %u",
+                 __FILE__, __LINE__, z_err, ret);
+    }
+    else if (ret < nBytes)
+    {
+        m_bEOF = true;
+    }
+
+#ifdef ENABLE_DEBUG
+    CPLDebug("GZIP", "Read return %u (z_err=%d, z_eof=%d)", ret, z_err, z_eof);
+#endif
+    return ret;
+}
+
+/************************************************************************/
+/*                      VSIGZipIndex::GetFilename()                     */
+/************************************************************************/
+
+// Returns the name of the index file of a .gz file: next to it, or in the
+// directory pointed by CPL_VSIL_GZIP_INDEX_DIR, in which case a hash of the
+// full path avoids collisions between files with the same name.
+
+std::string VSIGZipIndex::GetFilename(const char *pszBaseFileName)
+{
+    const char *pszDir = CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0')
+        return std::string(pszBaseFileName).append(".gzidx");
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(pszBaseFileName, strlen(pszBaseFileName), abyHash);
+    char *pszHex = CPLBinaryToHex(8, abyHash);
+    const std::string osName = std::string(CPLGetFilename(pszBaseFileName))
+                                   .append("_")
+                                   .append(pszHex)
+                                   .append(".gzidx");
+    CPLFree(pszHex);
+    return CPLFormFilenameSafe(pszDir, osName.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                         VSIGZipIndex::Load()                         */
+/************************************************************************/
+
+std::shared_ptr<VSIGZipIndex>
+VSIGZipIndex::Load(const std::string &osFilename, vsi_l_offset nCompressedSize,
+                   GIntBig nMTime)
+{
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+    if (!fp)
+        return nullptr;
+
+    GByte abyHeader[HEADER_SIZE];
+    if (fp->Read(abyHeader, HEADER_SIZE) != HEADER_SIZE ||
+        memcmp(abyHeader, SIGNATURE, 8) != 0)
+    {
+        return nullptr;
+    }
+    const auto GetUInt32 = [](const GByte *pabyData)
+    {
+        uint32_t nVal;
+        memcpy(&nVal, pabyData, sizeof(nVal));
+        CPL_LSBPTR32(&nVal);
+        return nVal;
+    };
+    const auto GetUInt64 = [](const GByte *pabyData)
+    {
+        uint64_t nVal;
+        memcpy(&nVal, pabyData, sizeof(nVal));
+        CPL_LSBPTR64(&nVal);
+        return nVal;
+    };
+    const uint32_t nPoints = GetUInt32(abyHeader + 12);
+    // Reject an index built for another version of the .gz file
+    if (GetUInt32(abyHeader + 8) != VERSION ||
+        GetUInt64(abyHeader + 16) != nCompressedSize ||
+        static_cast<GIntBig>(GetUInt64(abyHeader + 24)) != nMTime)
+    {
+        CPLDebug("GZIP", "Ignoring outdated index %s", osFilename.c_str());
+        return nullptr;
+    }
+
+    if (fp->Seek(0, SEEK_END) != 0)
+        return nullptr;
+    const vsi_l_offset nFileSize = fp->Tell();
+    const vsi_l_offset nWindowsOffset =
+        HEADER_SIZE + static_cast<vsi_l_offset>(nPoints) * ENTRY_SIZE;
+    if (nWindowsOffset > nFileSize)
+        return nullptr;
+
+    std::vector<GByte> abyEntries;
+    try
+    {
+        abyEntries.resize(static_cast<size_t>(nPoints) * ENTRY_SIZE);
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+    if (fp->Seek(HEADER_SIZE, SEEK_SET) != 0 ||
+        fp->Read(abyEntries.data(), abyEntries.size()) != abyEntries.size())
+    {
+        return nullptr;
+    }
+
+    auto poIndex = std::make_shared<VSIGZipIndex>();
+    poIndex->osFilename = osFilename;
+    poIndex->nUncompressedSize = GetUInt64(abyHeader + 32);
+    poIndex->aoPoints.resize(nPoints);
+    for (uint32_t i = 0; i < nPoints; ++i)
+    {
+        const GByte *pabyEntry = abyEntries.data() + i * ENTRY_SIZE;
+        auto &oPoint = poIndex->aoPoints[i];
+        oPoint.posInBaseHandle = GetUInt64(pabyEntry);
+        oPoint.in = GetUInt64(pabyEntry + 8);
+        oPoint.out = GetUInt64(pabyEntry + 16);
+        oPoint.crc = GetUInt32(pabyEntry + 24);
+        oPoint.bits = static_cast<int>(GetUInt32(pabyEntry + 28));
+        oPoint.nWindowOffset = GetUInt64(pabyEntry + 32);
+        oPoint.nWindowCompressedSize = GetUInt32(pabyEntry + 40);
+        oPoint.nWindowSize = GetUInt32(pabyEntry + 44);
+        if (oPoint.posInBaseHandle == 0 ||
+            oPoint.posInBaseHandle > nCompressedSize || oPoint.bits > 7 ||
+            oPoint.out > poIndex->nUncompressedSize ||
+            (i > 0 && oPoint.out <= poIndex->aoPoints[i - 1].out) ||
+            oPoint.nWindowSize > WINDOW_SIZE ||
+            oPoint.nWindowOffset < nWindowsOffset ||
+            oPoint.nWindowOffset > nFileSize ||
+            oPoint.nWindowCompressedSize > nFileSize - oPoint.nWindowOffset)
+        {
+            CPLDebug("GZIP", "Invalid index %s", osFilename.c_str());
+            return nullptr;
+        }
+    }
+    return poIndex;
+}
+
+/************************************************************************/
+/*                      VSIGZipIndex::ReadWindow()                      */
+/************************************************************************/
+
+bool VSIGZipIndex::ReadWindow(const AccessPoint &oPoint,
+                              std::string &osWindow) const
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+    if (!fp)
+        return false;
+    std::string osCompressed;
+    osCompressed.resize(oPoint.nWindowCompressedSize);
+    osWindow.resize(oPoint.nWindowSize);
+    size_t nOutBytes = 0;
+    return fp->Seek(oPoint.nWindowOffset, SEEK_SET) == 0 &&
+           fp->Read(osCompressed.data(), osCompressed.size()) ==
+               osCompressed.size() &&
+           (oPoint.nWindowSize == 0 ||
+            (CPLZLibInflate(osCompressed.data(), osCompressed.size(),
+                            osWindow.data(), osWindow.size(),
+                            &nOutBytes) != nullptr &&
+             nOutBytes == osWindow.size()));
+}
+
+/************************************************************************/
+/*                             InitIndex()                              */
+/************************************************************************/
+
+// Loads the index of access points of the .gz file if it is up to date, or
+// otherwise prepares for building it while the file is read sequentially.
+
+void VSIGZipHandle::InitIndex()
+{
+    if (m_transparent || m_pszBaseFileName == nullptr)
+        return;
+    VSIStatBufL sStat;
+    if (VSIStatL(m_pszBaseFileName, &sStat) != 0)
+        return;
+    m_nBaseFileMTime = static_cast<GIntBig>(sStat.st_mtime);
+    m_osIndexFilename = VSIGZipIndex::GetFilename(m_pszBaseFileName);
+    GIntBig nSpan = 4 * 1024 * 1024;
+    if (const char *pszSpan =
+            CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_SPAN", nullptr))
+    {
+        bool bUnitSpecified = false;
+        if (CPLParseMemorySize(pszSpan, &nSpan, &bUnitSpecified) != CE_None ||
+            nSpan <= 0)
+        {
+            nSpan = 4 * 1024 * 1024;
+        }
+    }
+    m_nIndexSpan = static_cast<vsi_l_offset>(nSpan);
+
+    m_poIndex = VSIGZipIndex::Load(m_osIndexFilename, m_compressed_size,
+                                   m_nBaseFileMTime);
+    if (m_poIndex)
+    {
+        CPLDebug("GZIP", "Using index %s with %u access points",
+                 m_osIndexFilename.c_str(),
+                 static_cast<unsigned>(m_poIndex->aoPoints.size()));
+        if (m_uncompressed_size == 0)
+            m_uncompressed_size = m_poIndex->nUncompressedSize;
+    }
+    else
+    {
+        m_bBuildIndex = true;
+    }
+}
+
+/************************************************************************/
+/*                            UpdateIndex()                             */
+/************************************************************************/
+
+// Called after each inflate() call while the index is built, with the
+// uncompressed data it produced, to maintain the window of the last 32 KB of
+// uncompressed data, and to create an access point when inflate() stopped at
+// a deflate block boundary. Only data beyond what has already been indexed
+// is taken into account, so that the index is built correctly whatever the
+// order of reads, as soon as the whole file has been read.
+
+void VSIGZipHandle::UpdateIndex(const Bytef *pNewData, vsi_l_offset nOutBefore,
+                                const Bytef *pStart)
+{
+    const vsi_l_offset nOutAfter = out;
+    if (nOutBefore > m_nIndexBuiltOut || nOutAfter < m_nIndexBuiltOut)
+        return;
+
+    constexpr size_t WINDOW_SIZE = VSIGZipIndex::WINDOW_SIZE;
+    if (m_abyIndexWindow.empty())
+        m_abyIndexWindow.resize(WINDOW_SIZE);
+    const size_t nSkip = static_cast<size_t>(m_nIndexBuiltOut - nOutBefore);
+    const size_t nNew = static_cast<size_t>(nOutAfter - m_nIndexBuiltOut);
+    const Bytef *pabyNew = pNewData + nSkip;
+    // Only the last WINDOW_SIZE bytes matter
+    const size_t nToCopy = std::min(nNew, WINDOW_SIZE);
+    size_t nPos = static_cast<size_t>((nOutAfter - nToCopy) % WINDOW_SIZE);
+    const size_t nFirst = std::min(nToCopy, WINDOW_SIZE - nPos);
+    memcpy(m_abyIndexWindow.data() + nPos, pabyNew + nNew - nToCopy, nFirst);
+    memcpy(m_abyIndexWindow.data(), pabyNew + nNew - nToCopy + nFirst,
+           nToCopy - nFirst);
+    m_nIndexBuiltOut = nOutAfter;
+
+    const vsi_l_offset nLastPointOut =
+        m_aoIndexPoints.empty() ? 0 : m_aoIndexPoints.back().out;
+    if (z_err == Z_OK && (stream.data_type & 128) != 0 &&
+        (stream.data_type & 64) == 0 && out - nLastPointOut >= m_nIndexSpan)
+    {
+        AddIndexAccessPoint(pStart);
+    }
+}
+
+/************************************************************************/
+/*                        AddIndexAccessPoint()                         */
+/************************************************************************/
+
+void VSIGZipHandle::AddIndexAccessPoint(const Bytef *pStart)
+{
+    constexpr size_t WINDOW_SIZE = VSIGZipIndex::WINDOW_SIZE;
+    VSIGZipIndex::AccessPoint oPoint;
+    oPoint.posInBaseHandle = m_poBaseHandle->Tell() - stream.avail_in;
+    oPoint.in = in;
+    oPoint.out = out;
+    oPoint.crc =
+        crc32(crc, pStart, static_cast<uInt>(stream.next_out - pStart));
+    oPoint.bits = stream.data_type & 7;
+
+    // Unroll the circular window
+    const size_t nWindowSize =
+        static_cast<size_t>(std::min<vsi_l_offset>(out, WINDOW_SIZE));
+    std::vector<Byte> abyWindow(nWindowSize);
+    const size_t nPos = static_cast<size_t>((out - nWindowSize) % WINDOW_SIZE);
+    const size_t nFirst = std::min(nWindowSize, WINDOW_SIZE - nPos);
+    memcpy(abyWindow.data(), m_abyIndexWindow.data() + nPos, nFirst);
+    memcpy(abyWindow.data() + nFirst, m_abyIndexWindow.data(),
+           nWindowSize - nFirst);
+
+    size_t nCompressedSize = 0;
+    void *pCompressed =
+        CPLZLibDeflate(abyWindow.data(), abyWindow.size(), -1, nullptr, 0,
+                       &nCompressedSize);
+    if (pCompressed == nullptr)
+    {
+        // Abandon the index rather than producing an incomplete one
+        m_bBuildIndex = false;
+        m_aoIndexPoints.clear();
+        m_osIndexWindows.clear();
+        return;
+    }
+    oPoint.nWindowOffset = m_osIndexWindows.size();
+    oPoint.nWindowCompressedSize = static_cast<uint32_t>(nCompressedSize);
+    oPoint.nWindowSize = static_cast<uint32_t>(nWindowSize);
+    m_osIndexWindows.append(static_cast<const char *>(pCompressed),
+                            nCompressedSize);
+    CPLFree(pCompressed);
+    m_aoIndexPoints.push_back(oPoint);
+}
+
+/************************************************************************/
+/*                             WriteIndex()                             */
+/************************************************************************/
+
+// Writes the index once the whole file has been decompressed, and uses it
+// from now on.
+
+void VSIGZipHandle::WriteIndex()
+{
+    m_bBuildIndex = false;
+
+    std::string osData;
+    const auto AddUInt32 = [&osData](uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        osData.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+    const auto AddUInt64 = [&osData](uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        osData.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+    osData.append(VSIGZipIndex::SIGNATURE, 8);
+    AddUInt32(VSIGZipIndex::VERSION);
+    AddUInt32(static_cast<uint32_t>(m_aoIndexPoints.size()));
+    AddUInt64(m_compressed_size);
+    AddUInt64(static_cast<uint64_t>(m_nBaseFileMTime));
+    AddUInt64(out);
+    const vsi_l_offset nWindowsOffset =
+        VSIGZipIndex::HEADER_SIZE +
+        m_aoIndexPoints.size() * VSIGZipIndex::ENTRY_SIZE;
+    for (const auto &oPoint : m_aoIndexPoints)
+    {
+        AddUInt64(oPoint.posInBaseHandle);
+        AddUInt64(oPoint.in);
+        AddUInt64(oPoint.out);
+        AddUInt32(static_cast<uint32_t>(oPoint.crc));
+        AddUInt32(static_cast<uint32_t>(oPoint.bits));
+        AddUInt64(nWindowsOffset + oPoint.nWindowOffset);
+        AddUInt32(oPoint.nWindowCompressedSize);
+        AddUInt32(oPoint.nWindowSize);
+    }
+    osData += m_osIndexWindows;
+
+    m_aoIndexPoints.clear();
+    m_osIndexWindows.clear();
+    m_abyIndexWindow.clear();
+    m_abyIndexWindow.shrink_to_fit();
+
+    // Write to a temporary file first, so that concurrent readers never see
+    // a partial index.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    const std::string osTmpFilename = m_osIndexFilename + ".tmp";
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLDebug("GZIP", "Cannot create index %s", m_osIndexFilename.c_str());
+        return;
+    }
+    const bool bOK =
+        VSIFWriteL(osData.data(), 1, osData.size(), fp) == osData.size();
+    if (VSIFCloseL(fp) != 0 || !bOK ||
+        VSIRename(osTmpFilename.c_str(), m_osIndexFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+    CPLDebug("GZIP", "Index %s written", m_osIndexFilename.c_str());
+    m_poIndex = VSIGZipIndex::Load(m_osIndexFilename, m_compressed_size,
+                                   m_nBaseFileMTime);
+}
+
+/************************************************************************/
+/*                       SeekToIndexAccessPoint()                       */
+/************************************************************************/
+
+// Called by gzseek() with the number of bytes to skip from the current
+// position. If the index has an access point between the current position
+// and the target one, restarts decompression from it.
+
+bool VSIGZipHandle::SeekToIndexAccessPoint(vsi_l_offset &offset)
+{
+    const vsi_l_offset nTarget = out + offset;
+    const auto &aoPoints = m_poIndex->aoPoints;
+    auto oIter = std::upper_bound(
+        aoPoints.begin(), aoPoints.end(), nTarget,
+        [](vsi_l_offset nVal, const VSIGZipIndex::AccessPoint &oPoint)
+        { return nVal < oPoint.out; });
+    if (oIter == aoPoints.begin())
+        return true;
+    const auto &oPoint = *std::prev(oIter);
+    // Not worth it if the point is before the current position, or the
+    // closest snapshot.
+    if (oPoint.out <= out)
+        return true;
+
+#ifdef ENABLE_DEBUG
+    CPLDebug("GZIP",
+             "using access point at out=" CPL_FRMT_GUIB
+             " for target " CPL_FRMT_GUIB,
+             oPoint.out, nTarget);
+#endif
+
+    std::string osWindow;
+    if (!m_poIndex->ReadWindow(oPoint, osWindow))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read index %s",
+                 m_poIndex->osFilename.c_str());
+        z_err = Z_ERRNO;
+        return false;
+    }
+
+    GByte nPrevByte = 0;
+    if (m_poBaseHandle->Seek(oPoint.posInBaseHandle - (oPoint.bits ? 1 : 0),
+                             SEEK_SET) != 0 ||
+        (oPoint.bits && m_poBaseHandle->Read(&nPrevByte, 1) != 1))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Seek() failed");
+        z_err = Z_ERRNO;
+        return false;
+    }
+    // Also resets the stream if it was restored from a snapshot with
+    // inflateCopy()
+    if (inflateReset(&stream) != Z_OK ||
+        (oPoint.bits &&
+         inflatePrime(&stream, oPoint.bits,
+                      nPrevByte >> (8 - oPoint.bits)) != Z_OK) ||
+        inflateSetDictionary(
+            &stream, reinterpret_cast<const Bytef *>(osWindow.data()),
+            static_cast<uInt>(osWindow.size())) != Z_OK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot restore access point");
+        z_err = Z_DATA_ERROR;
+        return false;
+    }
+    stream.avail_in = 0;
+    stream.next_in = inbuf;
+    crc = oPoint.crc;
+    in = oPoint.in;
+    out = oPoint.out;
+    z_err = Z_OK;
+    z_eof = 0;
+    offset = nTarget - oPoint.out;
+    return true;
+}
+
+/************************************************************************/
+/*                              getLong()                               */
+/************************************************************************/
+
+uLong VSIGZipHandle::getLong()
+{
+    uLong x = static_cast<uLong>(get_byte()) & 0xFF;
+
+    x += (static_cast<uLong>(get_byte()) & 0xFF) << 8;
+    x += (static_cast<uLong>(get_byte()) & 0xFF) << 16;
+    const int c = get_byte();
+    if (c == EOF)
+    {
+        z_err = Z_DATA_ERROR;
+        return 0;
+    }
+    x += static_cast<uLong>(c) << 24;
+    // coverity[overflow_sink]
+    return x;
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+size_t VSIGZipHandle::Write(const void * /* pBuffer */, size_t /* nBytes */)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "VSIFWriteL is not supported on GZip streams");
+    return 0;
+}
+
+/************************************************************************/
+/*                                Eof()                                 */
+/************************************************************************/
+
+int VSIGZipHandle::Eof()
+{
+#ifdef ENABLE_DEBUG
+    CPLDebug("GZIP", "Eof()");
+#endif
+    return m_bEOF;
+}
+
+/************************************************************************/
+/*                               Error()                                */
+/************************************************************************/
+
+int VSIGZipHandle::Error()
+{
+#ifdef ENABLE_DEBUG
+    CPLDebug("GZIP", "Error()");
+#endif
+    return z_err != Z_OK && z_err != Z_STREAM_END;
+}
+
+/************************************************************************/
+/*                              ClearErr()                              */
+/************************************************************************/
+
+void VSIGZipHandle::ClearErr()
+{
+    m_poBaseHandle->ClearErr();
+    z_eof = 0;
+    m_bEOF = false;
+    z_err = Z_OK;
+}
+
+/************************************************************************/
+/*                               Flush()                                */
+/************************************************************************/
+
+int VSIGZipHandle::Flush()
+{
+    return 0;
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSIGZipHandle::Close()
+{
+    return 0;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                         VSIGZipReadHandleMT                          */
+/* ==================================================================== */
+/************************************************************************/
+
+/* Multi-threaded sequential reader of .gz files made of several gzip members,
+   such as BGZF files (as used by bioinformatics tools) or concatenations of
+   .gz files, or of .gz files with an up-to-date index of access points
+   (CPL_VSIL_GZIP_INDEX).
+
+   Members can be decompressed independently of each other, but their
+   boundaries are only known by decompressing the previous member. The
+   compressed stream is thus split into segments of at least
+   MIN_SEGMENT_SIZE bytes, starting at positions that look like a gzip
+   header, and each segment is decompressed by a worker thread, in which
+   CRCs and sizes of its members are checked. A segment start is confirmed
+   by the previous segment ending exactly there. When it does not, because
+   compressed data happened to look like a gzip header, the two segments are
+   merged and decompressed again. When an index is available, segments
+   start at its access points instead.
+
+   The uncompressed data of a segment is limited to MAX_JOB_OUTPUT_SIZE
+   bytes: the members beyond it are left to another job, submitted once the
+   segment has been consumed.
+
+   When no member start is found in MAX_SEGMENT_SIZE bytes, a single member
+   exceeds MAX_JOB_OUTPUT_SIZE bytes, or the stream is truncated, reading
+   continues with a VSIGZipHandle from the start of the current member.
+*/
+
+class VSIGZipReadHandleMT final : public VSIVirtualHandle
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIGZipReadHandleMT)
+
+    static constexpr size_t PROBE_SIZE = 64 * 1024;
+    static constexpr size_t MIN_SEGMENT_SIZE = 1024 * 1024;
+    static constexpr size_t MAX_SEGMENT_SIZE = 64 * 1024 * 1024;
+    static constexpr size_t MAX_JOB_OUTPUT_SIZE = 16 * 1024 * 1024;
+    // Limit of uncompressed data of the jobs in flight
+    static constexpr size_t MAX_OUTPUT_IN_FLIGHT = 512 * 1024 * 1024;
+    // Compressed bytes after an access point, so that inflate() reaches it
+    static constexpr size_t ACCESS_POINT_MARGIN = 64;
+
+    enum class Status
+    {
+        PENDING,
+        OK,        // all members of the segment decompressed and checked
+        END,       // non-gzip data after the last member: ignored
+        TRUNCATED, // segment ends in the middle of a member
+        PARTIAL,   // output limit reached after nConsumed compressed bytes
+        ERROR,     // corrupted data
+        FALLBACK,  // continue with a VSIGZipHandle at nStartOffset
+    };
+
+    struct Job
+    {
+        VSIGZipReadHandleMT *poParent = nullptr;
+        vsi_l_offset nStartOffset = 0;
+        std::string osCompressed{};
+        // If true, no decompression: just continue with a VSIGZipHandle
+        bool bFallbackOnly = false;
+        // Segment of an index: it starts at psPoint (or at the start of the
+        // file if null), and has nExpectedSize uncompressed bytes.
+        bool bIndexed = false;
+        const VSIGZipIndex::AccessPoint *psPoint = nullptr;
+        size_t nExpectedSize = 0;
+
+        Status eStatus = Status::PENDING;
+        std::string osUncompressed{};
+        size_t nConsumed = 0;  // when eStatus == Status::PARTIAL
+    };
+
+    VSIGZipFilesystemHandler *m_poFS = nullptr;
+    const std::string m_osFilename;  // with /vsigzip/ prefix
+    VSIVirtualHandleUniquePtr m_poBaseHandle{};
+    vsi_l_offset m_nFileSize = 0;
+    const int m_nThreads;
+    const int m_nMaxJobsInFlight;
+    CPLJobQueuePtr m_poJobQueue{};
+
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<std::unique_ptr<Job>> m_apoJobs{};
+
+    // Compressed data after the last submitted segment
+    std::string m_osScanBuffer{};
+    vsi_l_offset m_nScanBufferOffset = 0;
+    bool m_bScanEOF = false;
+
+    // Index of access points, and number of its segments submitted
+    std::shared_ptr<const VSIGZipIndex> m_poIndex{};
+    size_t m_nIndexSegmentsSubmitted = 0;
+
+    // Uncompressed data being served
+    std::unique_ptr<Job> m_poCurJob{};
+    size_t m_nCurJobPos = 0;
+
+    // Once set, reads are forwarded to it
+    std::unique_ptr<VSIGZipHandle> m_poSeqHandle{};
+    vsi_l_offset m_nSeqHandleOffset = 0;  // uncompressed offset of its start
+
+    vsi_l_offset m_nOffset = 0;
+    int m_nBackwardSeeks = 0;
+    bool m_bEOF = false;
+    bool m_bError = false;
+
+    static void DecompressSegment(void *pData);
+    static Status DecompressIndexedSegment(Job *psJob);
+    bool LoadIndex();
+    bool Probe();
+    bool ReadCompressed(size_t nMinSize);
+    size_t FindSegmentEnd(size_t nStartScan) const;
+    void SubmitJobs();
+    void SubmitIndexedJobs();
+    void SubmitJob(std::unique_ptr<Job> poJob, bool bFront);
+    void WaitForJob(Job *psJob);
+    bool NextJob();
+    bool StartSeqHandle(vsi_l_offset nCompressedOffset);
+    void Restart();
+    void Stop();
+
+  public:
+    VSIGZipReadHandleMT(VSIGZipFilesystemHandler *poFS,
+                        const char *pszFilename,
+                        VSIVirtualHandleUniquePtr poBaseHandle,
+                        vsi_l_offset nFileSize, int nThreads);
+    ~VSIGZipReadHandleMT() override;
+
+    static VSIGZipReadHandleMT *Create(VSIGZipFilesystemHandler *poFS,
+                                       const char *pszFilename, int nThreads,
+                                       VSIVirtualHandleUniquePtr &poBaseHandle);
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+    vsi_l_offset Tell() override;
+    size_t Read(void *pBuffer, size_t nBytes) override;
+
+    size_t Write(const void *, size_t) override
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "VSIFWriteL is not supported on GZip streams");
+        return 0;
+    }
+
+    int Eof() override;
+    int Error() override;
+    void ClearErr() override;
+
+    int Close() override
+    {
+        return 0;
+    }
+};
+
+/************************************************************************/
+/*                          ParseGZipHeader()                           */
+/************************************************************************/
+
+enum class GZipHeaderStatus
+{
+    OK,
+    INCOMPLETE,
+    INVALID
+};
+
+// Parses the gzip header at the start of pabyData, and returns its size in
+// nHeaderSize.
+
+static GZipHeaderStatus ParseGZipHeader(const GByte *pabyData, size_t nSize,
+                                        size_t &nHeaderSize)
+{
+    constexpr size_t FIXED_HEADER_SIZE = 10;
+    if (nSize < FIXED_HEADER_SIZE)
+    {
+        return (nSize >= 1 && pabyData[0] != gz_magic[0]) ||
+                       (nSize >= 2 && pabyData[1] != gz_magic[1])
+                   ? GZipHeaderStatus::INVALID
+                   : GZipHeaderStatus::INCOMPLETE;
+    }
+    const int flags = pabyData[3];
+    if (pabyData[0] != gz_magic[0] || pabyData[1] != gz_magic[1] ||
+        pabyData[2] != Z_DEFLATED || (flags & RESERVED) != 0)
+    {
+        return GZipHeaderStatus::INVALID;
+    }
+    size_t nPos = FIXED_HEADER_SIZE;
+    if ((flags & EXTRA_FIELD) != 0)
+    {
+        if (nSize < nPos + 2)
+            return GZipHeaderStatus::INCOMPLETE;
+        nPos += 2 + (pabyData[nPos] | (pabyData[nPos + 1] << 8));
+    }
+    for (const int nFlag : {ORIG_NAME, COMMENT})
+    {
+        if ((flags & nFlag) != 0)
+        {
+            if (nPos >= nSize)
+                return GZipHeaderStatus::INCOMPLETE;
+            const void *pZero = memchr(pabyData + nPos, 0, nSize - nPos);
+            if (pZero == nullptr)
+                return GZipHeaderStatus::INCOMPLETE;
+            nPos = static_cast<const GByte *>(pZero) - pabyData + 1;
+        }
+    }
+    if ((flags & HEAD_CRC) != 0)
+        nPos += 2;
+    if (nPos > nSize)
+        return GZipHeaderStatus::INCOMPLETE;
+    nHeaderSize = nPos;
+    return GZipHeaderStatus::OK;
+}
+
+/************************************************************************/
+/*                            ComputeCRC32()                            */
+/************************************************************************/
+
+static uint32_t ComputeCRC32(const char *pData, size_t nSize)
+{
+    uLong nCRC = crc32(0, nullptr, 0);
+    while (nSize > 0)
+    {
+        const uInt nChunk = static_cast<uInt>(std::min<size_t>(nSize, INT_MAX));
+        nCRC = crc32(nCRC, reinterpret_cast<const Bytef *>(pData), nChunk);
+        pData += nChunk;
+        nSize -= nChunk;
+    }
+    return static_cast<uint32_t>(nCRC);
+}
+
+/************************************************************************/
+/*                       IsLikelyGZipHeaderStart()                      */
+/************************************************************************/
+
+// Whether the 10 bytes at pabyData look like the fixed part of a gzip
+// header, including plausible XFL and OS values to limit false positives in
+// compressed data.
+
+static bool IsLikelyGZipHeaderStart(const GByte *pabyData)
+{
+    return pabyData[0] == gz_magic[0] && pabyData[1] == gz_magic[1] &&
+           pabyData[2] == Z_DEFLATED && (pabyData[3] & RESERVED) == 0 &&
+           (pabyData[8] == 0 || pabyData[8] == 2 || pabyData[8] == 4) &&
+           (pabyData[9] <= 13 || pabyData[9] == 255);
+}
+
+/************************************************************************/
+/*                        VSIGZipReadHandleMT()                         */
+/************************************************************************/
+
+VSIGZipReadHandleMT::VSIGZipReadHandleMT(VSIGZipFilesystemHandler *poFS,
+                                         const char *pszFilename,
+                                         VSIVirtualHandleUniquePtr poBaseHandle,
+                                         vsi_l_offset nFileSize, int nThreads)
+    : m_poFS(poFS), m_osFilename(pszFilename),
+      m_poBaseHandle(std::move(poBaseHandle)), m_nFileSize(nFileSize),
+      m_nThreads(nThreads),
+      m_nMaxJobsInFlight(std::max(
+          2, std::min(2 * nThreads, static_cast<int>(MAX_OUTPUT_IN_FLIGHT /
+                                                     MAX_JOB_OUTPUT_SIZE))))
+{
+}
+
+/************************************************************************/
+/*                        ~VSIGZipReadHandleMT()                        */
+/************************************************************************/
+
+VSIGZipReadHandleMT::~VSIGZipReadHandleMT()
+{
+    Stop();
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+// Returns a new handle, taking ownership of poBaseHandle, if the file has an
+// up-to-date index, is a BGZF file, or has several gzip members in its first
+// PROBE_SIZE bytes. Otherwise returns nullptr and leaves poBaseHandle to the
+// caller.
+
+VSIGZipReadHandleMT *
+VSIGZipReadHandleMT::Create(VSIGZipFilesystemHandler *poFS,
+                            const char *pszFilename, int nThreads,
+                            VSIVirtualHandleUniquePtr &poBaseHandle)
+{
+    if (poBaseHandle->Seek(0, SEEK_END) != 0)
+        return nullptr;
+    const vsi_l_offset nFileSize = poBaseHandle->Tell();
+    // Not worth it for a single segment
+    if (nFileSize <= MIN_SEGMENT_SIZE || poBaseHandle->Seek(0, SEEK_SET) != 0)
+        return nullptr;
+
+    auto poHandle = std::make_unique<VSIGZipReadHandleMT>(
+        poFS, pszFilename, std::move(poBaseHandle), nFileSize, nThreads);
+    if (poHandle->LoadIndex() || poHandle->Probe())
+        return poHandle.release();
+    poBaseHandle = std::move(poHandle->m_poBaseHandle);
+    return nullptr;
+}
+
+/************************************************************************/
+/*                             LoadIndex()                              */
+/************************************************************************/
+
+// Loads the index of access points of the file when CPL_VSIL_GZIP_INDEX is
+// set, if it is up to date and its segments are small enough.
+
+bool VSIGZipReadHandleMT::LoadIndex()
+{
+    if (!CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_INDEX", "NO")))
+        return false;
+    const char *pszBaseFileName = m_osFilename.c_str() + strlen("/vsigzip/");
+    VSIStatBufL sStat;
+    if (VSIStatL(pszBaseFileName, &sStat) != 0)
+        return false;
+    auto poIndex =
+        VSIGZipIndex::Load(VSIGZipIndex::GetFilename(pszBaseFileName),
+                           m_nFileSize, static_cast<GIntBig>(sStat.st_mtime));
+    if (!poIndex || poIndex->aoPoints.empty())
+        return false;
+    vsi_l_offset nPrevOut = 0;
+    vsi_l_offset nPrevPos = 0;
+    for (const auto &oPoint : poIndex->aoPoints)
+    {
+        if (oPoint.out - nPrevOut > MAX_JOB_OUTPUT_SIZE ||
+            oPoint.posInBaseHandle <= nPrevPos)
+        {
+            return false;
+        }
+        nPrevOut = oPoint.out;
+        nPrevPos = oPoint.posInBaseHandle;
+    }
+    if (poIndex->nUncompressedSize - nPrevOut > MAX_JOB_OUTPUT_SIZE)
+        return false;
+    CPLDebug("GZIP", "Multi-threaded decompression using index %s",
+             poIndex->osFilename.c_str());
+    m_poIndex = std::move(poIndex);
+    return true;
+}
+
+/************************************************************************/
+/*                               Probe()                                */
+/************************************************************************/
+
+// Returns whether the file is a BGZF file, or has several gzip members in
+// its first PROBE_SIZE bytes. The probed data is kept in the scan buffer.
+
+bool VSIGZipReadHandleMT::Probe()
+{
+    if (!ReadCompressed(PROBE_SIZE))
+        return false;
+    const auto &osBuffer = m_osScanBuffer;
+    const GByte *pabyData = reinterpret_cast<const GByte *>(osBuffer.data());
+    size_t nHeaderSize = 0;
+    if (ParseGZipHeader(pabyData, osBuffer.size(), nHeaderSize) !=
+        GZipHeaderStatus::OK)
+    {
+        return false;
+    }
+    // BGZF files have a "BC" extra subfield with the size of the member
+    const bool bBGZF = (pabyData[3] & EXTRA_FIELD) != 0 &&
+                       nHeaderSize >= 18 && pabyData[12] == 'B' &&
+                       pabyData[13] == 'C';
+    return bBGZF || FindSegmentEnd(nHeaderSize) < osBuffer.size();
+}
+
+/************************************************************************/
+/*                           ReadCompressed()                           */
+/************************************************************************/
+
+// Makes sure that the scan buffer has at least nMinSize bytes, unless the
+// end of file is reached.
+
+bool VSIGZipReadHandleMT::ReadCompressed(size_t nMinSize)
+{
+    if (m_osScanBuffer.size() >= nMinSize || m_bScanEOF)
+        return true;
+    const vsi_l_offset nPos = m_nScanBufferOffset + m_osScanBuffer.size();
+    const size_t nToRead = static_cast<size_t>(std::min<vsi_l_offset>(
+        nMinSize - m_osScanBuffer.size(), m_nFileSize - nPos));
+    const size_t nOldSize = m_osScanBuffer.size();
+    try
+    {
+        m_osScanBuffer.resize(nOldSize + nToRead);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for /vsigzip/ buffer");
+        return false;
+    }
+    if (m_poBaseHandle->Seek(nPos, SEEK_SET) != 0 ||
+        m_poBaseHandle->Read(&m_osScanBuffer[nOldSize], nToRead) != nToRead)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read %s",
+                 m_osFilename.c_str());
+        m_osScanBuffer.resize(nOldSize);
+        return false;
+    }
+    m_bScanEOF = nPos + nToRead == m_nFileSize;
+    return true;
+}
+
+/************************************************************************/
+/*                           FindSegmentEnd()                           */
+/************************************************************************/
+
+// Returns the position in the scan buffer of the first likely gzip header at
+// or after nStartScan, or the size of the buffer if there is none.
+
+size_t VSIGZipReadHandleMT::FindSegmentEnd(size_t nStartScan) const
+{
+    constexpr size_t FIXED_HEADER_SIZE = 10;
+    const GByte *pabyData =
+        reinterpret_cast<const GByte *>(m_osScanBuffer.data());
+    const size_t nSize = m_osScanBuffer.size();
+    size_t nPos = nStartScan;
+    while (nPos + FIXED_HEADER_SIZE <= nSize)
+    {
+        const void *pMagic = memchr(pabyData + nPos, gz_magic[0],
+                                    nSize - FIXED_HEADER_SIZE + 1 - nPos);
+        if (pMagic == nullptr)
+            break;
+        nPos = static_cast<const GByte *>(pMagic) - pabyData;
+        if (IsLikelyGZipHeaderStart(pabyData + nPos))
+            return nPos;
+        ++nPos;
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                             SubmitJobs()                             */
+/************************************************************************/
+
+// Splits the compressed stream into segments, and submits their
+// decompression, so that there are up to m_nMaxJobsInFlight jobs.
+
+void VSIGZipReadHandleMT::SubmitJobs()
+{
+    if (m_poIndex)
+    {
+        SubmitIndexedJobs();
+        return;
+    }
+    while (static_cast<int>(m_apoJobs.size()) < m_nMaxJobsInFlight &&
+           !(m_bScanEOF && m_osScanBuffer.empty()))
+    {
+        auto poJob = std::make_unique<Job>();
+        poJob->poParent = this;
+        poJob->nStartOffset = m_nScanBufferOffset;
+
+        size_t nEnd = m_osScanBuffer.size();
+        size_t nStartScan = MIN_SEGMENT_SIZE;
+        while (true)
+        {
+            if (!ReadCompressed(nStartScan + MIN_SEGMENT_SIZE))
+            {
+                m_bError = true;
+                return;
+            }
+            nEnd = FindSegmentEnd(std::min(nStartScan, m_osScanBuffer.size()));
+            if (nEnd < m_osScanBuffer.size() || m_bScanEOF)
+                break;
+            if (m_osScanBuffer.size() >= MAX_SEGMENT_SIZE)
+            {
+                // Not worth splitting further
+                poJob->bFallbackOnly = true;
+                break;
+            }
+            // Make sure a header overlapping two reads is found
+            nStartScan = m_osScanBuffer.size() - 9;
+        }
+
+        if (poJob->bFallbackOnly)
+        {
+            m_osScanBuffer.clear();
+            m_nScanBufferOffset = m_nFileSize;
+            m_bScanEOF = true;
+        }
+        else
+        {
+            poJob->osCompressed = m_osScanBuffer.substr(0, nEnd);
+            m_osScanBuffer.erase(0, nEnd);
+            m_nScanBufferOffset += nEnd;
+        }
+        SubmitJob(std::move(poJob), false);
+    }
+}
+
+/************************************************************************/
+/*                         SubmitIndexedJobs()                          */
+/************************************************************************/
+
+// Same as SubmitJobs(), with segments between access points of the index.
+
+void VSIGZipReadHandleMT::SubmitIndexedJobs()
+{
+    const auto &aoPoints = m_poIndex->aoPoints;
+    while (static_cast<int>(m_apoJobs.size()) < m_nMaxJobsInFlight &&
+           m_nIndexSegmentsSubmitted <= aoPoints.size())
+    {
+        const size_t i = m_nIndexSegmentsSubmitted++;
+        auto poJob = std::make_unique<Job>();
+        poJob->poParent = this;
+        poJob->bIndexed = true;
+        vsi_l_offset nStartOut = 0;
+        if (i > 0)
+        {
+            poJob->psPoint = &aoPoints[i - 1];
+            // The first bits of the segment are in the previous byte
+            poJob->nStartOffset = poJob->psPoint->posInBaseHandle -
+                                  (poJob->psPoint->bits ? 1 : 0);
+            nStartOut = poJob->psPoint->out;
+        }
+        vsi_l_offset nEndOffset = m_nFileSize;
+        vsi_l_offset nEndOut = m_poIndex->nUncompressedSize;
+        if (i < aoPoints.size())
+        {
+            nEndOffset = std::min<vsi_l_offset>(
+                m_nFileSize, aoPoints[i].posInBaseHandle + ACCESS_POINT_MARGIN);
+            nEndOut = aoPoints[i].out;
+        }
+        poJob->nExpectedSize = static_cast<size_t>(nEndOut - nStartOut);
+
+        const size_t nToRead =
+            static_cast<size_t>(nEndOffset - poJob->nStartOffset);
+        try
+        {
+            poJob->osCompressed.resize(nToRead);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for /vsigzip/ buffer");
+            m_bError = true;
+            return;
+        }
+        if (m_poBaseHandle->Seek(poJob->nStartOffset, SEEK_SET) != 0 ||
+            m_poBaseHandle->Read(poJob->osCompressed.data(), nToRead) !=
+                nToRead)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read %s",
+                     m_osFilename.c_str());
+            m_bError = true;
+            return;
+        }
+        SubmitJob(std::move(poJob), false);
+    }
+}
+
+/************************************************************************/
+/*                             SubmitJob()                              */
+/************************************************************************/
+
+void VSIGZipReadHandleMT::SubmitJob(std::unique_ptr<Job> poJob, bool bFront)
+{
+    if (m_poJobQueue == nullptr)
+    {
+        CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(m_nThreads);
+        if (poPool == nullptr)
+        {
+            m_bError = true;
+            return;
+        }
+        m_poJobQueue = poPool->CreateJobQueue();
+    }
+    Job *psJob = poJob.get();
+    {
+        std::lock_guard oLock(m_oMutex);
+        if (bFront)
+            m_apoJobs.push_front(std::move(poJob));
+        else
+            m_apoJobs.push_back(std::move(poJob));
+    }
+    if (psJob->bFallbackOnly)
+    {
+        std::lock_guard oLock(m_oMutex);
+        psJob->eStatus = Status::FALLBACK;
+    }
+    else if (!m_poJobQueue->SubmitJob(DecompressSegment, psJob))
+    {
+        std::lock_guard oLock(m_oMutex);
+        psJob->eStatus = Status::ERROR;
+    }
+}
+
+/************************************************************************/
+/*                         DecompressSegment()                          */
+/************************************************************************/
+
+void VSIGZipReadHandleMT::DecompressSegment(void *pData)
+{
+    Job *psJob = static_cast<Job *>(pData);
+    const GByte *pabyData =
+        reinterpret_cast<const GByte *>(psJob->osCompressed.data());
+    const size_t nSize = psJob->osCompressed.size();
+    auto &osOut = psJob->osUncompressed;
+
+    const auto Finish = [psJob](Status eStatus)
+    {
+        std::lock_guard oLock(psJob->poParent->m_oMutex);
+        psJob->eStatus = eStatus;
+        psJob->poParent->m_oCV.notify_all();
+    };
+
+    if (psJob->bIndexed)
+    {
+        Finish(DecompressIndexedSegment(psJob));
+        return;
+    }
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+    {
+        Finish(Status::ERROR);
+        return;
+    }
+
+    Status eStatus = Status::OK;
+    size_t nPos = 0;
+    try
+    {
+        osOut.resize(std::min<size_t>(nSize * 4, MAX_JOB_OUTPUT_SIZE));
+        size_t nOutSize = 0;
+        while (nPos < nSize)
+        {
+            size_t nHeaderSize = 0;
+            const auto eHeaderStatus =
+                ParseGZipHeader(pabyData + nPos, nSize - nPos, nHeaderSize);
+            if (eHeaderStatus != GZipHeaderStatus::OK)
+            {
+                if (eHeaderStatus == GZipHeaderStatus::INCOMPLETE)
+                {
+                    eStatus = Status::TRUNCATED;
+                }
+                else
+                {
+                    // Like VSIGZipHandle, ignore trailing non-gzip data
+                    eStatus = Status::END;
+                }
+                break;
+            }
+
+            inflateReset(&sStream);
+            sStream.next_in =
+                const_cast<Bytef *>(pabyData + nPos + nHeaderSize);
+            sStream.avail_in = static_cast<uInt>(
+                std::min<size_t>(nSize - nPos - nHeaderSize, UINT_MAX));
+            const size_t nMemberOutStart = nOutSize;
+            int ret = Z_OK;
+            bool bOutputLimitReached = false;
+            while (ret == Z_OK)
+            {
+                if (nOutSize == osOut.size())
+                {
+                    if (osOut.size() == MAX_JOB_OUTPUT_SIZE)
+                    {
+                        bOutputLimitReached = true;
+                        break;
+                    }
+                    osOut.resize(
+                        std::min(osOut.size() * 2, MAX_JOB_OUTPUT_SIZE));
+                }
+                sStream.next_out = reinterpret_cast<Bytef *>(&osOut[nOutSize]);
+                sStream.avail_out = static_cast<uInt>(
+                    std::min<size_t>(osOut.size() - nOutSize, UINT_MAX));
+                const uInt nAvailOutBefore = sStream.avail_out;
+                ret = inflate(&sStream, Z_NO_FLUSH);
+                nOutSize += nAvailOutBefore - sStream.avail_out;
+            }
+            if (bOutputLimitReached)
+            {
+                // Leave the current member and the next ones to another
+                // job, or to a VSIGZipHandle if it is the first one.
+                nOutSize = nMemberOutStart;
+                if (nPos == 0)
+                {
+                    eStatus = Status::FALLBACK;
+                }
+                else
+                {
+                    eStatus = Status::PARTIAL;
+                    psJob->nConsumed = nPos;
+                }
+                break;
+            }
+            if (ret == Z_BUF_ERROR && sStream.avail_in == 0)
+            {
+                // The member goes beyond the end of the segment
+                eStatus = Status::TRUNCATED;
+                break;
+            }
+            if (ret != Z_STREAM_END)
+            {
+                eStatus = Status::ERROR;
+                break;
+            }
+            nPos = reinterpret_cast<const GByte *>(sStream.next_in) - pabyData;
+
+            // Check CRC and size of the member
+            if (nSize - nPos < 8)
+            {
+                eStatus = Status::TRUNCATED;
+                break;
+            }
+            const size_t nMemberSize = nOutSize - nMemberOutStart;
+            uint32_t nCRC = 0;
+            uint32_t nISize = 0;
+            memcpy(&nCRC, pabyData + nPos, 4);
+            memcpy(&nISize, pabyData + nPos + 4, 4);
+            CPL_LSBPTR32(&nCRC);
+            CPL_LSBPTR32(&nISize);
+            nPos += 8;
+            if (nISize != static_cast<uint32_t>(nMemberSize) ||
+                nCRC != ComputeCRC32(osOut.data() + nMemberOutStart,
+                                     nMemberSize))
+            {
+                eStatus = Status::ERROR;
+                break;
+            }
+        }
+        osOut.resize(nOutSize);
+    }
+    catch (const std::exception &)
+    {
+        eStatus = Status::ERROR;
+    }
+    inflateEnd(&sStream);
+    Finish(eStatus);
+}
+
+/************************************************************************/
+/*                      DecompressIndexedSegment()                      */
+/************************************************************************/
+
+// Decompresses the nExpectedSize bytes of a segment starting at an access
+// point of the index. The CRCs and sizes of the members that are entirely in
+// the segment are checked.
+
+VSIGZipReadHandleMT::Status
+VSIGZipReadHandleMT::DecompressIndexedSegment(Job *psJob)
+{
+    const GByte *pabyData =
+        reinterpret_cast<const GByte *>(psJob->osCompressed.data());
+    const size_t nSize = psJob->osCompressed.size();
+    const auto *psPoint = psJob->psPoint;
+    auto &osOut = psJob->osUncompressed;
+
+    std::string osWindow;
+    if (psPoint &&
+        !psJob->poParent->m_poIndex->ReadWindow(*psPoint, osWindow))
+    {
+        return Status::ERROR;
+    }
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return Status::ERROR;
+
+    Status eStatus = Status::OK;
+    size_t nPos = 0;
+    size_t nHeaderSize = 0;
+    bool bWholeMember = psPoint == nullptr;
+    if (psPoint)
+    {
+        if (psPoint->bits &&
+            (nSize == 0 || inflatePrime(&sStream, psPoint->bits,
+                                        pabyData[0] >> (8 - psPoint->bits)) !=
+                               Z_OK))
+        {
+            eStatus = Status::ERROR;
+        }
+        else if (inflateSetDictionary(
+                     &sStream, reinterpret_cast<const Bytef *>(osWindow.data()),
+                     static_cast<uInt>(osWindow.size())) != Z_OK)
+        {
+            eStatus = Status::ERROR;
+        }
+        nPos = psPoint->bits ? 1 : 0;
+    }
+    else if (ParseGZipHeader(pabyData, nSize, nHeaderSize) !=
+             GZipHeaderStatus::OK)
+    {
+        eStatus = Status::ERROR;
+    }
+    else
+    {
+        nPos = nHeaderSize;
+    }
+
+    try
+    {
+        osOut.resize(psJob->nExpectedSize);
+        size_t nOutSize = 0;
+        size_t nMemberOutStart = 0;
+        while (eStatus == Status::OK && nOutSize < osOut.size())
+        {
+            sStream.next_in = const_cast<Bytef *>(pabyData + nPos);
+            sStream.avail_in =
+                static_cast<uInt>(std::min<size_t>(nSize - nPos, UINT_MAX));
+            sStream.next_out = reinterpret_cast<Bytef *>(&osOut[nOutSize]);
+            sStream.avail_out = static_cast<uInt>(
+                std::min<size_t>(osOut.size() - nOutSize, UINT_MAX));
+            const uInt nAvailOutBefore = sStream.avail_out;
+            const int ret = inflate(&sStream, Z_NO_FLUSH);
+            nOutSize += nAvailOutBefore - sStream.avail_out;
+            nPos = reinterpret_cast<const GByte *>(sStream.next_in) - pabyData;
+            if (ret == Z_OK)
+                continue;
+            if (ret != Z_STREAM_END || nSize - nPos < 8)
             {
-#ifdef ENABLE_DEBUG
-                CPLDebug("GZIP", "avail_in before = %d", stream.avail_in);
-#endif
-                stream.avail_in = stream.avail_in -
-                                  static_cast<uInt>(m_poBaseHandle->Tell() -
-                                                    offsetEndCompressedData);
-                if (m_poBaseHandle->Seek(offsetEndCompressedData, SEEK_SET) !=
-                    0)
-                    CPLError(CE_Failure, CPLE_FileIO, "Seek() failed");
-#ifdef ENABLE_DEBUG
-                CPLDebug("GZIP", "avail_in after = %d", stream.avail_in);
-#endif
+                eStatus = Status::ERROR;
+                break;
             }
-            if (stream.avail_in == 0)
+
+            // End of member: check it if it is entirely in the segment, and
+            // continue with the next one.
+            if (bWholeMember)
             {
-                z_eof = 1;
-                if (m_poBaseHandle->Error() ||
-                    m_poBaseHandle->Tell() != offsetEndCompressedData)
+                const size_t nMemberSize = nOutSize - nMemberOutStart;
+                uint32_t nCRC = 0;
+                uint32_t nISize = 0;
+                memcpy(&nCRC, pabyData + nPos, 4);
+                memcpy(&nISize, pabyData + nPos + 4, 4);
+                CPL_LSBPTR32(&nCRC);
+                CPL_LSBPTR32(&nISize);
+                if (nISize != static_cast<uint32_t>(nMemberSize) ||
+                    nCRC != ComputeCRC32(osOut.data() + nMemberOutStart,
+                                         nMemberSize))
                 {
-                    z_err = Z_ERRNO;
+                    eStatus = Status::ERROR;
                     break;
                 }
             }
-            stream.next_in = inbuf;
+            nPos += 8;
+            if (nOutSize == osOut.size())
+                break;
+            if (ParseGZipHeader(pabyData + nPos, nSize - nPos, nHeaderSize) !=
+                GZipHeaderStatus::OK)
+            {
+                eStatus = Status::ERROR;
+                break;
+            }
+            nPos += nHeaderSize;
+            inflateReset(&sStream);
+            bWholeMember = true;
+            nMemberOutStart = nOutSize;
         }
-        in += stream.avail_in;
-        out += stream.avail_out;
-        z_err = inflate(&(stream), Z_NO_FLUSH);
-        in -= stream.avail_in;
-        out -= stream.avail_out;
+    }
+    catch (const std::exception &)
+    {
+        eStatus = Status::ERROR;
+    }
+    inflateEnd(&sStream);
+    return eStatus;
+}
 
-        if (z_err == Z_STREAM_END && m_compressed_size != 2)
+/************************************************************************/
+/*                              WaitForJob()                            */
+/************************************************************************/
+
+void VSIGZipReadHandleMT::WaitForJob(Job *psJob)
+{
+    std::unique_lock oLock(m_oMutex);
+    while (psJob->eStatus == Status::PENDING)
+        m_oCV.wait(oLock);
+}
+
+/************************************************************************/
+/*                              NextJob()                               */
+/************************************************************************/
+
+// Makes the first decompressed segment the current one. Returns false at
+// end of file or in case of error.
+
+bool VSIGZipReadHandleMT::NextJob()
+{
+    m_poCurJob.reset();
+    m_nCurJobPos = 0;
+    while (true)
+    {
+        SubmitJobs();
+        if (m_bError)
+            return false;
+        if (m_apoJobs.empty())
         {
-            // Check CRC and original size.
-            crc =
-                crc32(crc, pStart, static_cast<uInt>(stream.next_out - pStart));
-            pStart = stream.next_out;
-            if (m_expected_crc)
+            m_bEOF = true;
+            return false;
+        }
+
+        Job *psJob = m_apoJobs.front().get();
+        WaitForJob(psJob);
+        switch (psJob->eStatus)
+        {
+            case Status::PENDING:
+            case Status::OK:
+            case Status::FALLBACK:
+                m_poCurJob = std::move(m_apoJobs.front());
+                m_apoJobs.pop_front();
+                m_poCurJob->osCompressed.clear();
+                return true;
+
+            case Status::PARTIAL:
             {
-#ifdef ENABLE_DEBUG
-                CPLDebug("GZIP", "Computed CRC = %X. Expected CRC = %X",
-                         static_cast<unsigned int>(crc),
-                         static_cast<unsigned int>(m_expected_crc));
-#endif
+                // Serve the decompressed members, and submit the
+                // decompression of the next ones.
+                auto poJob = std::move(m_apoJobs.front());
+                m_apoJobs.pop_front();
+                auto poRemainingJob = std::make_unique<Job>();
+                poRemainingJob->poParent = this;
+                poRemainingJob->nStartOffset =
+                    poJob->nStartOffset + poJob->nConsumed;
+                poRemainingJob->osCompressed =
+                    poJob->osCompressed.substr(poJob->nConsumed);
+                SubmitJob(std::move(poRemainingJob), true);
+                m_poCurJob = std::move(poJob);
+                m_poCurJob->osCompressed.clear();
+                return true;
             }
-            if (m_expected_crc != 0 && m_expected_crc != crc)
+
+            case Status::END:
             {
-                CPLError(CE_Failure, CPLE_FileIO,
-                         "CRC error. Got %X instead of %X",
-                         static_cast<unsigned int>(crc),
-                         static_cast<unsigned int>(m_expected_crc));
-                z_err = Z_DATA_ERROR;
+                auto poJob = std::move(m_apoJobs.front());
+                m_apoJobs.pop_front();
+                Stop();
+                m_osScanBuffer.clear();
+                m_nScanBufferOffset = m_nFileSize;
+                m_bScanEOF = true;
+                m_poCurJob = std::move(poJob);
+                m_poCurJob->osCompressed.clear();
+                return true;
             }
-            else if (m_expected_crc == 0)
+
+            case Status::TRUNCATED:
             {
-                const uLong read_crc = static_cast<unsigned long>(getLong());
-                if (read_crc != crc)
+                // The start of the next segment was not a member start:
+                // merge both segments.
+                auto poJob = std::move(m_apoJobs.front());
+                m_apoJobs.pop_front();
+                poJob->eStatus = Status::PENDING;
+                poJob->osUncompressed.clear();
+                if (m_apoJobs.empty() && m_bScanEOF && m_osScanBuffer.empty())
                 {
-                    CPLError(CE_Failure, CPLE_FileIO,
-                             "CRC error. Got %X instead of %X",
-                             static_cast<unsigned int>(crc),
-                             static_cast<unsigned int>(read_crc));
-                    z_err = Z_DATA_ERROR;
+                    // Truncated file
+                    poJob->bFallbackOnly = true;
                 }
                 else
                 {
-                    CPL_IGNORE_RET_VAL(getLong());
-                    // The uncompressed length returned by above getlong() may
-                    // be different from out in case of concatenated .gz files.
-                    // Check for such files:
-                    check_header();
-                    if (z_err == Z_OK)
-                    {
-                        inflateReset(&(stream));
-                        crc = 0;
-                    }
+                    SubmitJobs();
+                    if (m_bError)
+                        return false;
+                    auto poNextJob = std::move(m_apoJobs.front());
+                    m_apoJobs.pop_front();
+                    WaitForJob(poNextJob.get());
+                    if (poNextJob->bFallbackOnly)
+                        poJob->bFallbackOnly = true;
+                    else
+                        poJob->osCompressed += poNextJob->osCompressed;
                 }
+                SubmitJob(std::move(poJob), true);
+                break;
             }
+
+            case Status::ERROR:
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "In file %s, decompression failed at offset "
+                         CPL_FRMT_GUIB,
+                         m_osFilename.c_str(), psJob->nStartOffset);
+                m_bError = true;
+                return false;
         }
-        if (z_err != Z_OK || z_eof)
-            break;
     }
-    crc = crc32(crc, pStart, static_cast<uInt>(stream.next_out - pStart));
+}
 
-    unsigned ret = len - stream.avail_out;
-    if (z_err != Z_OK && z_err != Z_STREAM_END)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "In file %s, at line %d, decompression failed with "
-                 "z_err = %d, return = %u",
-                 __FILE__, __LINE__, z_err, ret);
-    }
-    else if (ret < nBytes)
-    {
-        m_bEOF = true;
+/************************************************************************/
+/*                           StartSeqHandle()                           */
+/************************************************************************/
+
+// Continues reading with a VSIGZipHandle from the member start at
+// nCompressedOffset.
+
+bool VSIGZipReadHandleMT::StartSeqHandle(vsi_l_offset nCompressedOffset)
+{
+    Stop();
+
+    const char *pszBaseFileName = m_osFilename.c_str() + strlen("/vsigzip/");
+    VSIFilesystemHandler *poFSHandler =
+        VSIFileManager::GetHandler(pszBaseFileName);
+    VSIVirtualHandleUniquePtr poBaseHandle(
+        poFSHandler->Open(pszBaseFileName, "rb"));
+    if (!poBaseHandle)
+        return false;
+
+    // VSIGZipHandle only parses the header of the first member when it
+    // starts at the beginning of the file.
+    vsi_l_offset nDataOffset = nCompressedOffset;
+    if (nCompressedOffset > 0)
+    {
+        std::string osHeader;
+        osHeader.resize(static_cast<size_t>(std::min<vsi_l_offset>(
+            MIN_SEGMENT_SIZE, m_nFileSize - nCompressedOffset)));
+        size_t nHeaderSize = 0;
+        if (poBaseHandle->Seek(nCompressedOffset, SEEK_SET) != 0 ||
+            poBaseHandle->Read(osHeader.data(), osHeader.size()) !=
+                osHeader.size() ||
+            ParseGZipHeader(reinterpret_cast<const GByte *>(osHeader.data()),
+                            osHeader.size(),
+                            nHeaderSize) != GZipHeaderStatus::OK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "In file %s, invalid gzip header at offset " CPL_FRMT_GUIB,
+                     m_osFilename.c_str(), nCompressedOffset);
+            return false;
+        }
+        nDataOffset += nHeaderSize;
     }
 
-#ifdef ENABLE_DEBUG
-    CPLDebug("GZIP", "Read return %u (z_err=%d, z_eof=%d)", ret, z_err, z_eof);
-#endif
-    return ret;
+    auto poHandle = std::make_unique<VSIGZipHandle>(
+        std::move(poBaseHandle), nullptr, nDataOffset,
+        nCompressedOffset > 0 ? m_nFileSize - nDataOffset : 0);
+    if (!poHandle->IsInitOK())
+        return false;
+    m_poSeqHandle = std::move(poHandle);
+    m_nSeqHandleOffset = m_nOffset;
+    return true;
 }
 
 /************************************************************************/
-/*                              getLong()                               */
+/*                                Stop()                                */
 /************************************************************************/
 
-uLong VSIGZipHandle::getLong()
+void VSIGZipReadHandleMT::Stop()
 {
-    uLong x = static_cast<uLong>(get_byte()) & 0xFF;
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    m_apoJobs.clear();
+    m_poCurJob.reset();
+    m_nCurJobPos = 0;
+}
 
-    x += (static_cast<uLong>(get_byte()) & 0xFF) << 8;
-    x += (static_cast<uLong>(get_byte()) & 0xFF) << 16;
-    const int c = get_byte();
-    if (c == EOF)
-    {
-        z_err = Z_DATA_ERROR;
-        return 0;
-    }
-    x += static_cast<uLong>(c) << 24;
-    // coverity[overflow_sink]
-    return x;
+/************************************************************************/
+/*                              Restart()                               */
+/************************************************************************/
+
+void VSIGZipReadHandleMT::Restart()
+{
+    Stop();
+    m_osScanBuffer.clear();
+    m_nScanBufferOffset = 0;
+    m_bScanEOF = false;
+    m_nIndexSegmentsSubmitted = 0;
+    m_nOffset = 0;
+    m_bEOF = false;
+    m_bError = false;
 }
 
 /************************************************************************/
-/*                               Write()                                */
+/*                                Read()                                */
 /************************************************************************/
 
-size_t VSIGZipHandle::Write(const void * /* pBuffer */, size_t /* nBytes */)
+size_t VSIGZipReadHandleMT::Read(void *pBuffer, size_t nBytes)
 {
-    CPLError(CE_Failure, CPLE_NotSupported,
-             "VSIFWriteL is not supported on GZip streams");
-    return 0;
+    if (m_poSeqHandle)
+        return m_poSeqHandle->Read(pBuffer, nBytes);
+    if (m_bEOF || m_bError)
+        return 0;
+
+    GByte *pabyBuffer = static_cast<GByte *>(pBuffer);
+    size_t nRead = 0;
+    while (nRead < nBytes)
+    {
+        if (m_poCurJob && m_nCurJobPos < m_poCurJob->osUncompressed.size())
+        {
+            const size_t nToCopy =
+                std::min(nBytes - nRead,
+                         m_poCurJob->osUncompressed.size() - m_nCurJobPos);
+            memcpy(pabyBuffer + nRead,
+                   m_poCurJob->osUncompressed.data() + m_nCurJobPos, nToCopy);
+            m_nCurJobPos += nToCopy;
+            m_nOffset += nToCopy;
+            nRead += nToCopy;
+        }
+        else if (m_poCurJob && m_poCurJob->eStatus == Status::FALLBACK)
+        {
+            if (!StartSeqHandle(m_poCurJob->nStartOffset))
+            {
+                m_bError = true;
+                break;
+            }
+            return nRead +
+                   m_poSeqHandle->Read(pabyBuffer + nRead, nBytes - nRead);
+        }
+        else if (!NextJob())
+        {
+            break;
+        }
+    }
+    if (nRead < nBytes && !m_bError)
+        m_bEOF = true;
+    return nRead;
 }
 
 /************************************************************************/
-/*                                Eof()                                 */
+/*                                Seek()                                */
 /************************************************************************/
 
-int VSIGZipHandle::Eof()
+int VSIGZipReadHandleMT::Seek(vsi_l_offset nOffset, int nWhence)
 {
-#ifdef ENABLE_DEBUG
-    CPLDebug("GZIP", "Eof()");
-#endif
-    return m_bEOF;
+    if (nWhence == SEEK_CUR)
+    {
+        nOffset += Tell();
+    }
+    else if (nWhence == SEEK_END)
+    {
+        if (nOffset != 0)
+            return -1;
+        nOffset = std::numeric_limits<vsi_l_offset>::max();
+    }
+    else if (nWhence != SEEK_SET)
+    {
+        return -1;
+    }
+
+    if (m_poSeqHandle)
+    {
+        if (nOffset == std::numeric_limits<vsi_l_offset>::max())
+            return m_poSeqHandle->Seek(0, SEEK_END);
+        if (nOffset >= m_nSeqHandleOffset)
+            return m_poSeqHandle->Seek(nOffset - m_nSeqHandleOffset,
+                                       SEEK_SET);
+    }
+    else
+    {
+        m_bEOF = false;
+        if (nOffset < m_nOffset && m_nBackwardSeeks++ == 0)
+        {
+            // A single rewind, for example after the header of the file
+            // has been read to identify its format, does not prevent
+            // streaming.
+            Restart();
+        }
+    }
+
+    if (nOffset < Tell())
+    {
+        // Random access: use a regular handle, which keeps snapshots of the
+        // decompression state.
+        Stop();
+        m_poSeqHandle.reset(
+            m_poFS->OpenGZipReadOnly(m_osFilename.c_str(), "rb"));
+        m_nSeqHandleOffset = 0;
+        if (!m_poSeqHandle)
+        {
+            m_bError = true;
+            return -1;
+        }
+        return m_poSeqHandle->Seek(nOffset, SEEK_SET);
+    }
+
+    // Skip forward
+    std::vector<GByte> abyBuffer;
+    while (Tell() < nOffset)
+    {
+        if (m_poSeqHandle)
+        {
+            if (nOffset == std::numeric_limits<vsi_l_offset>::max())
+                return m_poSeqHandle->Seek(0, SEEK_END);
+            return m_poSeqHandle->Seek(nOffset - m_nSeqHandleOffset,
+                                       SEEK_SET);
+        }
+        if (abyBuffer.empty())
+            abyBuffer.resize(Z_BUFSIZE);
+        const size_t nToRead = static_cast<size_t>(
+            std::min<vsi_l_offset>(nOffset - Tell(), abyBuffer.size()));
+        if (Read(abyBuffer.data(), nToRead) != nToRead)
+        {
+            if (nOffset == std::numeric_limits<vsi_l_offset>::max() &&
+                !m_bError)
+            {
+                m_bEOF = false;
+                return 0;
+            }
+            return -1;
+        }
+    }
+    return 0;
 }
 
 /************************************************************************/
-/*                               Error()                                */
+/*                                Tell()                                */
 /************************************************************************/
 
-int VSIGZipHandle::Error()
+vsi_l_offset VSIGZipReadHandleMT::Tell()
 {
-#ifdef ENABLE_DEBUG
-    CPLDebug("GZIP", "Error()");
-#endif
-    return z_err != Z_OK && z_err != Z_STREAM_END;
+    if (m_poSeqHandle)
+        return m_nSeqHandleOffset + m_poSeqHandle->Tell();
+    return m_nOffset;
 }
 
 /************************************************************************/
-/*                              ClearErr()                              */
+/*                                Eof()                                 */
 /************************************************************************/
 
-void VSIGZipHandle::ClearErr()
+int VSIGZipReadHandleMT::Eof()
 {
-    m_poBaseHandle->ClearErr();
-    z_eof = 0;
-    m_bEOF = false;
-    z_err = Z_OK;
+    if (m_poSeqHandle)
+        return m_poSeqHandle->Eof();
+    return m_bEOF;
 }
 
 /************************************************************************/
-/*                               Flush()                                */
+/*                               Error()                                */
 /************************************************************************/
 
-int VSIGZipHandle::Flush()
+int VSIGZipReadHandleMT::Error()
 {
-    return 0;
+    if (m_poSeqHandle)
+        return m_poSeqHandle->Error();
+    return m_bError;
 }
 
 /************************************************************************/
-/*                               Close()                                */
+/*                              ClearErr()                              */
 /************************************************************************/
 
-int VSIGZipHandle::Close()
+void VSIGZipReadHandleMT::ClearErr()
 {
-    return 0;
+    if (m_poSeqHandle)
+        m_poSeqHandle->ClearErr();
+    m_bEOF = false;
+    m_bError = false;
 }
 
 #ifdef ENABLE_DEFLATE64
@@ -3046,7 +4813,25 @@ VSIGZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     /*      Otherwise we are in the read access case.                       */
     /* -------------------------------------------------------------------- */
 
-    VSIGZipHandle *poGZIPHandle = OpenGZipReadOnly(pszFilename, pszAccess);
+    const int nThreads = GDALGetNumThreads(/* nMaxVal = */ 128,
+                                           /* bDefaultToAllCPUs = */ false);
+    VSIVirtualHandleUniquePtr poBaseHandle;
+    if (nThreads > 1)
+    {
+        poBaseHandle =
+            poFSHandler->Open(pszFilename + strlen("/vsigzip/"), "rb");
+        if (poBaseHandle == nullptr)
+            return nullptr;
+        if (auto poMTHandle = VSIGZipReadHandleMT::Create(
+                this, pszFilename, nThreads, poBaseHandle))
+        {
+            return VSIVirtualHandleUniquePtr(
+                VSICreateBufferedReaderHandle(poMTHandle));
+        }
+    }
+
+    VSIGZipHandle *poGZIPHandle =
+        OpenGZipReadOnly(pszFilename, pszAccess, std::move(poBaseHandle));
     if (poGZIPHandle)
         // Wrap the VSIGZipHandle inside a buffered reader that will
         // improve dramatically performance when doing small backward
@@ -3077,8 +4862,9 @@ bool VSIGZipFilesystemHandler::SupportsSequentialWrite(const char *pszPath,
 /************************************************************************/
 
 VSIGZipHandle *
-VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
-                                           const char *pszAccess)
+VSIGZipFilesystemHandler::OpenGZipReadOnly(
+    const char *pszFilename, const char *pszAccess,
+    VSIVirtualHandleUniquePtr poBaseHandle)
 {
     VSIFilesystemHandler *poFSHandler =
         VSIFileManager::GetHandler(pszFilename + strlen("/vsigzip/"));
@@ -3103,14 +4889,18 @@ VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
     CPL_IGNORE_RET_VAL(pszAccess);
 #endif
 
+    // Reuse the handle of the base file if it has already been opened
     VSIVirtualHandleUniquePtr poVirtualHandle(
-        poFSHandler->Open(pszFilename + strlen("/vsigzip/"), "rb"));
+        poBaseHandle ? std::move(poBaseHandle)
+                     : poFSHandler->Open(pszFilename + strlen("/vsigzip/"),
+                                         "rb"));
 
     if (poVirtualHandle == nullptr)
         return nullptr;
 
     unsigned char signature[2] = {'\0', '\0'};
-    if (poVirtualHandle->Read(signature, 2) != 2 ||
+    if (poVirtualHandle->Seek(0, SEEK_SET) != 0 ||
+        poVirtualHandle->Read(signature, 2) != 2 ||
         signature[0] != gz_magic[0] || signature[1] != gz_magic[1])
     {
         return nullptr;
@@ -3128,6 +4918,8 @@ VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
     {
         return nullptr;
     }
+    if (CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_INDEX", "NO")))
+        poHandle->InitIndex();
     return poHandle.release();
 }
 
@@ -3253,8 +5045,9 @@ const char *VSIGZipFilesystemHandler::GetOptions()
 {
     return "<Options>"
            "  <Option name='GDAL_NUM_THREADS' type='string' "
-           "description='Number of threads for compression. Either a integer "
-           "or ALL_CPUS'/>"
+           "description='Number of threads for compression, and "
+           "decompression of files made of several gzip members. Either a "
+           "integer or ALL_CPUS'/>"
            "  <Option name='CPL_VSIL_DEFLATE_CHUNK_SIZE' type='string' "
            "description='Chunk of uncompressed data for parallelization. "
            "Use K(ilobytes) or M(egabytes) suffix' default='1M'/>"